@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "IndexMinPQ.hpp"
+
+/**
+ * Straight-line distance between vertex coordinates, for use as an A*
+ * heuristic on geometric graphs such as road networks.
+ *
+ * The heuristic is admissible as long as no edge weighs less than the
+ * Euclidean distance between its endpoints times the given scale.
+ */
+class EuclideanHeuristic {
+    std::vector<std::pair<double, double>> coordinates;  // coordinates[v] = (x, y) position of v
+    double scale;                                        // multiplier from distance to weight units
+
+public:
+    explicit EuclideanHeuristic(std::vector<std::pair<double, double>> coordinates, const double scale = 1.0) :
+        coordinates(std::move(coordinates)),
+        scale(scale) {
+        if (std::isnan(scale) || scale < 0.0) {
+            throw std::invalid_argument("Scale must be non-negative");
+        }
+    }
+
+    // Lower bound on the length of any path from v to t
+    double operator()(const int v, const int t) const {
+        const double dx = coordinates[v].first - coordinates[t].first;
+        const double dy = coordinates[v].second - coordinates[t].second;
+        return scale * std::sqrt(dx * dx + dy * dy);
+    }
+
+    int V() const { return static_cast<int>(coordinates.size()); }
+};
+
+/**
+ * Point-to-point shortest path engine for edge-weighted digraphs with
+ * non-negative weights, using A* search.
+ *
+ * A* is Dijkstra's algorithm with the priority of vertex v raised from
+ * dist(s, v) to dist(s, v) + h(v, t), where the heuristic h is a lower bound
+ * on the remaining distance to t. Vertices that head away from t are
+ * postponed, so far fewer vertices are settled before t. With h = 0 it
+ * settles exactly the vertices DijkstraQuery settles.
+ *
+ * The heuristic is any callable double(int v, int t). It must be admissible
+ * (never overestimate dist(v, t)) for the result to be a shortest path. If it
+ * is admissible but not consistent, vertices may be settled more than once,
+ * which is handled by reinserting them into the queue.
+ *
+ * Like DijkstraQuery, the engine is bound to one digraph, validates weights
+ * once and resets only the vertices touched by the previous query. The
+ * digraph must outlive the engine and must not change while bound; one
+ * engine must not be shared between threads.
+ *
+ * Time complexity: O(V + E) to bind; O((V' + E') log V') per query over the explored region
+ * Space complexity: O(V)
+ */
+template <typename GraphType = EdgeWeightedDigraph, typename Heuristic = std::function<double(int, int)>>
+class AStarSearch {
+    const GraphType& g;
+    Heuristic heuristic;
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest known path from s to v
+    std::vector<double> distTo_;                      // distTo_[v] = length of shortest known path from s to v
+    std::vector<double> estimate;                     // estimate[v] = h(v, t), computed on first touch
+    IndexMinPQ<double> pq;                            // vertices ordered by distTo_[v] + estimate[v]
+    std::vector<int> touched;                         // vertices whose distTo_ was set by the last query
+    int target = -1;                                  // target of the last query (-1 before the first)
+    int settled = 0;                                  // vertices settled by the last query
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    void relax(const DirectedEdge& e) {
+        const int v = e.from();
+        const int w = e.to();
+        const double candidate = distTo_[v] + e.weight();
+
+        if (distTo_[w] > candidate) {
+            if (distTo_[w] == std::numeric_limits<double>::max()) {
+                touched.push_back(w);
+                estimate[w] = heuristic(w, target);
+            }
+            distTo_[w] = candidate;
+            edgeTo[w] = e;
+
+            // changeKey rather than decreaseKey: adding the estimate can round two distinct distances to one key
+            if (pq.contains(w)) {
+                pq.changeKey(w, candidate + estimate[w]);
+            } else {
+                pq.insert(w, candidate + estimate[w]);
+            }
+        }
+    }
+
+    void reset() {
+        for (const int v : touched) {
+            distTo_[v] = std::numeric_limits<double>::max();
+            edgeTo[v].reset();
+        }
+        touched.clear();
+        pq.clear();
+        settled = 0;
+    }
+
+public:
+    /**
+     * Binds the engine to an edge-weighted digraph and a heuristic.
+     *
+     * @param g the edge-weighted digraph
+     * @param heuristic admissible lower bound h(v, t) on the distance from v to t
+     * @throws std::invalid_argument if any edge has negative weight
+     */
+    AStarSearch(const GraphType& g, Heuristic heuristic) :
+        g(g),
+        heuristic(std::move(heuristic)),
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        estimate(g.V(), 0.0),
+        pq(g.V()) {
+
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+            }
+        }
+    }
+
+    AStarSearch(const AStarSearch&) = delete;
+    AStarSearch& operator=(const AStarSearch&) = delete;
+
+    /**
+     * Computes the shortest path from s to t, stopping once t is settled.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double query(const int s, const int t) {
+        validateVertex(s);
+        validateVertex(t);
+        reset();
+        target = t;
+
+        distTo_[s] = 0.0;
+        estimate[s] = heuristic(s, t);
+        touched.push_back(s);
+        pq.insert(s, estimate[s]);
+
+        while (!pq.empty()) {
+            const int v = pq.removeMin();
+            ++settled;
+            if (v == t) break;
+
+            for (const auto& e : g.adj(v)) {
+                relax(e);
+            }
+        }
+        return distTo_[t];
+    }
+
+    /**
+     * Returns true if the last query found a path.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    bool hasPath() const {
+        if (target == -1) throw std::logic_error("No query has been run");
+        return distTo_[target] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns the shortest path found by the last query as a sequence of
+     * directed edges, or an empty vector if there is none.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    std::vector<DirectedEdge> path() const {
+        if (!hasPath()) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> result;
+        for (std::optional<DirectedEdge> e = edgeTo[target]; e.has_value(); e = edgeTo[e->from()]) {
+            result.push_back(*e);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    // Number of vertices settled by the last query (a vertex settled twice counts twice)
+    int settledCount() const { return settled; }
+
+    // Number of vertices whose distance was set by the last query
+    int touchedCount() const { return static_cast<int>(touched.size()); }
+
+    // Number of vertices in the bound digraph
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
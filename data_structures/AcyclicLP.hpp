@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "Topological.hpp"
+
+/**
+ * Computes longest paths from a source vertex in an edge-weighted directed
+ * acyclic graph (DAG).
+ *
+ * This is AcyclicSP with the comparison reversed: vertices are relaxed in
+ * topological order, keeping the heaviest path into each vertex. In a DAG
+ * this is well defined for any edge weights. With job durations as weights,
+ * the longest path from a start vertex is the critical path of a schedule,
+ * and distTo(v) is the earliest time job v can start.
+ *
+ * Time complexity: O(V + E)
+ * Space complexity: O(V)
+ */
+class AcyclicLP {
+    std::vector<double> distTo_;                      // distTo_[v] = distance of longest path from s to v
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on longest path from s to v
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+public:
+    /**
+     * Computes longest paths from s in the DAG g.
+     *
+     * @param g the edge-weighted directed acyclic graph
+     * @param s the source vertex
+     * @throws std::invalid_argument if s is invalid or g has a directed cycle
+     */
+    template <typename GraphType>
+    AcyclicLP(const GraphType& g, const int s) :
+        distTo_(g.V(), std::numeric_limits<double>::lowest()),
+        edgeTo(g.V()) {
+
+        validateVertex(s);
+        const Topological topological(g);
+        if (!topological.hasOrder()) {
+            throw std::invalid_argument("Digraph is not acyclic");
+        }
+
+        distTo_[s] = 0.0;
+        const std::vector<int> order = topological.order();
+        // Vertices before s in the order are unreachable from it
+        for (auto it = order.begin() + topological.rank(s); it != order.end(); ++it) {
+            const int v = *it;
+            if (distTo_[v] == std::numeric_limits<double>::lowest()) continue;
+            for (const auto& e : g.adj(v)) {
+                const int w = e.to();
+                if (distTo_[w] < distTo_[v] + e.weight()) {
+                    distTo_[w] = distTo_[v] + e.weight();
+                    edgeTo[w] = e;
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the length of a longest path from the source to v.
+     *
+     * @return the distance, or the lowest double value if there is no path
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] > std::numeric_limits<double>::lowest();
+    }
+
+    /**
+     * Returns a longest path from the source to v as a sequence of directed
+     * edges, or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (std::optional<DirectedEdge> e = edgeTo[v]; e.has_value(); e = edgeTo[e->from()]) {
+            path.push_back(*e);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Number of vertices
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "Topological.hpp"
+
+/**
+ * Computes shortest paths from a source vertex in an edge-weighted directed
+ * acyclic graph (DAG).
+ *
+ * Vertices are relaxed in topological order: when a vertex is reached, every
+ * edge into it has already been relaxed, so its distance is final and each
+ * edge is relaxed exactly once. No priority queue is needed, and negative
+ * edge weights are allowed.
+ *
+ * Time complexity: O(V + E)
+ * Space complexity: O(V)
+ */
+class AcyclicSP {
+    std::vector<double> distTo_;                      // distTo_[v] = distance of shortest path from s to v
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest path from s to v
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+public:
+    /**
+     * Computes shortest paths from s in the DAG g.
+     *
+     * @param g the edge-weighted directed acyclic graph
+     * @param s the source vertex
+     * @throws std::invalid_argument if s is invalid or g has a directed cycle
+     */
+    template <typename GraphType>
+    AcyclicSP(const GraphType& g, const int s) :
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        edgeTo(g.V()) {
+
+        validateVertex(s);
+        const Topological topological(g);
+        if (!topological.hasOrder()) {
+            throw std::invalid_argument("Digraph is not acyclic");
+        }
+
+        distTo_[s] = 0.0;
+        const std::vector<int> order = topological.order();
+        // Vertices before s in the order are unreachable from it
+        for (auto it = order.begin() + topological.rank(s); it != order.end(); ++it) {
+            const int v = *it;
+            if (distTo_[v] == std::numeric_limits<double>::max()) continue;
+            for (const auto& e : g.adj(v)) {
+                const int w = e.to();
+                if (distTo_[w] > distTo_[v] + e.weight()) {
+                    distTo_[w] = distTo_[v] + e.weight();
+                    edgeTo[w] = e;
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the length of a shortest path from the source to v.
+     *
+     * @return the distance, or the maximum double value if there is no path
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns a shortest path from the source to v as a sequence of directed
+     * edges, or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (std::optional<DirectedEdge> e = edgeTo[v]; e.has_value(); e = edgeTo[e->from()]) {
+            path.push_back(*e);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Number of vertices
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * Non-owning, read-only view over the neighbors (or incident edges) of a single
+ * vertex in a graph.
+ *
+ * The view stores only a pair of iterators and the number of elements between
+ * them, so returning one from adj(v) performs no heap allocation. It stays valid
+ * as long as the graph it was obtained from is alive and no edges are added to
+ * the viewed vertex.
+ *
+ * Supports range-based for loops, size(), empty() and operator[]. Indexing is
+ * O(1) for contiguous storage (CSR graphs) and O(i) for list-based storage.
+ *
+ * A view converts implicitly to a std::vector when an owning copy is needed,
+ * e.g. std::vector<int> neighbors = g.adj(v);
+ */
+template <typename Iterator>
+class AdjacencyView {
+    Iterator first_;    // first neighbor of the vertex
+    Iterator last_;     // one past the last neighbor of the vertex
+    std::size_t size_;  // number of neighbors in [first_, last_)
+
+public:
+    using iterator = Iterator;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+
+    AdjacencyView(Iterator first, Iterator last, const std::size_t size) :
+        first_(first),
+        last_(last),
+        size_(size) {}
+
+    Iterator begin() const { return first_; }
+
+    Iterator end() const { return last_; }
+
+    std::size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    // Returns the i-th neighbor in iteration order (no bounds checking)
+    reference operator[](const std::size_t i) const {
+        return *std::next(first_, static_cast<typename std::iterator_traits<Iterator>::difference_type>(i));
+    }
+
+    // Copies the viewed elements into an owning vector
+    operator std::vector<value_type>() const {
+        std::vector<value_type> result;
+        result.reserve(size_);
+        result.insert(result.end(), first_, last_);
+        return result;
+    }
+
+    friend bool operator==(const AdjacencyView& view, const std::vector<value_type>& other) {
+        return view.size() == other.size() && std::equal(view.begin(), view.end(), other.begin());
+    }
+
+    friend bool operator==(const std::vector<value_type>& other, const AdjacencyView& view) {
+        return view == other;
+    }
+
+    friend bool operator!=(const AdjacencyView& view, const std::vector<value_type>& other) {
+        return !(view == other);
+    }
+
+    friend bool operator!=(const std::vector<value_type>& other, const AdjacencyView& view) {
+        return !(view == other);
+    }
+};
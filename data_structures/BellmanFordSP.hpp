@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CSREdgeWeightedDigraph.hpp"
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "EdgeWeightedDirectedCycle.hpp"
+#include "Queue.hpp"
+
+/**
+ * Computes shortest paths from a source vertex in an edge-weighted digraph
+ * whose edge weights may be negative, using the queue-based Bellman-Ford
+ * algorithm (also known as SPFA).
+ *
+ * Only vertices whose distance changed in the previous pass can lower the
+ * distance of their neighbors, so they are kept in a FIFO queue, each at
+ * most once at a time, and relaxed in turn. Without a negative cycle
+ * reachable from the source, the queue empties after at most V passes.
+ *
+ * Negative cycles are detected by checking, after every V edge relaxations,
+ * whether the edges in edgeTo[] form a cycle (any cycle there has negative
+ * weight). If one is found the algorithm stops; distances and paths are then
+ * undefined, and negativeCycle() returns the cycle.
+ *
+ * Time complexity: O(V * E) worst case; typically close to O(E) in practice
+ * Space complexity: O(V)
+ */
+class BellmanFordSP {
+    std::vector<double> distTo_;                      // distTo_[v] = distance of shortest known path from s to v
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest known path from s to v
+    std::vector<bool> onQueue;                        // onQueue[v] = is v currently on the queue?
+    Queue<int> queue;                                 // vertices whose edges need relaxing
+    long long cost = 0;                               // number of edge relaxations performed
+    std::vector<DirectedEdge> cycle;                  // a negative cycle reachable from s (empty if none)
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    template <typename GraphType>
+    void relax(const GraphType& g, const int v) {
+        for (const auto& e : g.adj(v)) {
+            const int w = e.to();
+            if (distTo_[w] > distTo_[v] + e.weight()) {
+                distTo_[w] = distTo_[v] + e.weight();
+                edgeTo[w] = e;
+                if (!onQueue[w]) {
+                    queue.enqueue(w);
+                    onQueue[w] = true;
+                }
+            }
+            if (++cost % g.V() == 0) {
+                findNegativeCycle();
+                if (hasNegativeCycle()) return;
+            }
+        }
+    }
+
+    // Looks for a cycle among the edges of the current shortest path tree
+    void findNegativeCycle() {
+        const int V = static_cast<int>(distTo_.size());
+        std::vector<DirectedEdge> spt;
+        for (int v = 0; v < V; ++v) {
+            if (edgeTo[v].has_value()) spt.push_back(*edgeTo[v]);
+        }
+        const EdgeWeightedDirectedCycle finder(CSREdgeWeightedDigraph(V, spt));
+        cycle = finder.cycle();
+    }
+
+public:
+    /**
+     * Computes shortest paths from s, or finds a negative cycle reachable from s.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @throws std::invalid_argument if s is invalid
+     */
+    template <typename GraphType>
+    BellmanFordSP(const GraphType& g, const int s) :
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        edgeTo(g.V()),
+        onQueue(g.V(), false) {
+
+        validateVertex(s);
+        distTo_[s] = 0.0;
+        queue.enqueue(s);
+        onQueue[s] = true;
+        while (!queue.empty() && !hasNegativeCycle()) {
+            const int v = queue.dequeue();
+            onQueue[v] = false;
+            relax(g, v);
+        }
+    }
+
+    /**
+     * Returns true if there is a negative cycle reachable from the source.
+     */
+    bool hasNegativeCycle() const {
+        return !cycle.empty();
+    }
+
+    /**
+     * Returns a negative cycle reachable from the source as a sequence of
+     * directed edges, or an empty vector if there is none.
+     */
+    std::vector<DirectedEdge> negativeCycle() const {
+        return cycle;
+    }
+
+    /**
+     * Returns the length of a shortest path from the source to v.
+     *
+     * @return the distance, or the maximum double value if there is no path
+     * @throws std::invalid_argument if vertex v is invalid
+     * @throws std::logic_error if there is a negative cycle
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns a shortest path from the source to v as a sequence of directed
+     * edges, or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     * @throws std::logic_error if there is a negative cycle
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (std::optional<DirectedEdge> e = edgeTo[v]; e.has_value(); e = edgeTo[e->from()]) {
+            path.push_back(*e);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Number of edge relaxations performed
+    long long relaxations() const { return cost; }
+
+    // Number of vertices
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Digraph.hpp"
+
+/**
+ * Point-to-point shortest (fewest edges) directed path query engine using
+ * bidirectional breadth-first search.
+ *
+ * The engine is bound to a digraph once and then answers many (s, t) queries.
+ * Each query alternately expands a full level of the forward search from s
+ * (on the digraph) or of the backward search from t (on its reverse),
+ * always picking the side with the smaller frontier, and stops as soon as
+ * the two searches meet. The first meeting vertex lies on a shortest path.
+ *
+ * All scratch arrays are allocated once. Instead of clearing them, every
+ * query bumps an epoch counter, and an entry counts as set only if its stamp
+ * equals the current epoch, so a query costs time proportional to the
+ * vertices and edges it actually visits rather than O(V).
+ *
+ * The digraph (and the reverse, if passed in) must outlive the engine.
+ * Queries modify the scratch arrays, so one engine must not be shared
+ * between threads.
+ *
+ * Time complexity: O(V + E) worst case per query, typically much less
+ * Space complexity: O(V)
+ */
+template <typename GraphType, typename ReverseType = decltype(std::declval<const GraphType&>().reverse())>
+class BidirectionalBFS {
+    const GraphType& g;
+    std::unique_ptr<const ReverseType> ownedReverse;  // set if the engine computed the reverse itself
+    const ReverseType& reverse;
+    std::vector<unsigned> forwardStamp;   // forwardStamp[v] == epoch if s reaches v in this query
+    std::vector<unsigned> backwardStamp;  // backwardStamp[v] == epoch if v reaches t in this query
+    std::vector<int> forwardEdgeTo;       // previous vertex on the path from s to v
+    std::vector<int> backwardEdgeTo;      // next vertex on the path from v to t
+    std::vector<int> forwardFrontier;
+    std::vector<int> backwardFrontier;
+    std::vector<int> next;
+    unsigned epoch = 0;
+    int verticesVisited_ = 0;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= g.V()) {
+            throw std::invalid_argument("Vertex out of range");
+        }
+    }
+
+    void nextEpoch() {
+        if (++epoch == 0) {
+            // Counter wrapped around: old stamps could collide with new epochs
+            std::fill(forwardStamp.begin(), forwardStamp.end(), 0u);
+            std::fill(backwardStamp.begin(), backwardStamp.end(), 0u);
+            epoch = 1;
+        }
+    }
+
+    // Expands one level of one side; returns the meeting vertex, or -1 if the searches did not meet
+    template <typename AdjGraph>
+    int expand(const AdjGraph& graph, std::vector<int>& frontier, std::vector<unsigned>& stamp,
+               std::vector<int>& edgeTo, const std::vector<unsigned>& otherStamp) {
+        next.clear();
+        for (const int v : frontier) {
+            for (const int w : graph.adj(v)) {
+                if (stamp[w] == epoch) continue;
+                stamp[w] = epoch;
+                edgeTo[w] = v;
+                ++verticesVisited_;
+                if (otherStamp[w] == epoch) return w;
+                next.push_back(w);
+            }
+        }
+        frontier.swap(next);
+        return -1;
+    }
+
+    // Runs a query and returns the vertex where the searches met, or -1 if t is unreachable
+    int search(const int s, const int t) {
+        validateVertex(s);
+        validateVertex(t);
+        nextEpoch();
+        verticesVisited_ = s == t ? 1 : 2;
+        if (s == t) return s;
+
+        forwardStamp[s] = epoch;
+        backwardStamp[t] = epoch;
+        forwardFrontier.assign(1, s);
+        backwardFrontier.assign(1, t);
+
+        while (!forwardFrontier.empty() && !backwardFrontier.empty()) {
+            const int meet = forwardFrontier.size() <= backwardFrontier.size()
+                ? expand(g, forwardFrontier, forwardStamp, forwardEdgeTo, backwardStamp)
+                : expand(reverse, backwardFrontier, backwardStamp, backwardEdgeTo, forwardStamp);
+            if (meet != -1) return meet;
+        }
+        return -1;
+    }
+
+public:
+    /**
+     * Binds the engine to a digraph, computing its reverse once.
+     *
+     * @param g the digraph
+     */
+    explicit BidirectionalBFS(const GraphType& g) :
+        BidirectionalBFS(g, std::make_unique<const ReverseType>(g.reverse())) {}
+
+    /**
+     * Binds the engine to a digraph and a precomputed reverse digraph.
+     *
+     * @param g the digraph
+     * @param reverse the reverse of g
+     * @throws std::invalid_argument if the vertex counts differ
+     */
+    BidirectionalBFS(const GraphType& g, const ReverseType& reverse) :
+        g(g),
+        reverse(reverse),
+        forwardStamp(g.V(), 0),
+        backwardStamp(g.V(), 0),
+        forwardEdgeTo(g.V()),
+        backwardEdgeTo(g.V()) {
+        if (reverse.V() != g.V()) {
+            throw std::invalid_argument("Reverse graph must have the same number of vertices");
+        }
+    }
+
+    BidirectionalBFS(const BidirectionalBFS&) = delete;
+    BidirectionalBFS& operator=(const BidirectionalBFS&) = delete;
+
+    // Is there a directed path from s to t?
+    bool hasPath(const int s, const int t) {
+        return search(s, t) != -1;
+    }
+
+    // Returns the number of edges on a shortest path from s to t (max int if there is none)
+    int distance(const int s, const int t) {
+        const int meet = search(s, t);
+        if (meet == -1) return std::numeric_limits<int>::max();
+
+        int length = 0;
+        for (int x = meet; x != s; x = forwardEdgeTo[x]) ++length;
+        for (int x = meet; x != t; x = backwardEdgeTo[x]) ++length;
+        return length;
+    }
+
+    // Returns a shortest directed path from s to t (empty if there is none)
+    std::vector<int> path(const int s, const int t) {
+        const int meet = search(s, t);
+        if (meet == -1) return std::vector<int>{};
+
+        std::vector<int> result;
+        for (int x = meet; x != s; x = forwardEdgeTo[x]) {
+            result.push_back(x);
+        }
+        result.push_back(s);
+        std::reverse(result.begin(), result.end());
+        for (int x = meet; x != t; x = backwardEdgeTo[x]) {
+            result.push_back(backwardEdgeTo[x]);
+        }
+        return result;
+    }
+
+    // Number of vertices reached by the last query (both directions together)
+    int verticesVisited() const { return verticesVisited_; }
+
+private:
+    BidirectionalBFS(const GraphType& g, std::unique_ptr<const ReverseType> owned) :
+        BidirectionalBFS(g, *owned) {
+        ownedReverse = std::move(owned);
+    }
+};
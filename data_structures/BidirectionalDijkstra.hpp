@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "IndexMinPQ.hpp"
+
+/**
+ * Point-to-point shortest path engine for edge-weighted digraphs with
+ * non-negative weights, using bidirectional Dijkstra search.
+ *
+ * Each query runs a forward Dijkstra search from s on the digraph and a
+ * backward search from t on its reverse, always advancing the side whose
+ * next vertex is closer. Whenever an edge relaxation reaches a vertex
+ * labeled by the other side, the combined length is a candidate mu for the
+ * shortest path. The search stops once the smallest keys of the two queues
+ * add up to at least mu, since no undiscovered path can be shorter. On
+ * road-like graphs the two searches together settle far fewer vertices than
+ * a single search from s.
+ *
+ * Like DijkstraQuery, the engine is bound to one digraph, validates weights
+ * once and resets only the vertices touched by the previous query. The
+ * digraph (and the reverse, if passed in) must outlive the engine and must
+ * not change while bound; one engine must not be shared between threads.
+ *
+ * Time complexity: O(V + E) to bind; O((V' + E') log V') per query over the explored region
+ * Space complexity: O(V)
+ */
+template <typename GraphType = EdgeWeightedDigraph,
+          typename ReverseType = decltype(std::declval<const GraphType&>().reverse())>
+class BidirectionalDijkstra {
+    // Search state for one direction
+    struct Side {
+        std::vector<std::optional<DirectedEdge>> edgeTo;  // last edge on the shortest known path to v
+        std::vector<double> distTo;                       // distance of the shortest known path to v
+        IndexMinPQ<double> pq;
+        std::vector<int> touched;                         // vertices whose distTo was set by the last query
+
+        explicit Side(const int V) :
+            edgeTo(V),
+            distTo(V, std::numeric_limits<double>::max()),
+            pq(V) {}
+
+        void reset() {
+            for (const int v : touched) {
+                distTo[v] = std::numeric_limits<double>::max();
+                edgeTo[v].reset();
+            }
+            touched.clear();
+            pq.clear();
+        }
+
+        void start(const int v) {
+            distTo[v] = 0.0;
+            touched.push_back(v);
+            pq.insert(v, 0.0);
+        }
+    };
+
+    const GraphType& g;
+    std::unique_ptr<const ReverseType> ownedReverse;  // set if the engine computed the reverse itself
+    const ReverseType& reverse;
+    Side forward;
+    Side backward;
+    double best = std::numeric_limits<double>::max();  // length of the shortest path found so far (mu)
+    int meet = -1;                                     // vertex where that path crosses between the sides
+    int source = -1;                                   // source of the last query (-1 before the first)
+    int target = -1;                                   // target of the last query
+    int settled = 0;                                   // vertices settled by the last query (both sides)
+
+    void validateVertex(const int v) const {
+        const int V = g.V();
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    // Settles the minimum vertex of one side and relaxes its edges
+    template <typename AdjGraph>
+    void step(const AdjGraph& graph, Side& side, const Side& other) {
+        const int v = side.pq.removeMin();
+        ++settled;
+
+        for (const auto& e : graph.adj(v)) {
+            const int w = e.to();
+            const double candidate = side.distTo[v] + e.weight();
+            if (side.distTo[w] > candidate) {
+                if (side.distTo[w] == std::numeric_limits<double>::max()) side.touched.push_back(w);
+                side.distTo[w] = candidate;
+                side.edgeTo[w] = e;
+                if (side.pq.contains(w)) {
+                    side.pq.decreaseKey(w, candidate);
+                } else {
+                    side.pq.insert(w, candidate);
+                }
+
+                if (other.distTo[w] < std::numeric_limits<double>::max() && candidate + other.distTo[w] < best) {
+                    best = candidate + other.distTo[w];
+                    meet = w;
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * Binds the engine to an edge-weighted digraph, computing its reverse once.
+     *
+     * @param g the edge-weighted digraph
+     * @throws std::invalid_argument if any edge has negative weight
+     */
+    explicit BidirectionalDijkstra(const GraphType& g) :
+        BidirectionalDijkstra(g, std::make_unique<const ReverseType>(g.reverse())) {}
+
+    /**
+     * Binds the engine to an edge-weighted digraph and a precomputed reverse.
+     *
+     * @param g the edge-weighted digraph
+     * @param reverse the reverse of g
+     * @throws std::invalid_argument if any edge has negative weight or the vertex counts differ
+     */
+    BidirectionalDijkstra(const GraphType& g, const ReverseType& reverse) :
+        g(g),
+        reverse(reverse),
+        forward(g.V()),
+        backward(g.V()) {
+
+        if (reverse.V() != g.V()) {
+            throw std::invalid_argument("Reverse graph must have the same number of vertices");
+        }
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+            }
+        }
+    }
+
+    BidirectionalDijkstra(const BidirectionalDijkstra&) = delete;
+    BidirectionalDijkstra& operator=(const BidirectionalDijkstra&) = delete;
+
+    /**
+     * Computes the shortest path from s to t.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double query(const int s, const int t) {
+        validateVertex(s);
+        validateVertex(t);
+        forward.reset();
+        backward.reset();
+        source = s;
+        target = t;
+        settled = 0;
+        best = std::numeric_limits<double>::max();
+        meet = -1;
+
+        forward.start(s);
+        if (s == t) {
+            best = 0.0;
+            meet = s;
+            return best;
+        }
+        backward.start(t);
+
+        while (!forward.pq.empty() && !backward.pq.empty()) {
+            const double forwardMin = forward.pq.minKey();
+            const double backwardMin = backward.pq.minKey();
+            if (forwardMin + backwardMin >= best) break;
+
+            if (forwardMin <= backwardMin) {
+                step(g, forward, backward);
+            } else {
+                step(reverse, backward, forward);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Returns true if the last query found a path.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    bool hasPath() const {
+        if (target == -1) throw std::logic_error("No query has been run");
+        return meet != -1;
+    }
+
+    /**
+     * Returns the shortest path found by the last query as a sequence of
+     * directed edges of the original digraph, or an empty vector if there is none.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    std::vector<DirectedEdge> path() const {
+        if (!hasPath()) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> result;
+        for (std::optional<DirectedEdge> e = forward.edgeTo[meet]; e.has_value(); e = forward.edgeTo[e->from()]) {
+            result.push_back(*e);
+        }
+        std::reverse(result.begin(), result.end());
+
+        // Backward edges point toward the meeting vertex in the reverse digraph; flip them back
+        for (std::optional<DirectedEdge> e = backward.edgeTo[meet]; e.has_value(); e = backward.edgeTo[e->from()]) {
+            result.emplace_back(e->to(), e->from(), e->weight());
+        }
+        return result;
+    }
+
+    // Number of vertices settled by the last query, counting both directions
+    int settledCount() const { return settled; }
+
+    // Number of vertices labeled by the last query, counting both directions
+    int touchedCount() const { return static_cast<int>(forward.touched.size() + backward.touched.size()); }
+
+    // Number of vertices in the bound digraph
+    int V() const { return g.V(); }
+
+private:
+    BidirectionalDijkstra(const GraphType& g, std::unique_ptr<const ReverseType> owned) :
+        BidirectionalDijkstra(g, *owned) {
+        ownedReverse = std::move(owned);
+    }
+};
@@ -18,7 +18,8 @@ private:
     std::vector<int> cycle;      // odd cycle (empty if graph is bipartite)
 
     // DFS to check bipartiteness and find odd cycle
-    void dfs(const Graph& g, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         marked[v] = true;
         for (const int w : g.adj(v)) {
             // If odd cycle already found, stop searching
@@ -43,7 +44,8 @@ private:
     }
 
     // Check invariants for correctness
-    bool check(const Graph& g) {
+    template <typename GraphType>
+    bool check(const GraphType& g) {
         if (isBipartite_) {
             // If bipartite, no edge should connect same-colored vertices
             for (int v = 0; v < g.V(); ++v) {
@@ -87,7 +89,8 @@ private:
 
 public:
     // Constructor: determine if graph is bipartite
-    explicit Bipartite(const Graph& g) :
+    template <typename GraphType>
+    explicit Bipartite(const GraphType& g) :
         isBipartite_(true),
         color_(g.V(), false),
         marked(g.V(), false),
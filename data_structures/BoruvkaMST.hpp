@@ -120,8 +120,10 @@ class BoruvkaMST {
 
 public:
     // Constructor: compute MST using Borůvka's algorithm
-    explicit BoruvkaMST(const EdgeWeightedGraph& g) : weight_(0.0) {
+    template <typename GraphType>
+    explicit BoruvkaMST(const GraphType& g) : weight_(0.0) {
         WeightedQuickUnionPathCompressionUF uf(g.V());
+        const std::vector<Edge> allEdges = g.edges();  // built once rather than every iteration
 
         // Main loop: continue until we have a spanning forest
         // In each iteration, the number of components at least halves
@@ -131,7 +133,7 @@ public:
             std::vector<std::optional<Edge>> closest(g.V(), std::nullopt);
 
             // Examine all edges to find cheapest outgoing edge for each component
-            for (const Edge& e : g.edges()) {
+            for (const Edge& e : allEdges) {
                 const int v = e.either();
                 const int w = e.other(v);
                 const int i = uf.find(v);  // Component containing v
@@ -19,7 +19,8 @@ class BreadthFirstDirectedPaths {
     const int source;           // source vertex
 
     // BFS traversal starting from vertex s
-    void bfs(const Digraph& g, const int s) {
+    template <typename GraphType>
+    void bfs(const GraphType& g, const int s) {
         std::queue<int> q;
         marked[s] = true;
         distTo_[s] = 0;
@@ -50,7 +51,8 @@ class BreadthFirstDirectedPaths {
 
 public:
     // Constructor: find shortest directed paths from source vertex s using BFS
-    BreadthFirstDirectedPaths(const Digraph& g, const int s) :
+    template <typename GraphType>
+    BreadthFirstDirectedPaths(const GraphType& g, const int s) :
         marked(g.V(), false),
         edgeTo(g.V()),
         distTo_(g.V(), std::numeric_limits<int>::max()),
@@ -16,7 +16,8 @@ class BreadthFirstPaths {
     const int s;                // source vertex
 
     // BFS traversal starting from vertex v
-    void bfs(const Graph& g, const int v) {
+    template <typename GraphType>
+    void bfs(const GraphType& g, const int v) {
         std::queue<int> queue;
         distTo_[v] = 0;
         marked[v] = true;
@@ -44,7 +45,8 @@ class BreadthFirstPaths {
     }
 
     // Check invariants for debugging (fixed bugs in original)
-    bool check(const Graph& g, const int s) const {
+    template <typename GraphType>
+    bool check(const GraphType& g, const int s) const {
         // Source should have distance 0
         if (distTo(s) != 0) return false;
 
@@ -67,7 +69,8 @@ class BreadthFirstPaths {
 
 public:
     // Constructor: find the shortest paths from source vertex s using BFS
-    BreadthFirstPaths(const Graph& g, const int s) :
+    template <typename GraphType>
+    BreadthFirstPaths(const GraphType& g, const int s) :
         marked(g.V(), false),
         edgeTo(g.V()),
         distTo_(g.V(), std::numeric_limits<int>::max()),
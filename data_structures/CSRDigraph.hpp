@@ -0,0 +1,179 @@
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AdjacencyView.hpp"
+#include "Digraph.hpp"
+
+/**
+ * Immutable directed graph stored in compressed sparse row (CSR) form.
+ *
+ * The out-neighbors of vertex v are stored contiguously in
+ * targets_[offsets_[v] .. offsets_[v + 1]), so a traversal reads adjacency
+ * data sequentially instead of chasing one heap node per edge as the
+ * list-based Digraph does.
+ *
+ * Neighbors are kept in the same order that Digraph::adj reports them (most
+ * recently added edge first), so every traversal produces identical results
+ * on a CSRDigraph and on the Digraph it was built from.
+ *
+ * Any algorithm that accepts a Digraph through a templated constructor
+ * (DepthFirstOrder, Topological, KosarajuSharirSCC, ...) also accepts a
+ * CSRDigraph.
+ *
+ * Time complexities:
+ * - Construction: O(V + E)
+ * - Get adjacent vertices: O(1) (returns a view, no copy)
+ * - Reverse: O(V + E)
+ *
+ * Space complexity: O(V + E) with two int arrays and no per-edge allocations
+ */
+class CSRDigraph {
+    int V_;                      // number of vertices
+    int E_;                      // number of edges
+    std::vector<int> offsets_;   // offsets_[v] = index in targets_ of v's first neighbor (size V + 1)
+    std::vector<int> targets_;   // concatenated adjacency lists (size E)
+    std::vector<int> indegree_;  // indegree_[v] = number of edges pointing to v
+
+    // Validates that vertex is in valid range [0, V)
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    static int validateVertexCount(const int v) {
+        if (v < 0) throw std::invalid_argument("Number of vertices must be non-negative");
+        return v;
+    }
+
+    // Turns per-vertex counts stored in offsets_[1..V] into prefix sums
+    void prefixSums() {
+        for (int v = 0; v < V_; ++v) {
+            offsets_[v + 1] += offsets_[v];
+        }
+    }
+
+public:
+    /**
+     * Builds a CSR copy of a list-based digraph.
+     *
+     * @param g the digraph to copy
+     */
+    explicit CSRDigraph(const Digraph& g) :
+        V_(g.V()),
+        E_(g.E()),
+        offsets_(g.V() + 1, 0),
+        targets_(g.E()),
+        indegree_(g.V(), 0) {
+
+        for (int v = 0; v < V_; ++v) {
+            offsets_[v + 1] = offsets_[v] + g.outdegree(v);
+            indegree_[v] = g.indegree(v);
+        }
+
+        int i = 0;
+        for (int v = 0; v < V_; ++v) {
+            for (const int w : g.adj(v)) {
+                targets_[i++] = w;
+            }
+        }
+    }
+
+    /**
+     * Builds a digraph directly from an edge list using a counting pass
+     * followed by a fill pass; no intermediate Digraph is created.
+     *
+     * The result is identical to adding the edges to a Digraph in order.
+     *
+     * @param v the number of vertices
+     * @param edges directed edges as (from, to) pairs
+     * @throws std::invalid_argument if v is negative or an endpoint is out of range
+     */
+    CSRDigraph(const int v, const std::vector<std::pair<int, int>>& edges) :
+        V_(validateVertexCount(v)),
+        E_(static_cast<int>(edges.size())),
+        offsets_(v + 1, 0),
+        targets_(edges.size()),
+        indegree_(v, 0) {
+
+        for (const auto& [from, to] : edges) {
+            validateVertex(from);
+            validateVertex(to);
+            ++offsets_[from + 1];
+            ++indegree_[to];
+        }
+        prefixSums();
+
+        // Fill each bucket from the back so later edges come first, as in Digraph
+        std::vector<int> next(offsets_.begin() + 1, offsets_.end());
+        for (const auto& [from, to] : edges) {
+            targets_[--next[from]] = to;
+        }
+    }
+
+    // Returns number of vertices
+    int V() const { return V_; }
+
+    // Returns number of edges
+    int E() const { return E_; }
+
+    // Returns a view over the vertices adjacent from vertex v
+    AdjacencyView<const int*> adj(const int v) const {
+        validateVertex(v);
+        const int* first = targets_.data() + offsets_[v];
+        const int* last = targets_.data() + offsets_[v + 1];
+        return AdjacencyView<const int*>(first, last, static_cast<std::size_t>(last - first));
+    }
+
+    // Returns out-degree of vertex v
+    int outdegree(const int v) const {
+        validateVertex(v);
+        return offsets_[v + 1] - offsets_[v];
+    }
+
+    // Returns in-degree of vertex v
+    int indegree(const int v) const {
+        validateVertex(v);
+        return indegree_[v];
+    }
+
+    // Returns reverse digraph, with the same neighbor order as Digraph::reverse
+    CSRDigraph reverse() const {
+        CSRDigraph rev(*this);  // same V and E; every array is overwritten below
+        rev.offsets_[0] = 0;
+        for (int v = 0; v < V_; ++v) {
+            rev.offsets_[v + 1] = indegree_[v];
+            rev.indegree_[v] = offsets_[v + 1] - offsets_[v];
+        }
+        rev.prefixSums();
+
+        std::vector<int> next(rev.offsets_.begin() + 1, rev.offsets_.end());
+        for (int v = 0; v < V_; ++v) {
+            for (int i = offsets_[v]; i < offsets_[v + 1]; ++i) {
+                rev.targets_[--next[targets_[i]]] = v;
+            }
+        }
+        return rev;
+    }
+
+    // Stream output operator
+    friend std::ostream& operator<<(std::ostream& os, const CSRDigraph& graph) {
+        os << "Number of Vertices: " << graph.V() << '\n';
+        os << "Number of Edges: " << graph.E() << '\n';
+
+        for (int v = 0; v < graph.V(); ++v) {
+            os << "V: " << v << "\tE: ";
+            for (const int neighbor : graph.adj(v)) {
+                os << neighbor << ' ';
+            }
+            os << '\n';
+        }
+        return os;
+    }
+};
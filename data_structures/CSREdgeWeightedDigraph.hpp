@@ -0,0 +1,147 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "AdjacencyView.hpp"
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+
+/**
+ * Immutable edge-weighted digraph stored in compressed sparse row (CSR) form.
+ *
+ * The edges leaving vertex v are stored contiguously in
+ * edges_[offsets_[v] .. offsets_[v + 1]), so storage is sized exactly to
+ * V + 1 offsets and E edges with no per-edge heap nodes.
+ *
+ * Edges are kept in the same order that EdgeWeightedDigraph::adj reports them
+ * (most recently added edge first), so DijkstraSP and the other shortest path
+ * classes produce identical results on either representation.
+ *
+ * Time complexities:
+ * - Construction: O(V + E)
+ * - Get adjacent edges: O(1) (returns a view, no copy)
+ * - Get all edges: O(E)
+ *
+ * Space complexity: O(V + E)
+ */
+class CSREdgeWeightedDigraph {
+    int V_;                           // number of vertices
+    int E_;                           // number of edges
+    std::vector<int> offsets_;        // offsets_[v] = index in edges_ of v's first edge (size V + 1)
+    std::vector<DirectedEdge> edges_; // concatenated adjacency lists (size E)
+    std::vector<int> indegree_;       // indegree_[v] = number of edges pointing to v
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    static int validateVertexCount(const int v) {
+        if (v < 0) {
+            throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(v));
+        }
+        return v;
+    }
+
+public:
+    /**
+     * Builds a CSR copy of a list-based edge-weighted digraph.
+     *
+     * @param g the digraph to copy
+     */
+    explicit CSREdgeWeightedDigraph(const EdgeWeightedDigraph& g) :
+        V_(g.V()),
+        E_(g.E()),
+        offsets_(g.V() + 1, 0),
+        indegree_(g.V(), 0) {
+
+        edges_.reserve(E_);
+        for (int v = 0; v < V_; ++v) {
+            offsets_[v + 1] = offsets_[v] + g.outdegree(v);
+            indegree_[v] = g.indegree(v);
+            for (const DirectedEdge& e : g.adj(v)) {
+                edges_.push_back(e);
+            }
+        }
+    }
+
+    /**
+     * Builds a digraph directly from an edge list using a counting pass
+     * followed by a fill pass. The result is identical to adding the edges
+     * to an EdgeWeightedDigraph in order.
+     *
+     * @param v the number of vertices
+     * @param edges the directed edges
+     * @throws std::invalid_argument if v is negative or an endpoint is out of range
+     */
+    CSREdgeWeightedDigraph(const int v, const std::vector<DirectedEdge>& edges) :
+        V_(validateVertexCount(v)),
+        E_(static_cast<int>(edges.size())),
+        offsets_(v + 1, 0),
+        edges_(edges.size(), DirectedEdge(0, 0, 0.0)),
+        indegree_(v, 0) {
+
+        for (const DirectedEdge& e : edges) {
+            validateVertex(e.from());
+            validateVertex(e.to());
+            ++offsets_[e.from() + 1];
+            ++indegree_[e.to()];
+        }
+        for (int x = 0; x < V_; ++x) {
+            offsets_[x + 1] += offsets_[x];
+        }
+
+        // Fill each bucket from the back so later edges come first, as in EdgeWeightedDigraph
+        std::vector<int> next(offsets_.begin() + 1, offsets_.end());
+        for (const DirectedEdge& e : edges) {
+            edges_[--next[e.from()]] = e;
+        }
+    }
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    /**
+     * Returns the directed edges incident from vertex v.
+     *
+     * @param v the vertex
+     * @return a view of the directed edges leaving v
+     * @throws std::invalid_argument if vertex is invalid
+     */
+    AdjacencyView<const DirectedEdge*> adj(const int v) const {
+        validateVertex(v);
+        const DirectedEdge* first = edges_.data() + offsets_[v];
+        const DirectedEdge* last = edges_.data() + offsets_[v + 1];
+        return AdjacencyView<const DirectedEdge*>(first, last, static_cast<std::size_t>(last - first));
+    }
+
+    int outdegree(const int v) const {
+        validateVertex(v);
+        return offsets_[v + 1] - offsets_[v];
+    }
+
+    int indegree(const int v) const {
+        validateVertex(v);
+        return indegree_[v];
+    }
+
+    // Returns all directed edges in the same order as EdgeWeightedDigraph::edges
+    std::vector<DirectedEdge> edges() const {
+        return edges_;
+    }
+
+    // Returns the reverse digraph, with the same edge order as EdgeWeightedDigraph::reverse
+    CSREdgeWeightedDigraph reverse() const {
+        std::vector<DirectedEdge> reversed;
+        reversed.reserve(E_);
+        for (const DirectedEdge& e : edges_) {
+            reversed.emplace_back(e.to(), e.from(), e.weight());
+        }
+        return CSREdgeWeightedDigraph(V_, reversed);
+    }
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "AdjacencyView.hpp"
+#include "Edge.hpp"
+#include "EdgeWeightedGraph.hpp"
+
+/**
+ * Immutable edge-weighted undirected graph stored in compressed sparse row
+ * (CSR) form.
+ *
+ * The edges incident to vertex v are stored contiguously in
+ * edges_[offsets_[v] .. offsets_[v + 1]). As in EdgeWeightedGraph, every edge
+ * v-w appears in both endpoints' lists and a self-loop appears once in its
+ * vertex's list, so the edge array holds up to 2E edges and no per-edge heap
+ * nodes.
+ *
+ * Edges are kept in the same order that EdgeWeightedGraph::adj reports them
+ * (most recently added edge first), so PrimMST, DijkstraUndirectedSP and the
+ * other weighted graph classes produce identical results on either
+ * representation.
+ *
+ * Time complexities:
+ * - Construction: O(V + E)
+ * - Get adjacent edges: O(1) (returns a view, no copy)
+ * - Get all edges: O(V + E)
+ *
+ * Space complexity: O(V + E)
+ */
+class CSREdgeWeightedGraph {
+    int V_;                     // number of vertices
+    int E_;                     // number of edges
+    std::vector<int> offsets_;  // offsets_[v] = index in edges_ of v's first edge (size V + 1)
+    std::vector<Edge> edges_;   // concatenated adjacency lists
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    static int validateVertexCount(const int v) {
+        if (v < 0) {
+            throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(v));
+        }
+        return v;
+    }
+
+public:
+    /**
+     * Builds a CSR copy of a list-based edge-weighted graph.
+     *
+     * @param g the graph to copy
+     */
+    explicit CSREdgeWeightedGraph(const EdgeWeightedGraph& g) :
+        V_(g.V()),
+        E_(g.E()),
+        offsets_(g.V() + 1, 0) {
+
+        for (int v = 0; v < V_; ++v) {
+            offsets_[v + 1] = offsets_[v] + g.degree(v);
+        }
+        edges_.reserve(offsets_[V_]);
+        for (int v = 0; v < V_; ++v) {
+            for (const Edge& e : g.adj(v)) {
+                edges_.push_back(e);
+            }
+        }
+    }
+
+    /**
+     * Builds a graph directly from an edge list using a counting pass
+     * followed by a fill pass. The result is identical to adding the edges
+     * to an EdgeWeightedGraph in order.
+     *
+     * @param v the number of vertices
+     * @param edges the undirected edges
+     * @throws std::invalid_argument if v is negative or an endpoint is out of range
+     */
+    CSREdgeWeightedGraph(const int v, const std::vector<Edge>& edges) :
+        V_(validateVertexCount(v)),
+        E_(static_cast<int>(edges.size())),
+        offsets_(v + 1, 0) {
+
+        for (const Edge& e : edges) {
+            const int x = e.either(), y = e.other(x);
+            validateVertex(x);
+            validateVertex(y);
+            ++offsets_[x + 1];
+            if (x != y) ++offsets_[y + 1];
+        }
+        for (int x = 0; x < V_; ++x) {
+            offsets_[x + 1] += offsets_[x];
+        }
+
+        // Fill each bucket from the back so later edges come first, as in EdgeWeightedGraph
+        edges_.assign(offsets_[V_], Edge(0, 0, 0.0));
+        std::vector<int> next(offsets_.begin() + 1, offsets_.end());
+        for (const Edge& e : edges) {
+            const int x = e.either(), y = e.other(x);
+            edges_[--next[x]] = e;
+            if (x != y) edges_[--next[y]] = e;
+        }
+    }
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    /**
+     * Returns the edges incident to vertex v.
+     *
+     * @param v the vertex
+     * @return a view of the edges incident to v
+     * @throws std::invalid_argument if vertex is invalid
+     */
+    AdjacencyView<const Edge*> adj(const int v) const {
+        validateVertex(v);
+        const Edge* first = edges_.data() + offsets_[v];
+        const Edge* last = edges_.data() + offsets_[v + 1];
+        return AdjacencyView<const Edge*>(first, last, static_cast<std::size_t>(last - first));
+    }
+
+    int degree(const int v) const {
+        validateVertex(v);
+        return offsets_[v + 1] - offsets_[v];
+    }
+
+    // Returns all edges in the same order as EdgeWeightedGraph::edges
+    std::vector<Edge> edges() const {
+        std::vector<Edge> result;
+        result.reserve(E_);
+        for (int v = 0; v < V_; ++v) {
+            for (int k = offsets_[v]; k < offsets_[v + 1]; ++k) {
+                if (edges_[k].other(v) >= v) result.push_back(edges_[k]);
+            }
+        }
+        return result;
+    }
+};
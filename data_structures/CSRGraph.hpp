@@ -0,0 +1,137 @@
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AdjacencyView.hpp"
+#include "Graph.hpp"
+
+/**
+ * Immutable undirected graph stored in compressed sparse row (CSR) form.
+ *
+ * The neighbors of vertex v are stored contiguously in
+ * targets_[offsets_[v] .. offsets_[v + 1]). As in Graph, every edge v-w
+ * appears twice (once in each endpoint's list) and a self-loop appears twice
+ * in its vertex's list.
+ *
+ * Neighbors are kept in the same order that Graph::adj reports them, so every
+ * traversal produces identical results on a CSRGraph and on the Graph it was
+ * built from. Algorithms such as DepthFirstPaths, BreadthFirstPaths and
+ * ConnectedComponents accept either representation.
+ *
+ * Time complexities:
+ * - Construction: O(V + E)
+ * - Get adjacent vertices: O(1) (returns a view, no copy)
+ *
+ * Space complexity: O(V + E) with two int arrays and no per-edge allocations
+ */
+class CSRGraph {
+    int V_;                     // number of vertices
+    int E_;                     // number of edges
+    std::vector<int> offsets_;  // offsets_[v] = index in targets_ of v's first neighbor (size V + 1)
+    std::vector<int> targets_;  // concatenated adjacency lists (size 2E)
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_ - 1) + "]");
+        }
+    }
+
+    static int validateVertexCount(const int v) {
+        if (v < 0) throw std::invalid_argument("Number of vertices must be non-negative");
+        return v;
+    }
+
+public:
+    /**
+     * Builds a CSR copy of a list-based graph.
+     *
+     * @param g the graph to copy
+     */
+    explicit CSRGraph(const Graph& g) :
+        V_(g.V()),
+        E_(g.E()),
+        offsets_(g.V() + 1, 0),
+        targets_(2 * static_cast<std::size_t>(g.E())) {
+
+        for (int v = 0; v < V_; ++v) {
+            offsets_[v + 1] = offsets_[v] + g.degree(v);
+        }
+
+        int i = 0;
+        for (int v = 0; v < V_; ++v) {
+            for (const int w : g.adj(v)) {
+                targets_[i++] = w;
+            }
+        }
+    }
+
+    /**
+     * Builds a graph directly from an edge list using a counting pass
+     * followed by a fill pass; no intermediate Graph is created.
+     *
+     * The result is identical to adding the edges to a Graph in order.
+     *
+     * @param v the number of vertices
+     * @param edges undirected edges as (v, w) pairs
+     * @throws std::invalid_argument if v is negative or an endpoint is out of range
+     */
+    CSRGraph(const int v, const std::vector<std::pair<int, int>>& edges) :
+        V_(validateVertexCount(v)),
+        E_(static_cast<int>(edges.size())),
+        offsets_(v + 1, 0),
+        targets_(2 * edges.size()) {
+
+        for (const auto& [a, b] : edges) {
+            validateVertex(a);
+            validateVertex(b);
+            ++offsets_[a + 1];
+            ++offsets_[b + 1];
+        }
+        for (int x = 0; x < V_; ++x) {
+            offsets_[x + 1] += offsets_[x];
+        }
+
+        // Fill each bucket from the back so later edges come first, as in Graph
+        std::vector<int> next(offsets_.begin() + 1, offsets_.end());
+        for (const auto& [a, b] : edges) {
+            targets_[--next[a]] = b;
+            targets_[--next[b]] = a;
+        }
+    }
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    // Returns a view over the vertices adjacent to vertex v
+    AdjacencyView<const int*> adj(const int v) const {
+        validateVertex(v);
+        const int* first = targets_.data() + offsets_[v];
+        const int* last = targets_.data() + offsets_[v + 1];
+        return AdjacencyView<const int*>(first, last, static_cast<std::size_t>(last - first));
+    }
+
+    int degree(const int v) const {
+        validateVertex(v);
+        return offsets_[v + 1] - offsets_[v];
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const CSRGraph& graph) {
+        os << "Number of Vertices: " << graph.V() << '\n';
+        os << "Number of Edges: " << graph.E() << '\n';
+
+        for (int v = 0; v < graph.V(); ++v) {
+            os << "V: " << v << "\tE: ";
+            for (const int neighbor : graph.adj(v)) {
+                os << neighbor << ' ';
+            }
+            os << '\n';
+        }
+        return os;
+    }
+};
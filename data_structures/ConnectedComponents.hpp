@@ -12,7 +12,8 @@ class ConnectedComponents {
     int count_;                 // number of connected components
 
     // DFS to mark all vertices in the same component
-    void dfs(const Graph& g, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         marked[v] = true;
         id_[v] = count_;
         ++size_[count_];
@@ -33,7 +34,8 @@ class ConnectedComponents {
 
 public:
     // Constructor: find all connected components in graph g
-    explicit ConnectedComponents(const Graph& g) :
+    template <typename GraphType>
+    explicit ConnectedComponents(const GraphType& g) :
         marked(g.V(), false),
         id_(g.V()),
         size_(g.V(), 0),
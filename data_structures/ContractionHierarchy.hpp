@@ -0,0 +1,448 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "IndexMinPQ.hpp"
+
+/**
+ * Contraction Hierarchies: preprocessing and point-to-point shortest path
+ * queries for edge-weighted digraphs with non-negative weights.
+ *
+ * Preprocessing contracts the vertices one at a time in order of importance.
+ * Contracting v removes it from the remaining graph; for every pair of
+ * remaining arcs u -> v -> x a shortcut u -> x of the same length is added,
+ * unless a witness search (a bounded Dijkstra from u that avoids v) finds a
+ * path from u to x that is no longer. The next vertex to contract is the
+ * one with the smallest priority
+ *     edge difference (shortcuts added - arcs removed) + contracted neighbors,
+ * kept in an IndexMinPQ and updated for the neighbors of each contracted
+ * vertex. The second term spreads contraction evenly over the graph.
+ *
+ * Each vertex's rank is its position in the contraction order. Every arc
+ * (original or shortcut) leads either up or down in rank and is stored in
+ * one of two compact CSR search graphs: the upward graph holds arcs v -> x
+ * with rank(x) > rank(v), and the downward graph holds, for each v, the arcs
+ * u -> v with rank(u) > rank(v). A query runs a bidirectional Dijkstra
+ * search that only climbs: forward from s in the upward graph and backward
+ * from t in the downward graph. Each side stops once its smallest key is at
+ * least the best meeting distance. Both searches explore only a small
+ * "upward cone", so queries settle orders of magnitude fewer vertices than
+ * Dijkstra. Shortcuts remember the two arcs they replace, so paths are
+ * unpacked into the original DirectedEdges.
+ *
+ * Parallel edges are reduced to the lightest one and self-loops are
+ * ignored, as neither can be part of a shortest path.
+ *
+ * Queries reuse internal scratch arrays, resetting only the vertices the
+ * previous query touched, so one hierarchy must not be queried from several
+ * threads at once.
+ *
+ * Time complexity: preprocessing depends on the graph (near-linear on road networks);
+ *                  queries O((V' + E') log V') over the explored upward cones
+ * Space complexity: O(V + E + shortcuts)
+ */
+class ContractionHierarchy {
+    static constexpr int WITNESS_SETTLE_LIMIT = 500;  // vertices a witness search may settle
+
+    // An arc of the hierarchy: an original edge, or a shortcut replacing arcs first and second
+    struct Arc {
+        int from;
+        int to;
+        double weight;
+        int first;   // arc from -> middle, or -1 for an original edge
+        int second;  // arc middle -> to, or -1 for an original edge
+    };
+
+    // Entry of a search graph: the arc leading to (or from) head
+    struct SearchArc {
+        int head;
+        double weight;
+        int arc;
+    };
+
+    // Search state for one query direction
+    struct Side {
+        std::vector<double> distTo;
+        std::vector<int> arcTo;     // arc through which v was last reached, or -1
+        IndexMinPQ<double> pq;
+        std::vector<int> touched;
+
+        explicit Side(const int V) :
+            distTo(V, std::numeric_limits<double>::max()),
+            arcTo(V, -1),
+            pq(V) {}
+
+        void reset() {
+            for (const int v : touched) {
+                distTo[v] = std::numeric_limits<double>::max();
+                arcTo[v] = -1;
+            }
+            touched.clear();
+            pq.clear();
+        }
+    };
+
+    int V_;
+    std::vector<Arc> arcs;             // every arc ever created (replaced arcs are kept for unpacking)
+    std::vector<int> rank_;            // rank_[v] = position of v in the contraction order
+    int shortcuts_ = 0;                // number of shortcuts in the search graphs
+    std::vector<int> upOffsets;        // upward search graph in CSR form
+    std::vector<SearchArc> upArcs;
+    std::vector<int> downOffsets;      // downward search graph, stored at the lower endpoint
+    std::vector<SearchArc> downArcs;
+
+    Side forward;
+    Side backward;
+    double best = std::numeric_limits<double>::max();
+    int meet = -1;
+    int target = -1;
+    int settled = 0;
+
+    // Remaining graph during preprocessing: arc ids leaving / entering each uncontracted vertex
+    struct Overlay {
+        std::vector<std::vector<int>> out;
+        std::vector<std::vector<int>> in;
+        std::vector<int> contractedNeighbors;
+
+        // Witness search scratch
+        std::vector<bool> isTarget;
+        std::vector<double> distTo;
+        IndexMinPQ<double> pq;
+        std::vector<int> touched;
+
+        explicit Overlay(const int V) :
+            out(V),
+            in(V),
+            contractedNeighbors(V, 0),
+            isTarget(V, false),
+            distTo(V, std::numeric_limits<double>::max()),
+            pq(V) {}
+    };
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    // Adds arc u -> x to the overlay, or lowers the existing one if the new arc is lighter
+    void addArc(Overlay& overlay, const int from, const int to, const double weight, const int first, const int second) {
+        for (int& id : overlay.out[from]) {
+            if (arcs[id].to != to) continue;
+            if (weight < arcs[id].weight) {
+                const int replaced = id;
+                arcs.push_back({from, to, weight, first, second});
+                id = static_cast<int>(arcs.size()) - 1;
+                std::replace(overlay.in[to].begin(), overlay.in[to].end(), replaced, id);
+            }
+            return;
+        }
+        arcs.push_back({from, to, weight, first, second});
+        overlay.out[from].push_back(static_cast<int>(arcs.size()) - 1);
+        overlay.in[to].push_back(static_cast<int>(arcs.size()) - 1);
+    }
+
+    // Bounded Dijkstra from source in the overlay, avoiding vertex skip; stops early once
+    // the given number of target vertices (other than source) are settled
+    void witnessSearch(Overlay& overlay, const int source, const int skip, const double maxDist, int targets) {
+        for (const int v : overlay.touched) overlay.distTo[v] = std::numeric_limits<double>::max();
+        overlay.touched.clear();
+        overlay.pq.clear();
+
+        overlay.distTo[source] = 0.0;
+        overlay.touched.push_back(source);
+        overlay.pq.insert(source, 0.0);
+
+        for (int count = 0; !overlay.pq.empty() && count < WITNESS_SETTLE_LIMIT; ++count) {
+            if (overlay.pq.minKey() > maxDist) break;
+            const int v = overlay.pq.removeMin();
+            if (v != source && overlay.isTarget[v] && --targets == 0) break;
+            for (const int id : overlay.out[v]) {
+                const Arc& a = arcs[id];
+                if (a.to == skip) continue;
+                const double candidate = overlay.distTo[v] + a.weight;
+                if (candidate < overlay.distTo[a.to]) {
+                    if (overlay.distTo[a.to] == std::numeric_limits<double>::max()) overlay.touched.push_back(a.to);
+                    overlay.distTo[a.to] = candidate;
+                    if (overlay.pq.contains(a.to)) {
+                        overlay.pq.decreaseKey(a.to, candidate);
+                    } else {
+                        overlay.pq.insert(a.to, candidate);
+                    }
+                }
+            }
+        }
+    }
+
+    // Returns the shortcuts (pairs of arc ids u -> v, v -> x) needed to contract v
+    std::vector<std::pair<int, int>> requiredShortcuts(Overlay& overlay, const int v) {
+        std::vector<std::pair<int, int>> result;
+        double maxOut = 0.0;
+        for (const int id : overlay.out[v]) {
+            maxOut = std::max(maxOut, arcs[id].weight);
+            overlay.isTarget[arcs[id].to] = true;
+        }
+        const int targets = static_cast<int>(overlay.out[v].size());
+
+        for (const int inId : overlay.in[v]) {
+            const int u = arcs[inId].from;
+            // u -> v -> u needs no shortcut, so with no other targets there is nothing to search for
+            const int others = targets - (overlay.isTarget[u] ? 1 : 0);
+            if (others == 0) continue;
+            witnessSearch(overlay, u, v, arcs[inId].weight + maxOut, others);
+            for (const int outId : overlay.out[v]) {
+                const int x = arcs[outId].to;
+                if (x == u) continue;
+                if (overlay.distTo[x] > arcs[inId].weight + arcs[outId].weight) {
+                    result.emplace_back(inId, outId);
+                }
+            }
+        }
+        for (const int id : overlay.out[v]) overlay.isTarget[arcs[id].to] = false;
+        return result;
+    }
+
+    int priority(const Overlay& overlay, const int v, const int added) const {
+        const int removed = static_cast<int>(overlay.in[v].size() + overlay.out[v].size());
+        return added - removed + overlay.contractedNeighbors[v];
+    }
+
+    int priority(Overlay& overlay, const int v) {
+        return priority(overlay, v, static_cast<int>(requiredShortcuts(overlay, v).size()));
+    }
+
+    template <typename GraphType>
+    void preprocess(const GraphType& g) {
+        Overlay overlay(V_);
+        for (int v = 0; v < V_; ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) throw std::invalid_argument("Edge has negative weight");
+                if (e.from() != e.to()) addArc(overlay, e.from(), e.to(), e.weight(), -1, -1);
+            }
+        }
+
+        IndexMinPQ<int> order(V_);
+        for (int v = 0; v < V_; ++v) order.insert(v, priority(overlay, v));
+
+        std::vector<std::vector<SearchArc>> up(V_), down(V_);
+        for (int next = 0; !order.empty(); ++next) {
+            int v = order.removeMin();
+            std::vector<std::pair<int, int>> shortcuts = requiredShortcuts(overlay, v);
+
+            // Lazy update: priorities go stale as the graph changes, so recheck before contracting
+            for (int current = priority(overlay, v, static_cast<int>(shortcuts.size()));
+                 !order.empty() && current > order.minKey();
+                 current = priority(overlay, v, static_cast<int>(shortcuts.size()))) {
+                order.insert(v, current);
+                v = order.removeMin();
+                shortcuts = requiredShortcuts(overlay, v);
+            }
+            rank_[v] = next;
+
+            for (const auto& [inId, outId] : shortcuts) {
+                addArc(overlay, arcs[inId].from, arcs[outId].to,
+                       arcs[inId].weight + arcs[outId].weight, inId, outId);
+            }
+
+            // The remaining arcs of v all lead to higher-ranked vertices
+            std::vector<int> neighbors;
+            for (const int id : overlay.out[v]) {
+                const Arc& a = arcs[id];
+                up[v].push_back({a.to, a.weight, id});
+                auto& list = overlay.in[a.to];
+                list.erase(std::find(list.begin(), list.end(), id));
+                neighbors.push_back(a.to);
+            }
+            for (const int id : overlay.in[v]) {
+                const Arc& a = arcs[id];
+                down[v].push_back({a.from, a.weight, id});
+                auto& list = overlay.out[a.from];
+                list.erase(std::find(list.begin(), list.end(), id));
+                neighbors.push_back(a.from);
+            }
+            overlay.out[v].clear();
+            overlay.in[v].clear();
+
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+            for (const int w : neighbors) {
+                ++overlay.contractedNeighbors[w];
+                order.changeKey(w, priority(overlay, w));
+            }
+        }
+
+        // Flatten into CSR search graphs
+        for (int v = 0; v < V_; ++v) {
+            upOffsets[v + 1] = upOffsets[v] + static_cast<int>(up[v].size());
+            downOffsets[v + 1] = downOffsets[v] + static_cast<int>(down[v].size());
+        }
+        upArcs.reserve(upOffsets[V_]);
+        downArcs.reserve(downOffsets[V_]);
+        for (int v = 0; v < V_; ++v) {
+            upArcs.insert(upArcs.end(), up[v].begin(), up[v].end());
+            downArcs.insert(downArcs.end(), down[v].begin(), down[v].end());
+        }
+        for (const SearchArc& a : upArcs) shortcuts_ += arcs[a.arc].first != -1;
+        for (const SearchArc& a : downArcs) shortcuts_ += arcs[a.arc].first != -1;
+    }
+
+    // Settles the minimum vertex of one side and relaxes its upward arcs
+    void step(const std::vector<int>& offsets, const std::vector<SearchArc>& searchArcs, Side& side,
+              const Side& other) {
+        const int v = side.pq.removeMin();
+        ++settled;
+
+        for (int i = offsets[v]; i < offsets[v + 1]; ++i) {
+            const SearchArc& a = searchArcs[i];
+            const double candidate = side.distTo[v] + a.weight;
+            if (candidate < side.distTo[a.head]) {
+                if (side.distTo[a.head] == std::numeric_limits<double>::max()) side.touched.push_back(a.head);
+                side.distTo[a.head] = candidate;
+                side.arcTo[a.head] = a.arc;
+                if (side.pq.contains(a.head)) {
+                    side.pq.decreaseKey(a.head, candidate);
+                } else {
+                    side.pq.insert(a.head, candidate);
+                }
+                if (other.distTo[a.head] < std::numeric_limits<double>::max() &&
+                    candidate + other.distTo[a.head] < best) {
+                    best = candidate + other.distTo[a.head];
+                    meet = a.head;
+                }
+            }
+        }
+    }
+
+    // Appends the original edges of arc id, in order, to path
+    void unpack(const int id, std::vector<DirectedEdge>& path) const {
+        std::vector<int> stack{id};
+        while (!stack.empty()) {
+            const Arc& a = arcs[stack.back()];
+            stack.pop_back();
+            if (a.first == -1) {
+                path.emplace_back(a.from, a.to, a.weight);
+            } else {
+                stack.push_back(a.second);
+                stack.push_back(a.first);
+            }
+        }
+    }
+
+public:
+    /**
+     * Builds the hierarchy for an edge-weighted digraph.
+     *
+     * @param g the edge-weighted digraph
+     * @throws std::invalid_argument if any edge has negative weight
+     */
+    template <typename GraphType>
+    explicit ContractionHierarchy(const GraphType& g) :
+        V_(g.V()),
+        rank_(g.V(), 0),
+        upOffsets(g.V() + 1, 0),
+        downOffsets(g.V() + 1, 0),
+        forward(g.V()),
+        backward(g.V()) {
+        preprocess(g);
+    }
+
+    ContractionHierarchy(const ContractionHierarchy&) = delete;
+    ContractionHierarchy& operator=(const ContractionHierarchy&) = delete;
+
+    /**
+     * Computes the shortest path distance from s to t.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double query(const int s, const int t) {
+        validateVertex(s);
+        validateVertex(t);
+        forward.reset();
+        backward.reset();
+        target = t;
+        settled = 0;
+        best = std::numeric_limits<double>::max();
+        meet = -1;
+
+        forward.distTo[s] = 0.0;
+        forward.touched.push_back(s);
+        forward.pq.insert(s, 0.0);
+        backward.distTo[t] = 0.0;
+        backward.touched.push_back(t);
+        backward.pq.insert(t, 0.0);
+        if (s == t) {
+            best = 0.0;
+            meet = s;
+            return best;
+        }
+
+        while (true) {
+            const bool forwardActive = !forward.pq.empty() && forward.pq.minKey() < best;
+            const bool backwardActive = !backward.pq.empty() && backward.pq.minKey() < best;
+            if (!forwardActive && !backwardActive) break;
+
+            if (forwardActive && (!backwardActive || forward.pq.minKey() <= backward.pq.minKey())) {
+                step(upOffsets, upArcs, forward, backward);
+            } else {
+                step(downOffsets, downArcs, backward, forward);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Returns true if the last query found a path.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    bool hasPath() const {
+        if (target == -1) throw std::logic_error("No query has been run");
+        return meet != -1;
+    }
+
+    /**
+     * Returns the shortest path found by the last query, unpacked into the
+     * original directed edges, or an empty vector if there is none.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    std::vector<DirectedEdge> path() const {
+        if (!hasPath()) return std::vector<DirectedEdge>{};
+
+        std::vector<int> forwardArcs;
+        for (int v = meet; forward.arcTo[v] != -1; v = arcs[forward.arcTo[v]].from) {
+            forwardArcs.push_back(forward.arcTo[v]);
+        }
+        std::vector<DirectedEdge> result;
+        for (auto it = forwardArcs.rbegin(); it != forwardArcs.rend(); ++it) unpack(*it, result);
+        for (int v = meet; backward.arcTo[v] != -1; v = arcs[backward.arcTo[v]].to) {
+            unpack(backward.arcTo[v], result);
+        }
+        return result;
+    }
+
+    // Position of v in the contraction order (0 = contracted first)
+    int rank(const int v) const {
+        validateVertex(v);
+        return rank_[v];
+    }
+
+    // Number of shortcut arcs in the search graphs
+    int shortcutCount() const { return shortcuts_; }
+
+    // Number of vertices settled by the last query, counting both directions
+    int settledCount() const { return settled; }
+
+    int V() const { return V_; }
+};
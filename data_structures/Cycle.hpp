@@ -10,7 +10,8 @@ class Cycle {
     std::vector<int> cycle_;     // vertices in the cycle (empty if no cycle)
 
     // Check for self-loops (vertex connected to itself)
-    bool hasSelfLoop(const Graph& g) {
+    template <typename GraphType>
+    bool hasSelfLoop(const GraphType& g) {
         for (int v = 0; v < g.V(); ++v) {
             for (const int w : g.adj(v)) {
                 if (v == w) {
@@ -24,7 +25,8 @@ class Cycle {
     }
 
     // Check for parallel edges (multiple edges between same vertices)
-    bool hasParallelEdges(const Graph& g) {
+    template <typename GraphType>
+    bool hasParallelEdges(const GraphType& g) {
         marked = std::vector<bool>(g.V(), false);
 
         for (int v = 0; v < g.V(); ++v) {
@@ -48,7 +50,8 @@ class Cycle {
     }
 
     // DFS to find cycle, u is the parent of v
-    void dfs(const Graph& g, const int u, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int u, const int v) {
         marked[v] = true;
         for (const int w : g.adj(v)) {
             // If cycle already found, stop searching
@@ -72,7 +75,8 @@ class Cycle {
 
 public:
     // Constructor: find a cycle in the graph
-    explicit Cycle(const Graph& g) : marked(g.V(), false), edgeTo(g.V()) {
+    template <typename GraphType>
+    explicit Cycle(const GraphType& g) : marked(g.V(), false), edgeTo(g.V()) {
         // Check for trivial cycles first
         if (hasSelfLoop(g)) return;
         if (hasParallelEdges(g)) return;
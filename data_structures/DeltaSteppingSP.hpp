@@ -0,0 +1,287 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Computes shortest paths from a source vertex in an edge-weighted digraph
+ * with non-negative weights using parallel delta-stepping (Meyer & Sanders).
+ *
+ * Vertices are kept in buckets of width delta by tentative distance. The
+ * lowest non-empty bucket is processed in phases: all of its vertices relax
+ * their light edges (weight <= delta) in parallel, which may refill the same
+ * bucket, until it stays empty; then every vertex removed from the bucket
+ * relaxes its heavy edges (weight > delta) once, in parallel. Within a
+ * phase the frontier is split into blocks that the threads of a ThreadPool
+ * claim dynamically; distances are lowered with an atomic compare-and-swap
+ * minimum, and each thread collects the vertices it improved in a local
+ * buffer that is merged into the buckets after the phase.
+ *
+ * A small delta approaches Dijkstra's algorithm (little wasted work, little
+ * parallelism); a large delta approaches Bellman-Ford (more parallelism,
+ * more re-relaxations). By default delta is the maximum edge weight divided
+ * by the average out-degree.
+ *
+ * Buckets are kept in a ring of about maxWeight / delta slots, since no
+ * tentative distance can be more than the maximum weight above the bucket
+ * being processed; a very small delta therefore costs memory.
+ *
+ * Once the distances are final, the shortest path tree is built by a
+ * sequential pass over the tight edges (dist[v] + weight == dist[w]) from the
+ * source, which keeps pathTo consistent with distTo even when concurrent
+ * updates raced.
+ *
+ * Time complexity: O(V + E + L / delta) work for graphs whose light edges rarely
+ *                  re-relax, where L is the largest distance
+ * Space complexity: O(V + maxWeight / delta)
+ */
+class DeltaSteppingSP {
+    static constexpr int BLOCK_SIZE = 256;  // frontier vertices per unit of work
+
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest path from s to v
+    std::vector<double> distTo_;                      // distTo_[v] = distance of shortest path from s to v
+    double delta_;                                    // bucket width
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    template <typename GraphType>
+    static double defaultDelta(const GraphType& g, const double maxWeight) {
+        if (maxWeight == 0.0 || g.E() == 0) return 1.0;
+        const double averageDegree = static_cast<double>(g.E()) / g.V();
+        return maxWeight / std::max(1.0, averageDegree);
+    }
+
+    template <typename GraphType>
+    void run(const GraphType& g, const int s, ThreadPool& pool, const double maxWeight) {
+        const int V = g.V();
+        constexpr double INF = std::numeric_limits<double>::max();
+        std::vector<std::atomic<double>> dist(V);
+        for (auto& d : dist) d.store(INF, std::memory_order_relaxed);
+
+        // One spare slot absorbs rounding in floor(d / delta)
+        const long long slots = static_cast<long long>(std::ceil(maxWeight / delta_)) + 2;
+        std::vector<std::vector<int>> ring(static_cast<size_t>(slots));
+        std::vector<long long> queuedIn(V, -1);  // absolute bucket holding v's current entry, or -1
+        long long pending = 0;                   // entries in the ring, including stale ones
+
+        const auto bucketOf = [&](const double d) { return static_cast<long long>(std::floor(d / delta_)); };
+        const auto enqueue = [&](const int w) {
+            const long long b = bucketOf(dist[w].load(std::memory_order_relaxed));
+            if (queuedIn[w] == b) return;
+            queuedIn[w] = b;
+            ring[b % slots].push_back(w);
+            ++pending;
+        };
+
+        // Lowers dist[w] to candidate if smaller; returns true if this call lowered it
+        const auto relaxTo = [&](const int w, const double candidate) {
+            double current = dist[w].load(std::memory_order_relaxed);
+            while (candidate < current) {
+                if (dist[w].compare_exchange_weak(current, candidate, std::memory_order_relaxed)) return true;
+            }
+            return false;
+        };
+
+        std::vector<std::vector<int>> improved(pool.size());
+        // Relaxes the light or heavy edges of every vertex in frontier, then buckets the improved vertices
+        const auto relaxAll = [&](const std::vector<int>& frontier, const bool light) {
+            const int n = static_cast<int>(frontier.size());
+            const auto relaxRange = [&](const int lo, const int hi, std::vector<int>& out) {
+                for (int i = lo; i < hi; ++i) {
+                    const int v = frontier[i];
+                    const double dv = dist[v].load(std::memory_order_relaxed);
+                    for (const auto& e : g.adj(v)) {
+                        if ((e.weight() <= delta_) != light) continue;
+                        if (relaxTo(e.to(), dv + e.weight())) out.push_back(e.to());
+                    }
+                }
+            };
+
+            if (pool.size() == 1 || n <= BLOCK_SIZE) {
+                relaxRange(0, n, improved[0]);
+            } else {
+                const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+                std::atomic<int> nextBlock{0};
+                pool.run([&](const int t) {
+                    for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+                        relaxRange(b * BLOCK_SIZE, std::min(n, (b + 1) * BLOCK_SIZE), improved[t]);
+                    }
+                });
+            }
+            for (auto& out : improved) {
+                for (const int w : out) enqueue(w);
+                out.clear();
+            }
+        };
+
+        dist[s].store(0.0, std::memory_order_relaxed);
+        enqueue(s);
+
+        std::vector<int> frontier;
+        std::vector<int> settled;  // vertices removed from the current bucket
+        for (long long current = 0; pending > 0; ++current) {
+            std::vector<int>& slot = ring[current % slots];
+            if (slot.empty()) continue;
+
+            settled.clear();
+            while (!slot.empty()) {
+                frontier.clear();
+                for (const int v : slot) {
+                    if (queuedIn[v] != current) continue;  // stale entry: v moved to a lower bucket
+                    queuedIn[v] = -1;
+                    frontier.push_back(v);
+                }
+                pending -= static_cast<long long>(slot.size());
+                slot.clear();
+
+                relaxAll(frontier, true);
+                settled.insert(settled.end(), frontier.begin(), frontier.end());
+            }
+            relaxAll(settled, false);
+        }
+
+        for (int v = 0; v < V; ++v) distTo_[v] = dist[v].load(std::memory_order_relaxed);
+    }
+
+    // Builds edgeTo from the tight edges reachable from s
+    template <typename GraphType>
+    void buildTree(const GraphType& g, const int s) {
+        std::vector<bool> reached(g.V(), false);
+        std::vector<int> stack{s};
+        reached[s] = true;
+        while (!stack.empty()) {
+            const int v = stack.back();
+            stack.pop_back();
+            for (const auto& e : g.adj(v)) {
+                const int w = e.to();
+                if (!reached[w] && distTo_[v] + e.weight() == distTo_[w]) {
+                    reached[w] = true;
+                    edgeTo[w] = e;
+                    stack.push_back(w);
+                }
+            }
+        }
+    }
+
+    template <typename GraphType>
+    void solve(const GraphType& g, const int s, ThreadPool& pool, const double delta) {
+        validateVertex(s);
+        if (std::isnan(delta) || delta < 0.0) {
+            throw std::invalid_argument("Delta must be non-negative");
+        }
+
+        double maxWeight = 0.0;
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+                maxWeight = std::max(maxWeight, e.weight());
+            }
+        }
+        delta_ = delta > 0.0 ? delta : defaultDelta(g, maxWeight);
+
+        run(g, s, pool, maxWeight);
+        buildTree(g, s);
+    }
+
+public:
+    /**
+     * Computes shortest paths from s using a temporary thread pool.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @param delta the bucket width, or 0 to choose one from the graph
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if s is invalid, an edge has negative weight,
+     *         delta is negative or threads is not positive
+     */
+    template <typename GraphType>
+    DeltaSteppingSP(const GraphType& g, const int s, const double delta = 0.0,
+                    const int threads = ThreadPool::defaultThreads()) :
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        delta_(delta) {
+        ThreadPool pool(threads);
+        solve(g, s, pool, delta);
+    }
+
+    /**
+     * Computes shortest paths from s on an existing thread pool.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @param delta the bucket width, or 0 to choose one from the graph
+     * @param pool the thread pool
+     * @throws std::invalid_argument if s is invalid, an edge has negative weight or delta is negative
+     */
+    template <typename GraphType>
+    DeltaSteppingSP(const GraphType& g, const int s, const double delta, ThreadPool& pool) :
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        delta_(delta) {
+        solve(g, s, pool, delta);
+    }
+
+    /**
+     * Returns the length of the shortest path from the source to v.
+     *
+     * @param v the destination vertex
+     * @return the distance, or the maximum double value if there is no path
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns a shortest path from the source to v as a sequence of directed
+     * edges, or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (std::optional<DirectedEdge> e = edgeTo[v]; e.has_value(); e = edgeTo[e->from()]) {
+            path.push_back(*e);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // The bucket width used
+    double delta() const { return delta_; }
+
+    // Number of vertices
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
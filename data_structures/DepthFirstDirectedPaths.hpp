@@ -16,7 +16,8 @@ class DepthFirstDirectedPaths {
     const int source;          // source vertex
 
     // Recursive DFS from vertex v
-    void dfs(const Digraph& g, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         marked[v] = true;
         for (const int w : g.adj(v)) {
             if (!marked[w]) {
@@ -35,7 +36,8 @@ class DepthFirstDirectedPaths {
 
 public:
     // Constructor: find all directed paths from source vertex s
-    DepthFirstDirectedPaths(const Digraph& g, const int s) :
+    template <typename GraphType>
+    DepthFirstDirectedPaths(const GraphType& g, const int s) :
         marked(g.V(), false),
         edgeTo(g.V()),
         source(s) {
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Digraph.hpp"
+#include "DirectedEdge.hpp"
 
 /**
  * Computes depth-first search preorder and postorder for vertices in a digraph.
@@ -14,32 +15,75 @@
  * Preorder: order in which vertices are first encountered during DFS
  * Postorder: order in which vertices are finished (all descendants processed)
  * Reverse postorder: topological ordering for DAGs
+ *
+ * Works on unweighted digraphs (adj(v) yields vertices) and on edge-weighted
+ * digraphs (adj(v) yields DirectedEdge), following each edge to its head.
+ *
+ * The DFS keeps an explicit stack of frames, one per active vertex, so deep
+ * graphs such as long chains cannot overflow the thread's call stack. Orders
+ * are the same as with the recursive formulation.
  */
 class DepthFirstOrder {
-    std::vector<bool> marked;      // marked[v] = true if vertex v has been visited
-    std::vector<int> pre_;         // pre_[v] = preorder number of vertex v
+    std::vector<int> pre_;         // pre_[v] = preorder number of vertex v, or -1 if v is unvisited
     std::vector<int> post_;        // post_[v] = postorder number of vertex v
     std::vector<int> preorder;     // vertices in preorder (order of first visit)
     std::vector<int> postorder;    // vertices in postorder (order of completion)
     int preCount;                  // counter for preorder numbering
     int postCount;                 // counter for postorder numbering
 
-    // Recursive DFS to compute pre and postorder
-    void dfs(const Digraph& g, const int v) {
-        marked[v] = true;
-        pre_[v] = preCount++;           // Assign preorder number
-        preorder.push_back(v);          // Add to preorder sequence
-
-        // Recursively visit all unvisited adjacent vertices
-        for (const int w : g.adj(v)) {
-            if (!marked[w]) {
-                dfs(g, w);
+    // Head of an adjacency entry: the vertex itself, or the target of a directed edge
+    static int head(const int w) { return w; }
+    static int head(const DirectedEdge& e) { return e.to(); }
+
+    // Iterative DFS from every unvisited vertex to compute pre and postorder.
+    // The current vertex and its edge iterators stay in locals; frames hold
+    // the suspended callers, as the call stack does in the recursive version
+    template <typename GraphType>
+    void dfs(const GraphType& g) {
+        using Iterator = decltype(g.adj(0).begin());
+        struct Frame {
+            int v;
+            Iterator next;              // next edge of v to explore on return
+            Iterator end;
+        };
+        std::vector<Frame> frames;
+
+        for (int s = 0; s < g.V(); ++s) {
+            if (pre_[s] != -1) continue;
+
+            int v = s;
+            pre_[v] = preCount++;       // Assign preorder number
+            preorder.push_back(v);      // Add to preorder sequence
+            auto adj = g.adj(v);
+            Iterator next = adj.begin(), end = adj.end();
+
+            while (true) {
+                // Descend into the next unvisited adjacent vertex
+                while (next != end) {
+                    const int w = head(*next++);
+                    if (pre_[w] != -1) continue;
+
+                    frames.push_back(Frame{v, next, end});
+                    v = w;
+                    pre_[v] = preCount++;
+                    preorder.push_back(v);
+                    adj = g.adj(v);
+                    next = adj.begin();
+                    end = adj.end();
+                }
+
+                // After processing all descendants, add to postorder
+                postorder.push_back(v);
+                post_[v] = postCount++;     // Assign postorder number
+                if (frames.empty()) break;
+
+                // Return to the caller
+                v = frames.back().v;
+                next = frames.back().next;
+                end = frames.back().end;
+                frames.pop_back();
             }
         }
-
-        // After processing all descendants, add to postorder
-        postorder.push_back(v);
-        post_[v] = postCount++;         // Assign postorder number
     }
 
     // Verify the correctness of pre and postorder numbering
@@ -67,26 +111,25 @@ class DepthFirstOrder {
 
     // Validate vertex index is within bounds
     void validateVertex(const int v) const {
-        if (v < 0 || v >= static_cast<int>(marked.size())) {
+        if (v < 0 || v >= static_cast<int>(pre_.size())) {
             throw std::invalid_argument("Vertex out of range");
         }
     }
 
 public:
     // Constructor: compute DFS preorder and postorder for the digraph
-    explicit DepthFirstOrder(const Digraph& g) :
-        marked(g.V(), false),
-        pre_(g.V()),
+    template <typename GraphType>
+    explicit DepthFirstOrder(const GraphType& g) :
+        pre_(g.V(), -1),
         post_(g.V()),
         preCount(0),
         postCount(0) {
 
+        preorder.reserve(g.V());
+        postorder.reserve(g.V());
+
         // Run DFS from each unvisited vertex (handles disconnected components)
-        for (int v = 0; v < g.V(); ++v) {
-            if (!marked[v]) {
-                dfs(g, v);
-            }
-        }
+        dfs(g);
         // assert(check());
     }
 
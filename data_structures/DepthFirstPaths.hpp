@@ -12,7 +12,8 @@ class DepthFirstPaths {
     const int s;               // source vertex
 
     // Recursive DFS from vertex v
-    void dfs(const Graph& g, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         marked[v] = true;
         for (const int w : g.adj(v)) {
             if (!marked[w]) {
@@ -31,7 +32,8 @@ class DepthFirstPaths {
 
 public:
     // Constructor: find all paths from source vertex s
-    DepthFirstPaths(const Graph& g, const int s) : marked(g.V(), false), edgeTo(g.V()), s(s) {
+    template <typename GraphType>
+    DepthFirstPaths(const GraphType& g, const int s) : marked(g.V(), false), edgeTo(g.V()), s(s) {
         validateVertex(s);
         dfs(g, s);
     }
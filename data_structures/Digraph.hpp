@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <vector>
 
+#include "AdjacencyView.hpp"
+
 class Digraph {
     std::vector<std::list<int>> adj_;  // Adjacency lists for each vertex
     const int V_;                      // Number of vertices
@@ -42,10 +44,10 @@ public:
         ++E_;
     }
 
-    // Returns adjacency list for vertex v
-    std::vector<int> adj(const int v) const {
+    // Returns a non-owning view of the vertices adjacent from v (no copy is made)
+    AdjacencyView<std::list<int>::const_iterator> adj(const int v) const {
         validateVertex(v);
-        return std::vector<int>{adj_[v].begin(), adj_[v].end()};
+        return {adj_[v].begin(), adj_[v].end(), adj_[v].size()};
     }
 
     // Returns out-degree of vertex v
@@ -76,8 +78,7 @@ public:
 
         for (int v = 0; v < graph.V(); ++v) {
             os << "V: " << v << "\tE: ";
-            std::vector<int> neighbors = graph.adj(v);
-            for (const int neighbor : neighbors) {
+            for (const int neighbor : graph.adj(v)) {
                 os << neighbor << ' ';
             }
             os << '\n';
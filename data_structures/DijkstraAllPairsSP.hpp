@@ -1,24 +1,87 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <list>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
-#include "DijkstraSP.hpp"
+#include "BellmanFordSP.hpp"
+#include "CSREdgeWeightedDigraph.hpp"
+#include "DirectedEdge.hpp"
+#include "IndexMinPQ.hpp"
+#include "ThreadPool.hpp"
 
 /**
  * Computes all-pairs shortest paths in edge-weighted directed graphs
  * using Dijkstra's algorithm from each vertex as source.
  *
- * Precomputes shortest path trees from every vertex to all other vertices.
- * Provides O(1) query time for distances and paths after O(V * (E + V) log V) preprocessing.
+ * The result is stored compactly: a dense V x V matrix of distances of type
+ * Distance (double by default; float halves the matrix at the cost of
+ * precision) and a V x V matrix of int predecessors, each naming the last
+ * edge on the path in a flat copy of the digraph's edges. Paths are
+ * rebuilt from that copy, so the digraph need not outlive this object.
  *
- * Space complexity: O(V²)
- * Query time: O(1) for distance, O(path length) for path reconstruction
+ * Two modes are available:
+ * - Eager (constructor): every row is computed up front, with the sources
+ *   spread across a ThreadPool. Each thread reuses one priority queue and
+ *   one scratch distance array for all of its sources.
+ * - Lazy (lazy()): a row is computed the first time one of its entries is
+ *   queried and kept in a cache of at most cacheRows rows. When the cache
+ *   is full, the least recently used row is evicted. Queries then update the
+ *   cache, so a lazy instance must not be shared between threads.
+ *
+ * Negative edge weights are accepted only by johnson(), which reweights the
+ * edges with Johnson's method: BellmanFordSP from a virtual source joined to
+ * every vertex by a zero-weight edge gives potentials h(v), and the reduced
+ * weights w(u, v) + h(u) - h(v) are non-negative, so Dijkstra applies. The
+ * stored distances are translated back to the original weights.
+ *
+ * Eager: O(V * (E + V) log V / p) time with p threads, O(V² + E) space
+ * Johnson: adds O(V * E) worst case for the potentials
+ * Lazy: O((E + V) log V) per row miss, O(cacheRows * V + E) space
+ * Query time: O(1) for distance (cached row), O(path length) for path reconstruction
  *
  * Use when multiple shortest path queries are needed between various vertex pairs.
  */
+template <typename Distance = double>
 class DijkstraAllPairsSP {
-    std::vector<DijkstraSP> all;  // Shortest path trees from each vertex
+    static_assert(std::is_floating_point_v<Distance>, "Distance must be a floating point type");
+
+    // Rows kept by the lazy mode, with their recency order
+    struct RowCache {
+        std::vector<int> slotOf;                          // slotOf[s] = row slot holding source s, or -1
+        std::vector<int> sourceOf;                        // sourceOf[r] = source held in row slot r
+        std::list<int> recent;                            // row slots, most recently used first
+        std::vector<std::list<int>::iterator> position;   // position[r] = r's node in recent
+        IndexMinPQ<double> pq;
+        std::vector<double> work;                         // scratch distances for one run
+
+        RowCache(const int V, const int rows) :
+            slotOf(V, -1),
+            pq(V),
+            work(V) {
+            sourceOf.reserve(rows);
+            position.reserve(rows);
+        }
+    };
+
+    struct AllocateRows { int rows; bool allowNegative; };  // tag for the constructor shared by all modes
+
+    int V_;
+    int cacheRows_;                   // rows kept in memory (V in eager mode)
+    std::vector<int> offsets;         // offsets[v] = index in edges of v's first edge (size V + 1)
+    std::vector<DirectedEdge> edges;  // edges of the digraph grouped by tail, in adjacency order
+    // Rows are mutable so that const queries can fill the lazy cache
+    mutable std::vector<Distance> distances;  // cacheRows_ rows of V distances
+    mutable std::vector<int> predecessors;    // cacheRows_ rows of V indices into edges (-1 for none)
+    mutable std::vector<RowCache> cache;      // empty in eager mode, one entry in lazy mode
+    std::vector<double> potential;            // Johnson potentials h(v); empty unless built by johnson()
+    mutable long long rowsComputed_ = 0;
 
     /**
      * Validates that vertex v is within valid range.
@@ -26,25 +89,187 @@ class DijkstraAllPairsSP {
      * @throws std::invalid_argument if vertex is out of range
      */
     void validateVertex(const int v) const {
-        if (v < 0 || v >= static_cast<int>(all.size()))
+        if (v < 0 || v >= V_)
             throw std::invalid_argument("Vertex out of range");
     }
 
+    template <typename GraphType>
+    DijkstraAllPairsSP(const GraphType& g, const AllocateRows allocate) :
+        V_(g.V()),
+        cacheRows_(allocate.rows),
+        offsets(g.V() + 1, 0) {
+
+        for (int v = 0; v < V_; ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0 && !allocate.allowNegative) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+                edges.push_back(e);
+            }
+            offsets[v + 1] = static_cast<int>(edges.size());
+        }
+
+        const std::size_t cells = static_cast<std::size_t>(cacheRows_) * V_;
+        distances.assign(cells, std::numeric_limits<Distance>::max());
+        predecessors.assign(cells, -1);
+    }
+
+    // Runs Dijkstra from s and writes its distances and predecessors into row slot r
+    void computeRow(const int s, const int r, IndexMinPQ<double>& pq, std::vector<double>& work) const {
+        constexpr double INF = std::numeric_limits<double>::max();
+        Distance* dist = distances.data() + static_cast<std::size_t>(r) * V_;
+        int* pred = predecessors.data() + static_cast<std::size_t>(r) * V_;
+        std::fill(work.begin(), work.end(), INF);
+        std::fill(pred, pred + V_, -1);
+        const bool reweighted = !potential.empty();
+
+        work[s] = 0.0;
+        pq.insert(s, 0.0);
+        while (!pq.empty()) {
+            const int v = pq.removeMin();
+            for (int i = offsets[v]; i < offsets[v + 1]; ++i) {
+                const int w = edges[i].to();
+                // Reduced weights are non-negative in exact arithmetic; clamp rounding error
+                const double weight = reweighted
+                    ? std::max(0.0, edges[i].weight() + potential[v] - potential[w])
+                    : edges[i].weight();
+                const double candidate = work[v] + weight;
+                if (work[w] > candidate) {
+                    work[w] = candidate;
+                    pred[w] = i;
+                    if (pq.contains(w)) {
+                        pq.decreaseKey(w, candidate);
+                    } else {
+                        pq.insert(w, candidate);
+                    }
+                }
+            }
+        }
+
+        for (int v = 0; v < V_; ++v) {
+            if (work[v] == INF) {
+                dist[v] = std::numeric_limits<Distance>::max();
+            } else {
+                const double d = reweighted ? work[v] - potential[s] + potential[v] : work[v];
+                dist[v] = static_cast<Distance>(d);
+            }
+        }
+    }
+
+    // Returns the row slot holding source s, computing it on a lazy-mode miss
+    int row(const int s) const {
+        if (cache.empty()) return s;
+
+        RowCache& c = cache.front();
+        int r = c.slotOf[s];
+        if (r != -1) {
+            c.recent.splice(c.recent.begin(), c.recent, c.position[r]);
+            return r;
+        }
+
+        if (static_cast<int>(c.sourceOf.size()) < cacheRows_) {
+            r = static_cast<int>(c.sourceOf.size());
+            c.sourceOf.push_back(s);
+            c.recent.push_front(r);
+            c.position.push_back(c.recent.begin());
+        } else {
+            r = c.recent.back();
+            c.slotOf[c.sourceOf[r]] = -1;
+            c.sourceOf[r] = s;
+            c.recent.splice(c.recent.begin(), c.recent, c.position[r]);
+        }
+        c.slotOf[s] = r;
+        computeRow(s, r, c.pq, c.work);
+        ++rowsComputed_;
+        return r;
+    }
+
+    // Computes every row, spreading the sources across a thread pool
+    void computeAllRows(const int threads) {
+        ThreadPool pool(threads);
+        std::atomic<int> nextSource{0};
+        pool.run([&](int) {
+            IndexMinPQ<double> pq(V_);
+            std::vector<double> work(V_);
+            for (int s; (s = nextSource.fetch_add(1, std::memory_order_relaxed)) < V_;) {
+                computeRow(s, s, pq, work);
+            }
+        });
+        rowsComputed_ = V_;
+    }
+
+    int predecessor(const int r, const int v) const {
+        return predecessors[static_cast<std::size_t>(r) * V_ + v];
+    }
+
 public:
     /**
-     * Computes all-pairs shortest paths using Dijkstra's algorithm.
-     * Runs Dijkstra from each vertex as source.
+     * Computes all-pairs shortest paths using Dijkstra's algorithm,
+     * running the sources in parallel.
+     *
+     * @param g the edge-weighted directed graph
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if any edge has negative weight or threads is not positive
+     */
+    template <typename GraphType>
+    explicit DijkstraAllPairsSP(const GraphType& g, const int threads = ThreadPool::defaultThreads()) :
+        DijkstraAllPairsSP(g, AllocateRows{g.V(), false}) {
+        computeAllRows(threads);
+    }
+
+    /**
+     * Computes all-pairs shortest paths in a digraph that may have negative
+     * edge weights, using Johnson's reweighting and parallel Dijkstra runs.
+     *
+     * @param g the edge-weighted directed graph
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @return the all-pairs shortest paths
+     * @throws std::invalid_argument if the digraph has a negative cycle or threads is not positive
+     */
+    template <typename GraphType>
+    static DijkstraAllPairsSP johnson(const GraphType& g, const int threads = ThreadPool::defaultThreads()) {
+        DijkstraAllPairsSP result(g, AllocateRows{g.V(), true});
+        const int V = result.V_;
+
+        std::vector<DirectedEdge> augmented = result.edges;
+        for (int v = 0; v < V; ++v) augmented.emplace_back(V, v, 0.0);
+        const BellmanFordSP bf(CSREdgeWeightedDigraph(V + 1, augmented), V);
+        if (bf.hasNegativeCycle()) {
+            throw std::invalid_argument("Digraph has a negative cycle");
+        }
+        result.potential.resize(V);
+        for (int v = 0; v < V; ++v) result.potential[v] = bf.distTo(v);
+
+        result.computeAllRows(threads);
+        return result;
+    }
+
+    /**
+     * Prepares all-pairs shortest path queries whose source rows are computed
+     * on first use and kept in a least-recently-used cache.
      *
      * @param g the edge-weighted directed graph
-     * @throws std::invalid_argument if any edge has negative weight
+     * @param cacheRows the maximum number of source rows kept in memory
+     * @return the lazy all-pairs shortest paths
+     * @throws std::invalid_argument if any edge has negative weight or cacheRows is not positive
      */
-    explicit DijkstraAllPairsSP(const EdgeWeightedDigraph& g) {
-        all.reserve(g.V());
-        for (int v = 0; v < g.V(); ++v) {
-            all.emplace_back(g, v);
+    template <typename GraphType>
+    static DijkstraAllPairsSP lazy(const GraphType& g, const int cacheRows) {
+        if (cacheRows <= 0) {
+            throw std::invalid_argument("Cache must hold at least one row, got: " + std::to_string(cacheRows));
         }
+        const int rows = std::min(cacheRows, g.V());
+        DijkstraAllPairsSP result(g, AllocateRows{rows, false});
+        result.cache.emplace_back(g.V(), rows);
+        return result;
     }
 
+    // The lazy cache holds iterators into its own list, so instances are moved, never copied
+    DijkstraAllPairsSP(const DijkstraAllPairsSP&) = delete;
+    DijkstraAllPairsSP& operator=(const DijkstraAllPairsSP&) = delete;
+    DijkstraAllPairsSP(DijkstraAllPairsSP&&) noexcept = default;
+    DijkstraAllPairsSP& operator=(DijkstraAllPairsSP&&) noexcept = default;
+
     /**
      * Returns shortest path from vertex s to vertex v.
      * @param s source vertex
@@ -55,7 +280,14 @@ public:
     std::vector<DirectedEdge> path(const int s, const int v) const {
         validateVertex(s);
         validateVertex(v);
-        return all[s].pathTo(v);
+        const int r = row(s);
+
+        std::vector<DirectedEdge> result;
+        for (int i = predecessor(r, v); i != -1; i = predecessor(r, edges[i].from())) {
+            result.push_back(edges[i]);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
     }
 
     /**
@@ -68,20 +300,22 @@ public:
     bool hasPath(const int s, const int v) const {
         validateVertex(s);
         validateVertex(v);
-        return all[s].hasPathTo(v);
+        return s == v || predecessor(row(s), v) != -1;
     }
 
     /**
      * Returns length of shortest path from vertex s to vertex v.
      * @param s source vertex
      * @param v destination vertex
-     * @return shortest distance, or infinity if no path
+     * @return shortest distance, or the maximum double value if no path
      * @throws std::invalid_argument if s or v is out of range
      */
     double dist(const int s, const int v) const {
         validateVertex(s);
         validateVertex(v);
-        return all[s].distTo(v);
+        const int r = row(s);
+        if (s != v && predecessor(r, v) == -1) return std::numeric_limits<double>::max();
+        return distances[static_cast<std::size_t>(r) * V_ + v];
     }
 
     /**
@@ -89,6 +323,12 @@ public:
      * @return number of vertices
      */
     int V() const {
-        return static_cast<int>(all.size());
+        return V_;
     }
-};
\ No newline at end of file
+
+    // True if rows are computed on demand
+    bool isLazy() const { return !cache.empty(); }
+
+    // Number of single-source runs performed so far (V for eager mode; grows with misses in lazy mode)
+    long long rowsComputed() const { return rowsComputed_; }
+};
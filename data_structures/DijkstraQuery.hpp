@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "IndexMinPQ.hpp"
+
+/**
+ * Reusable point-to-point shortest path engine for an edge-weighted digraph
+ * with non-negative weights, based on Dijkstra's algorithm.
+ *
+ * Unlike DijkstraSP, which settles every vertex reachable from the source,
+ * query(s, t) stops as soon as t is removed from the priority queue, since
+ * its distance is final at that point. The engine is bound to one digraph:
+ * edge weights are validated once, at bind time, and the distance,
+ * predecessor and priority queue arrays are allocated once. Each query
+ * records the vertices it touches and resets only those before the next
+ * query, so the cost of a query scales with the region it explores rather
+ * than with V.
+ *
+ * A query can also be given an edge filter, a callable bool(const
+ * DirectedEdge&) that is false for edges the search must not use. Removing
+ * edges or vertices this way (as Yen's k-shortest paths algorithm does for
+ * every spur search) needs no copy of the digraph; a vertex is removed by
+ * rejecting the edges into it.
+ *
+ * The digraph must outlive the engine and must not change after binding.
+ * Queries modify internal state, so one engine must not be shared between
+ * threads.
+ *
+ * Time complexity: O(V + E) to bind; O((V' + E') log V') per query, where
+ *                  V' and E' are the vertices and edges explored
+ * Space complexity: O(V)
+ */
+template <typename GraphType = EdgeWeightedDigraph>
+class DijkstraQuery {
+    const GraphType& g;
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest path from s to v
+    std::vector<double> distTo_;                      // distTo_[v] = distance of shortest known path from s to v
+    IndexMinPQ<double> pq;                            // priority queue of vertices
+    std::vector<int> touched;                         // vertices whose distTo_ was set by the last query
+    int target = -1;                                  // target of the last query (-1 before the first)
+    int settled = 0;                                  // vertices settled by the last query
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    void relax(const DirectedEdge& e) {
+        const int v = e.from();
+        const int w = e.to();
+
+        if (distTo_[w] > distTo_[v] + e.weight()) {
+            if (distTo_[w] == std::numeric_limits<double>::max()) touched.push_back(w);
+            distTo_[w] = distTo_[v] + e.weight();
+            edgeTo[w] = e;
+
+            if (pq.contains(w)) {
+                pq.decreaseKey(w, distTo_[w]);
+            } else {
+                pq.insert(w, distTo_[w]);
+            }
+        }
+    }
+
+    // Restores the state left by the previous query to "all vertices unreached"
+    void reset() {
+        for (const int v : touched) {
+            distTo_[v] = std::numeric_limits<double>::max();
+            edgeTo[v].reset();
+        }
+        touched.clear();
+        pq.clear();
+        settled = 0;
+    }
+
+public:
+    /**
+     * Binds the engine to an edge-weighted digraph.
+     *
+     * @param g the edge-weighted digraph
+     * @throws std::invalid_argument if any edge has negative weight
+     */
+    explicit DijkstraQuery(const GraphType& g) :
+        g(g),
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        pq(g.V()) {
+
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+            }
+        }
+    }
+
+    DijkstraQuery(const DijkstraQuery&) = delete;
+    DijkstraQuery& operator=(const DijkstraQuery&) = delete;
+
+    /**
+     * Computes the shortest path from s to t, stopping once t is settled.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double query(const int s, const int t) {
+        return query(s, t, [](const DirectedEdge&) { return true; });
+    }
+
+    /**
+     * Computes the shortest path from s to t that uses only edges accepted by
+     * the filter, stopping once t is settled.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @param allowed callable bool(const DirectedEdge&), false for edges to skip
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    template <typename EdgeFilter>
+    double query(const int s, const int t, EdgeFilter&& allowed) {
+        validateVertex(s);
+        validateVertex(t);
+        reset();
+        target = t;
+
+        distTo_[s] = 0.0;
+        touched.push_back(s);
+        pq.insert(s, 0.0);
+
+        while (!pq.empty()) {
+            const int v = pq.removeMin();
+            ++settled;
+            if (v == t) break;
+
+            for (const auto& e : g.adj(v)) {
+                if (allowed(e)) relax(e);
+            }
+        }
+        return distTo_[t];
+    }
+
+    /**
+     * Returns true if the last query found a path.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    bool hasPath() const {
+        if (target == -1) throw std::logic_error("No query has been run");
+        return distTo_[target] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns the shortest path found by the last query as a sequence of
+     * directed edges, or an empty vector if there is none.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    std::vector<DirectedEdge> path() const {
+        if (!hasPath()) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> result;
+        for (std::optional<DirectedEdge> e = edgeTo[target]; e.has_value(); e = edgeTo[e->from()]) {
+            result.push_back(*e);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    // Number of vertices settled (removed from the priority queue) by the last query
+    int settledCount() const { return settled; }
+
+    // Number of vertices whose distance was set by the last query
+    int touchedCount() const { return static_cast<int>(touched.size()); }
+
+    // Number of vertices in the bound digraph
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
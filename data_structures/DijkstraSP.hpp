@@ -37,15 +37,26 @@
  * - Social network analysis (shortest connection paths)
  * - Game AI pathfinding
  *
+ * Priority queue:
+ * - PriorityQueue defaults to the binary heap IndexMinPQ<double>
+ * - Since the removed distances never decrease, a monotone queue also works:
+ *   IndexRadixHeap<double> for any weights, IndexBucketQueue<double> (Dial)
+ *   for small non-negative integer weights
+ * - DijkstraSP sp(g, s) keeps the default; DijkstraSP<IndexRadixHeap<double>> sp(g, s) picks another
+ * - IndexDaryMinPQ<double, D> is a d-ary heap with no restriction on the keys;
+ *   D = 4 or 8 is shallower than the binary heap and helps on decrease-key-heavy
+ *   dense graphs
+ *
  * Limitations:
  * - Cannot handle negative edge weights (use Bellman-Ford for that case)
  * - Single-source algorithm (use Floyd-Warshall for all-pairs shortest paths)
  */
+template <typename PriorityQueue = IndexMinPQ<double>>
 class DijkstraSP {
 private:
     std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest path from s to v
     std::vector<double> distTo_;                      // distTo[v] = distance of shortest path from s to v
-    IndexMinPQ<double> pq;                           // priority queue of vertices
+    PriorityQueue pq;                                 // priority queue of vertices
 
     /**
      * Relaxes the given directed edge.
@@ -80,7 +91,8 @@ private:
      * @param s the source vertex
      * @return true if shortest path tree is valid, false otherwise
      */
-    bool check(const EdgeWeightedDigraph& g, const int s) const {
+    template <typename GraphType>
+    bool check(const GraphType& g, const int s) const {
         // Check 1: All edge weights must be non-negative
         for (const auto& e : g.edges()) {
             if (e.weight() < 0) {
@@ -147,7 +159,8 @@ public:
      * @throws std::invalid_argument if any edge has negative weight
      * @throws std::invalid_argument if source vertex is invalid
      */
-    DijkstraSP(const EdgeWeightedDigraph& g, const int s) :
+    template <typename GraphType>
+    DijkstraSP(const GraphType& g, const int s) :
         edgeTo(g.V()),
         distTo_(g.V(), std::numeric_limits<double>::max()),
         pq(g.V()) {
@@ -159,9 +172,12 @@ public:
         }
 
         // Check for negative edge weights (Dijkstra requires non-negative weights)
-        for (const auto& e : g.edges()) {
-            if (e.weight() < 0) {
-                throw std::invalid_argument("Edge has negative weight");
+        // Scans the adjacency views directly so no edge list is materialized
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
             }
         }
 
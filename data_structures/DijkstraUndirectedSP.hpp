@@ -36,14 +36,21 @@
  * - Time complexity: O((V + E) log V) with binary heap
  * - Space complexity: O(V)
  *
+ * Priority queue:
+ * - PriorityQueue defaults to the binary heap IndexMinPQ<double>
+ * - IndexRadixHeap<double> or, for small non-negative integer weights,
+ *   IndexBucketQueue<double> (Dial) can be used instead, as in DijkstraSP
+ * - IndexDaryMinPQ<double, D> is a d-ary heap with no restriction on the keys
+ *
  * Limitations:
  * - Cannot handle negative edge weights (use Bellman-Ford for that case)
  * - Single-source algorithm (use Floyd-Warshall for all-pairs shortest paths)
  */
+template <typename PriorityQueue = IndexMinPQ<double>>
 class DijkstraUndirectedSP {
     std::vector<double> distTo_;                    // distTo_[v] = distance of shortest path from s to v
     std::vector<std::optional<Edge>> edgeTo_;       // edgeTo_[v] = last edge on shortest path from s to v
-    IndexMinPQ<double> pq_;                        // priority queue of vertices
+    PriorityQueue pq_;                              // priority queue of vertices
 
     /**
      * Relaxes the given undirected edge from vertex v.
@@ -151,15 +158,19 @@ public:
      * @throws std::invalid_argument if any edge has negative weight
      * @throws std::invalid_argument if source vertex is invalid
      */
-    DijkstraUndirectedSP(const EdgeWeightedGraph& g, const int s) :
+    template <typename GraphType>
+    DijkstraUndirectedSP(const GraphType& g, const int s) :
         distTo_(g.V(), std::numeric_limits<double>::max()),
         edgeTo_(g.V()),
         pq_(g.V()) {
 
         // Check for negative edge weights (Dijkstra requires non-negative weights)
-        for (const auto& e : g.edges()) {
-            if (e.weight() < 0) {
-                throw std::invalid_argument("Edge has negative weight");
+        // Scans the adjacency views directly so no edge list is materialized
+        for (int v = 0; v < g.V(); ++v) {
+            for (const auto& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
             }
         }
 
@@ -16,7 +16,8 @@ class DirectedCycle {
     std::vector<int> cycle_;    // vertices in the directed cycle (empty if no cycle)
 
     // DFS to detect directed cycles
-    void dfs(const Digraph& g, const int v) {
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         onStack[v] = true;  // Add v to current DFS path
         marked[v] = true;   // Mark v as visited
 
@@ -61,7 +62,8 @@ class DirectedCycle {
 
 public:
     // Constructor: find a directed cycle in the digraph
-    explicit DirectedCycle(const Digraph& g) :
+    template <typename GraphType>
+    explicit DirectedCycle(const GraphType& g) :
         marked(g.V(), false),
         edgeTo(g.V()),
         onStack(g.V(), false) {
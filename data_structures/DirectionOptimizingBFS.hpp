@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Digraph.hpp"
+
+/**
+ * Direction-optimizing (Beamer-style hybrid) breadth-first search for
+ * shortest paths from a single source vertex.
+ *
+ * Each BFS level is expanded either top-down (scan the out-edges of every
+ * frontier vertex, as in BreadthFirstDirectedPaths) or bottom-up (every
+ * unvisited vertex scans its in-edges, taken from the reverse graph, and
+ * stops at the first parent found in the frontier). Bottom-up steps pay off
+ * when the frontier is large, which is typical of the middle levels of a
+ * search in a low-diameter graph.
+ *
+ * Switching heuristics, with m_f the number of edges leaving the frontier,
+ * m_u the number of edges leaving unvisited vertices and n_f the frontier size:
+ * - top-down -> bottom-up when m_f * alpha > m_u
+ * - bottom-up -> top-down when n_f * beta < V
+ * An alpha of 0 disables bottom-up steps altogether.
+ *
+ * Distances are identical to a plain BFS. When a vertex has several parents
+ * on the previous level, pathTo may pick a different (equally short) path.
+ *
+ * Works with any graph type exposing V() and adj(v). Digraphs must either
+ * provide reverse() or have their reverse graph passed in explicitly, which
+ * lets many searches share one reverse graph. Graph types without reverse()
+ * are treated as undirected and serve as their own reverse.
+ *
+ * Time complexity: O(V + E) per search, O(V * depth + E) worst case with bottom-up steps
+ * Space complexity: O(V)
+ */
+class DirectionOptimizingBFS {
+    std::vector<bool> marked;   // marked[v] = true if v is reachable from source
+    std::vector<int> edgeTo;    // edgeTo[v] = previous vertex on shortest path from source to v
+    std::vector<int> distTo_;   // distTo_[v] = shortest distance from source to v
+    const int source;           // source vertex
+    long long edgesExamined_ = 0;   // edges inspected over the whole search
+    int topDownSteps_ = 0;          // levels expanded top-down
+    int bottomUpSteps_ = 0;         // levels expanded bottom-up
+
+    template <typename GraphType>
+    static auto reverseOf(const GraphType& g, int) -> decltype(g.reverse()) {
+        return g.reverse();
+    }
+
+    // Graphs without reverse() are undirected, so adjacency is already symmetric
+    template <typename GraphType>
+    static const GraphType& reverseOf(const GraphType& g, long) {
+        return g;
+    }
+
+    static double validateFactor(const double factor) {
+        if (std::isnan(factor) || factor < 0.0) {
+            throw std::invalid_argument("Switching factors must be non-negative");
+        }
+        return factor;
+    }
+
+    // Checks the source and factors before a reverse graph is built for them
+    template <typename GraphType>
+    static const GraphType& validateArguments(const GraphType& g, const int s, const double alpha, const double beta) {
+        if (s < 0 || s >= g.V()) {
+            throw std::invalid_argument("Vertex out of range");
+        }
+        validateFactor(alpha);
+        validateFactor(beta);
+        return g;
+    }
+
+    template <typename GraphType, typename ReverseType>
+    void bfs(const GraphType& g, const ReverseType& reverse, const int s, const double alpha, const double beta) {
+        const int V = g.V();
+        std::vector<char> inFrontier(V, 0);
+        std::vector<int> frontier{s};
+        std::vector<int> next;
+
+        long long unexploredEdges = 0;  // m_u
+        for (int v = 0; v < V; ++v) {
+            unexploredEdges += static_cast<long long>(g.adj(v).size());
+        }
+        long long frontierEdges = static_cast<long long>(g.adj(s).size());  // m_f
+        unexploredEdges -= frontierEdges;
+
+        marked[s] = true;
+        distTo_[s] = 0;
+        bool bottomUp = false;
+
+        while (!frontier.empty()) {
+            if (!bottomUp) {
+                bottomUp = static_cast<double>(frontierEdges) * alpha > static_cast<double>(unexploredEdges);
+            } else {
+                bottomUp = !(static_cast<double>(frontier.size()) * beta < static_cast<double>(V));
+            }
+
+            next.clear();
+            if (bottomUp) {
+                ++bottomUpSteps_;
+                for (const int v : frontier) inFrontier[v] = 1;
+                for (int v = 0; v < V; ++v) {
+                    if (marked[v]) continue;
+                    for (const int u : reverse.adj(v)) {
+                        ++edgesExamined_;
+                        if (inFrontier[u]) {
+                            edgeTo[v] = u;
+                            distTo_[v] = distTo_[u] + 1;
+                            next.push_back(v);
+                            break;
+                        }
+                    }
+                }
+                // Mark after the sweep so vertices found on this level cannot act as parents
+                for (const int v : next) marked[v] = true;
+                for (const int v : frontier) inFrontier[v] = 0;
+            } else {
+                ++topDownSteps_;
+                for (const int v : frontier) {
+                    for (const int w : g.adj(v)) {
+                        ++edgesExamined_;
+                        if (!marked[w]) {
+                            edgeTo[w] = v;
+                            distTo_[w] = distTo_[v] + 1;
+                            marked[w] = true;
+                            next.push_back(w);
+                        }
+                    }
+                }
+            }
+
+            frontierEdges = 0;
+            for (const int v : next) {
+                frontierEdges += static_cast<long long>(g.adj(v).size());
+            }
+            unexploredEdges -= frontierEdges;
+            frontier.swap(next);
+        }
+    }
+
+    // Validate vertex index is within bounds
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= static_cast<int>(marked.size())) {
+            throw std::invalid_argument("Vertex out of range");
+        }
+    }
+
+public:
+    /**
+     * Finds shortest paths from s, using g.reverse() for bottom-up steps
+     * (or g itself if it is undirected).
+     *
+     * @param g the graph
+     * @param s the source vertex
+     * @param alpha top-down -> bottom-up switching factor (0 = never go bottom-up)
+     * @param beta bottom-up -> top-down switching factor
+     * @throws std::invalid_argument if s is invalid or a factor is negative
+     */
+    template <typename GraphType>
+    DirectionOptimizingBFS(const GraphType& g, const int s, const double alpha = 15.0, const double beta = 18.0) :
+        DirectionOptimizingBFS(g, reverseOf(validateArguments(g, s, alpha, beta), 0), s, alpha, beta) {}
+
+    /**
+     * Finds shortest paths from s with a precomputed reverse graph.
+     *
+     * @param g the graph
+     * @param reverse the reverse of g (adj(v) lists the vertices with an edge to v)
+     * @param s the source vertex
+     * @param alpha top-down -> bottom-up switching factor (0 = never go bottom-up)
+     * @param beta bottom-up -> top-down switching factor
+     * @throws std::invalid_argument if s is invalid, a factor is negative or the vertex counts differ
+     */
+    template <typename GraphType, typename ReverseType,
+              typename = std::enable_if_t<!std::is_arithmetic_v<ReverseType>>>
+    DirectionOptimizingBFS(const GraphType& g, const ReverseType& reverse, const int s,
+                           const double alpha = 15.0, const double beta = 18.0) :
+        marked(g.V(), false),
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<int>::max()),
+        source(s) {
+        validateVertex(s);
+        if (reverse.V() != g.V()) {
+            throw std::invalid_argument("Reverse graph must have the same number of vertices");
+        }
+        bfs(g, reverse, s, validateFactor(alpha), validateFactor(beta));
+    }
+
+    // Is there a path from source to vertex v?
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return marked[v];
+    }
+
+    // Return shortest distance from source to vertex v
+    int distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    // Return a shortest path from source to vertex v (empty if no path exists)
+    std::vector<int> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<int>{};
+
+        std::vector<int> path;
+        for (int x = v; x != source; x = edgeTo[x]) {
+            path.push_back(x);
+        }
+        path.push_back(source);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Number of edges inspected during the search
+    long long edgesExamined() const { return edgesExamined_; }
+
+    // Number of BFS levels expanded top-down
+    int topDownSteps() const { return topDownSteps_; }
+
+    // Number of BFS levels expanded bottom-up
+    int bottomUpSteps() const { return bottomUpSteps_; }
+};
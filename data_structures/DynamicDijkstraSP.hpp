@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "IndexMinPQ.hpp"
+
+/**
+ * Single-source shortest paths that are kept up to date while edge weights
+ * change, in the style of Ramalingam and Reps.
+ *
+ * The structure owns a copy of the digraph with mutable weights. A batch of
+ * updates sets the weight of edges v -> w (inserting the edge if it is
+ * absent) and then repairs only the part of the shortest path tree that the
+ * batch can change:
+ *
+ * 1. Increases: if an increased edge is the tree edge into w, every vertex
+ *    in w's subtree may now be farther away. The subtrees are collected and
+ *    their distances reset; each affected vertex then takes the best
+ *    distance offered by its incoming edges from unaffected vertices.
+ * 2. Decreases and insertions: an edge v -> w that now beats distTo(w)
+ *    lowers w's distance.
+ * 3. Every vertex changed in steps 1 and 2 is put on one IndexMinPQ, and a
+ *    Dijkstra pass from those vertices propagates the changes. A vertex
+ *    whose distance does not change is never visited.
+ *
+ * The work per batch is proportional to the changed region and its incident
+ * edges rather than to the whole graph; touchedCount() reports the number of
+ * vertices the last batch reset or relaxed.
+ *
+ * Parallel edges are reduced to the lightest one when the digraph is
+ * copied, so an edge is identified by its endpoints. Weights must stay
+ * non-negative. Edges cannot be removed, but raising a weight to the
+ * maximum double value has the same effect on distances.
+ *
+ * Time complexity: O((E + V) log V) to build;
+ *                  O((V' + E') log V') per batch, over the V' vertices it touches and their edges
+ * Space complexity: O(V + E)
+ */
+class DynamicDijkstraSP {
+    struct Arc {
+        int from;
+        int to;
+        double weight;
+    };
+
+    static constexpr double INF = std::numeric_limits<double>::max();
+
+    int V_;
+    int s;
+    std::vector<Arc> arcs;                       // arcs[i] = edge with id i
+    std::vector<std::vector<int>> out;           // out[v] = ids of the edges leaving v
+    std::vector<std::vector<int>> in;            // in[v] = ids of the edges entering v
+    std::unordered_map<std::int64_t, int> ids;   // ids[key(v, w)] = id of edge v -> w
+    std::vector<double> distTo_;                 // distTo_[v] = length of shortest path from s to v
+    std::vector<int> edgeTo;                     // edgeTo[v] = id of last edge on shortest path to v, or -1
+    IndexMinPQ<double> pq;
+    std::vector<int> mark;                       // mark[v] = last batch that touched v
+    std::vector<bool> affected;                  // affected[v] = v's tree path used an increased edge
+    int batch = 0;                               // number of batches applied
+    int touched = 0;                             // vertices touched by the last batch
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    std::int64_t key(const int v, const int w) const {
+        return static_cast<std::int64_t>(v) * V_ + w;
+    }
+
+    void touch(const int v) {
+        if (mark[v] != batch) {
+            mark[v] = batch;
+            ++touched;
+        }
+    }
+
+    // Lowers w's distance to d through edge id, queueing w for the propagation pass
+    void lower(const int w, const double d, const int id) {
+        distTo_[w] = d;
+        edgeTo[w] = id;
+        touch(w);
+        if (pq.contains(w)) {
+            pq.decreaseKey(w, d);
+        } else {
+            pq.insert(w, d);
+        }
+    }
+
+    void relax(const int id) {
+        const Arc& a = arcs[id];
+        if (distTo_[a.from] == INF) return;
+        const double candidate = distTo_[a.from] + a.weight;
+        if (distTo_[a.to] > candidate) lower(a.to, candidate, id);
+    }
+
+    // Dijkstra pass over the vertices on the queue
+    void propagate() {
+        while (!pq.empty()) {
+            const int v = pq.removeMin();
+            for (const int id : out[v]) relax(id);
+        }
+    }
+
+    // Resets the subtrees below the given tree edges and reconnects them from unaffected vertices
+    void repairIncreases(const std::vector<int>& increased) {
+        std::vector<int> stack;
+        std::vector<int> subtree;
+        for (const int id : increased) {
+            const int w = arcs[id].to;
+            if (edgeTo[w] == id && !affected[w]) {
+                affected[w] = true;
+                stack.push_back(w);
+            }
+        }
+        while (!stack.empty()) {
+            const int v = stack.back();
+            stack.pop_back();
+            subtree.push_back(v);
+            for (const int id : out[v]) {
+                const int x = arcs[id].to;
+                if (edgeTo[x] == id && !affected[x]) {
+                    affected[x] = true;
+                    stack.push_back(x);
+                }
+            }
+        }
+
+        for (const int v : subtree) {
+            distTo_[v] = INF;
+            edgeTo[v] = -1;
+            touch(v);
+        }
+        for (const int v : subtree) {
+            double best = INF;
+            int bestId = -1;
+            for (const int id : in[v]) {
+                const int u = arcs[id].from;
+                if (affected[u] || distTo_[u] == INF) continue;
+                const double candidate = distTo_[u] + arcs[id].weight;
+                if (candidate < best) {
+                    best = candidate;
+                    bestId = id;
+                }
+            }
+            if (bestId != -1) lower(v, best, bestId);
+        }
+        for (const int v : subtree) affected[v] = false;
+    }
+
+public:
+    /**
+     * Copies the digraph and computes shortest paths from s.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @throws std::invalid_argument if any edge has negative weight or s is invalid
+     */
+    DynamicDijkstraSP(const EdgeWeightedDigraph& g, const int s) :
+        V_(g.V()),
+        s(s),
+        out(g.V()),
+        in(g.V()),
+        distTo_(g.V(), INF),
+        edgeTo(g.V(), -1),
+        pq(g.V()),
+        mark(g.V(), 0),
+        affected(g.V(), false) {
+
+        validateVertex(s);
+        for (int v = 0; v < V_; ++v) {
+            for (const DirectedEdge& e : g.adj(v)) {
+                if (e.weight() < 0) {
+                    throw std::invalid_argument("Edge has negative weight");
+                }
+                const auto [it, inserted] = ids.try_emplace(key(v, e.to()), static_cast<int>(arcs.size()));
+                if (inserted) {
+                    arcs.push_back({v, e.to(), e.weight()});
+                    out[v].push_back(it->second);
+                    in[e.to()].push_back(it->second);
+                } else {
+                    arcs[it->second].weight = std::min(arcs[it->second].weight, e.weight());
+                }
+            }
+        }
+
+        ++batch;
+        distTo_[s] = 0.0;
+        touch(s);
+        pq.insert(s, 0.0);
+        propagate();
+    }
+
+    /**
+     * Sets the weight of every edge in the batch, inserting the edges that are
+     * absent, and repairs the shortest path tree. If an edge appears more than
+     * once, its last weight wins.
+     *
+     * @param updates edges v -> w carrying their new weights
+     * @return the number of vertices whose distance was reset or relaxed
+     * @throws std::invalid_argument if an update has a negative weight or an
+     *         invalid vertex; the batch is then not applied
+     */
+    int update(const std::vector<DirectedEdge>& updates) {
+        for (const DirectedEdge& e : updates) {
+            validateVertex(e.from());
+            validateVertex(e.to());
+            if (e.weight() < 0) {
+                throw std::invalid_argument("Edge has negative weight");
+            }
+        }
+
+        ++batch;
+        touched = 0;
+
+        // Apply the weights, remembering each changed edge's weight before the batch
+        std::vector<int> changed;
+        std::vector<double> before;
+        std::unordered_map<int, int> position;  // position[id] = index of id in changed
+        for (const DirectedEdge& e : updates) {
+            const auto [it, inserted] = ids.try_emplace(key(e.from(), e.to()), static_cast<int>(arcs.size()));
+            const int id = it->second;
+            if (inserted) {
+                arcs.push_back({e.from(), e.to(), INF});
+                out[e.from()].push_back(id);
+                in[e.to()].push_back(id);
+            }
+            if (position.try_emplace(id, static_cast<int>(changed.size())).second) {
+                changed.push_back(id);
+                before.push_back(arcs[id].weight);
+            }
+            arcs[id].weight = e.weight();
+        }
+
+        std::vector<int> increased;
+        for (std::size_t i = 0; i < changed.size(); ++i) {
+            if (arcs[changed[i]].weight > before[i]) increased.push_back(changed[i]);
+        }
+        repairIncreases(increased);
+        for (std::size_t i = 0; i < changed.size(); ++i) {
+            if (arcs[changed[i]].weight < before[i]) relax(changed[i]);
+        }
+        propagate();
+        return touched;
+    }
+
+    /**
+     * Sets the weight of edge v -> w, inserting it if absent, and repairs the
+     * shortest path tree.
+     *
+     * @param e the edge carrying its new weight
+     * @return the number of vertices whose distance was reset or relaxed
+     * @throws std::invalid_argument if the weight is negative or a vertex is invalid
+     */
+    int update(const DirectedEdge& e) {
+        return update(std::vector<DirectedEdge>{e});
+    }
+
+    /**
+     * Returns the length of the shortest path from the source to v.
+     *
+     * @return the distance, or the maximum double value if v is unreachable
+     * @throws std::invalid_argument if v is invalid
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] < INF;
+    }
+
+    /**
+     * Returns the shortest path from the source to v, with current weights,
+     * or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if v is invalid
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (int id = edgeTo[v]; id != -1; id = edgeTo[arcs[id].from]) {
+            path.emplace_back(arcs[id].from, arcs[id].to, arcs[id].weight);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    /**
+     * Returns the current weight of edge v -> w.
+     *
+     * @return the weight, or the maximum double value if there is no such edge
+     * @throws std::invalid_argument if v or w is invalid
+     */
+    double weight(const int v, const int w) const {
+        validateVertex(v);
+        validateVertex(w);
+        const auto it = ids.find(key(v, w));
+        return it == ids.end() ? INF : arcs[it->second].weight;
+    }
+
+    // Copy of the digraph with its current weights
+    EdgeWeightedDigraph digraph() const {
+        EdgeWeightedDigraph g(V_);
+        for (const Arc& a : arcs) g.addEdge(DirectedEdge(a.from, a.to, a.weight));
+        return g;
+    }
+
+    // Number of vertices reset or relaxed by the last batch (all reachable vertices after construction)
+    int touchedCount() const { return touched; }
+
+    int source() const { return s; }
+
+    int V() const { return V_; }
+
+    // Number of distinct edges
+    int E() const { return static_cast<int>(arcs.size()); }
+};
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <exception>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CSRDigraph.hpp"
+#include "CSREdgeWeightedDigraph.hpp"
+#include "DirectedEdge.hpp"
+
+/**
+ * Bulk loader for directed graphs stored as text edge lists.
+ *
+ * Input format: one edge per line, "v w" for unweighted digraphs or
+ * "v w weight" for edge-weighted digraphs. Fields may be separated by spaces,
+ * tabs or commas (so CSV works as is). Blank lines and lines starting with
+ * '#' or '%' are skipped, and columns after the ones needed are ignored.
+ *
+ * The input is read in fixed-size chunks and parsed in one pass into a flat
+ * edge array; the graph is then built with a count-then-fill pass into CSR
+ * storage sized exactly to V + 1 offsets and E edges. No per-edge allocation
+ * or per-edge vertex validation through addEdge takes place.
+ *
+ * The parallel variants read the whole input into memory, split it at line
+ * boundaries into one range per thread and parse the ranges concurrently.
+ * Edge order, and therefore the resulting graph, is identical to the
+ * sequential variants.
+ *
+ * If the vertex count is not given, it is taken as one more than the largest
+ * vertex id in the input.
+ */
+class EdgeListReader {
+    static constexpr std::size_t CHUNK_SIZE = 1 << 20;  // bytes read from the stream at a time
+
+    static bool isSeparator(const char c) {
+        return c == ' ' || c == '\t' || c == ',' || c == '\r';
+    }
+
+    static const char* skipSeparators(const char* p, const char* end) {
+        while (p != end && isSeparator(*p)) ++p;
+        return p;
+    }
+
+    [[noreturn]] static void malformed(const char* begin, const char* end) {
+        throw std::invalid_argument("Malformed edge line: '" + std::string(begin, end) + "'");
+    }
+
+    // Parses one field at p; the field must be followed by a separator or the end of the line
+    template <typename T>
+    static const char* parseField(const char* p, const char* end, T& value, const char* lineBegin) {
+        p = skipSeparators(p, end);
+        const auto [next, ec] = std::from_chars(p, end, value);
+        if (ec != std::errc() || (next != end && !isSeparator(*next))) malformed(lineBegin, end);
+        return next;
+    }
+
+    static void parseLine(const char* begin, const char* end, std::vector<std::pair<int, int>>& edges) {
+        const char* p = skipSeparators(begin, end);
+        if (p == end || *p == '#' || *p == '%') return;
+
+        int v, w;
+        p = parseField(p, end, v, begin);
+        parseField(p, end, w, begin);
+        edges.emplace_back(v, w);
+    }
+
+    static void parseLine(const char* begin, const char* end, std::vector<DirectedEdge>& edges) {
+        const char* p = skipSeparators(begin, end);
+        if (p == end || *p == '#' || *p == '%') return;
+
+        int v, w;
+        double weight;
+        p = parseField(p, end, v, begin);
+        p = parseField(p, end, w, begin);
+        parseField(p, end, weight, begin);
+        edges.emplace_back(v, w, weight);
+    }
+
+    // Parses every line in [begin, end); the last line need not end with '\n'
+    template <typename EdgeType>
+    static void parseRange(const char* begin, const char* end, std::vector<EdgeType>& edges) {
+        while (begin != end) {
+            const char* newline = std::find(begin, end, '\n');
+            parseLine(begin, newline, edges);
+            begin = newline == end ? end : newline + 1;
+        }
+    }
+
+    // Single pass over the stream in CHUNK_SIZE reads, carrying partial lines between chunks
+    template <typename EdgeType>
+    static std::vector<EdgeType> parseStream(std::istream& in) {
+        std::vector<EdgeType> edges;
+        std::vector<char> buffer(CHUNK_SIZE);
+        std::string carry;  // incomplete line left over from the previous chunk
+
+        while (in) {
+            in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            const char* p = buffer.data();
+            const char* end = p + in.gcount();
+            if (p == end) break;
+
+            const char* firstNewline = std::find(p, end, '\n');
+            if (firstNewline == end) {
+                carry.append(p, end);
+                continue;
+            }
+            carry.append(p, firstNewline);
+            parseLine(carry.data(), carry.data() + carry.size(), edges);
+            carry.clear();
+
+            const char* lastNewline = end - 1;
+            while (*lastNewline != '\n') --lastNewline;
+            parseRange(firstNewline + 1, lastNewline + 1, edges);
+            carry.assign(lastNewline + 1, end);
+        }
+        parseLine(carry.data(), carry.data() + carry.size(), edges);
+        return edges;
+    }
+
+    template <typename EdgeType>
+    static std::vector<EdgeType> parseParallel(std::istream& in, const int threads) {
+        if (threads < 1) throw std::invalid_argument("Number of threads must be positive");
+
+        std::string text;
+        std::vector<char> buffer(CHUNK_SIZE);
+        while (in) {
+            in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            text.append(buffer.data(), static_cast<std::size_t>(in.gcount()));
+        }
+
+        // Split into one range per thread, moving each boundary past the next newline
+        const char* data = text.data();
+        const char* end = data + text.size();
+        std::vector<const char*> bounds{data};
+        for (int i = 1; i < threads; ++i) {
+            const char* b = std::max(bounds.back(), data + text.size() * i / threads);
+            if (b != data && b != end && *(b - 1) != '\n') {
+                b = std::find(b, end, '\n');
+                if (b != end) ++b;
+            }
+            bounds.push_back(b);
+        }
+        bounds.push_back(end);
+
+        std::vector<std::vector<EdgeType>> parts(threads);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back([&, i] {
+                try {
+                    parseRange(bounds[i], bounds[i + 1], parts[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (std::thread& t : workers) t.join();
+        for (const std::exception_ptr& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+
+        std::size_t total = 0;
+        for (const auto& part : parts) total += part.size();
+        std::vector<EdgeType> edges;
+        edges.reserve(total);
+        for (const auto& part : parts) edges.insert(edges.end(), part.begin(), part.end());
+        return edges;
+    }
+
+    static int vertexCount(const std::vector<std::pair<int, int>>& edges, const int v) {
+        if (v >= 0) return v;
+        int maxVertex = -1;
+        for (const auto& [from, to] : edges) maxVertex = std::max({maxVertex, from, to});
+        return maxVertex + 1;
+    }
+
+    static int vertexCount(const std::vector<DirectedEdge>& edges, const int v) {
+        if (v >= 0) return v;
+        int maxVertex = -1;
+        for (const DirectedEdge& e : edges) maxVertex = std::max({maxVertex, e.from(), e.to()});
+        return maxVertex + 1;
+    }
+
+public:
+    /**
+     * Reads an unweighted edge list into a CSRDigraph.
+     *
+     * @param in the input stream
+     * @param v the number of vertices, or -1 to infer it from the largest vertex id
+     * @throws std::invalid_argument on a malformed line or an out-of-range vertex
+     */
+    static CSRDigraph readDigraph(std::istream& in, const int v = -1) {
+        const auto edges = parseStream<std::pair<int, int>>(in);
+        return CSRDigraph(vertexCount(edges, v), edges);
+    }
+
+    /**
+     * Reads an unweighted edge list into a CSRDigraph, parsing with several threads.
+     *
+     * @param in the input stream
+     * @param threads the number of parser threads (at least 1)
+     * @param v the number of vertices, or -1 to infer it from the largest vertex id
+     * @throws std::invalid_argument on a malformed line, an out-of-range vertex or threads < 1
+     */
+    static CSRDigraph readDigraphParallel(std::istream& in, const int threads, const int v = -1) {
+        const auto edges = parseParallel<std::pair<int, int>>(in, threads);
+        return CSRDigraph(vertexCount(edges, v), edges);
+    }
+
+    /**
+     * Reads a weighted edge list into a CSREdgeWeightedDigraph.
+     *
+     * @param in the input stream
+     * @param v the number of vertices, or -1 to infer it from the largest vertex id
+     * @throws std::invalid_argument on a malformed line or an out-of-range vertex
+     */
+    static CSREdgeWeightedDigraph readEdgeWeightedDigraph(std::istream& in, const int v = -1) {
+        const auto edges = parseStream<DirectedEdge>(in);
+        return CSREdgeWeightedDigraph(vertexCount(edges, v), edges);
+    }
+
+    /**
+     * Reads a weighted edge list into a CSREdgeWeightedDigraph, parsing with several threads.
+     *
+     * @param in the input stream
+     * @param threads the number of parser threads (at least 1)
+     * @param v the number of vertices, or -1 to infer it from the largest vertex id
+     * @throws std::invalid_argument on a malformed line, an out-of-range vertex or threads < 1
+     */
+    static CSREdgeWeightedDigraph readEdgeWeightedDigraphParallel(std::istream& in, const int threads,
+                                                                  const int v = -1) {
+        const auto edges = parseParallel<DirectedEdge>(in, threads);
+        return CSREdgeWeightedDigraph(vertexCount(edges, v), edges);
+    }
+};
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <vector>
 
+#include "AdjacencyView.hpp"
 #include "DirectedEdge.hpp"
 
 /**
@@ -152,14 +153,16 @@ public:
 
     /**
      * Returns the directed edges incident from vertex v.
+     * The view does not copy the edges; assign it to a std::vector<DirectedEdge>
+     * when an independent copy is needed.
      *
      * @param v the vertex
-     * @return the directed edges incident from vertex v as a vector
+     * @return a non-owning view of the directed edges incident from vertex v
      * @throws std::invalid_argument if vertex is invalid
      */
-    std::vector<DirectedEdge> adj(const int v) const {
+    AdjacencyView<std::list<DirectedEdge>::const_iterator> adj(const int v) const {
         validateVertex(v);
-        return std::vector<DirectedEdge>{adj_[v].begin(), adj_[v].end()};
+        return {adj_[v].begin(), adj_[v].end(), adj_[v].size()};
     }
 
     /**
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+
+/**
+ * Detects directed cycles in an edge-weighted digraph using depth-first search
+ * and returns one as a sequence of directed edges.
+ *
+ * A directed cycle exists when DFS finds an edge to a vertex that is still on
+ * the DFS stack. The search keeps an explicit stack of (vertex, next edge)
+ * frames rather than recursing, so it handles long paths such as the
+ * predecessor chains that Bellman-Ford checks for negative cycles.
+ *
+ * Time complexity: O(V + E)
+ * Space complexity: O(V)
+ */
+class EdgeWeightedDirectedCycle {
+    std::vector<DirectedEdge> cycle_;  // edges of the directed cycle in order (empty if no cycle)
+
+    // Iterative DFS from s; stops as soon as a cycle is found
+    template <typename GraphType, typename Iterator>
+    void dfs(const GraphType& g, const int s, std::vector<bool>& marked, std::vector<bool>& onStack,
+             std::vector<std::optional<DirectedEdge>>& edgeTo) {
+        std::vector<std::pair<int, std::pair<Iterator, Iterator>>> stack;
+        const auto push = [&](const int v) {
+            marked[v] = true;
+            onStack[v] = true;
+            const auto adj = g.adj(v);
+            stack.push_back({v, {adj.begin(), adj.end()}});
+        };
+
+        push(s);
+        while (!stack.empty()) {
+            const int v = stack.back().first;
+            auto& [next, end] = stack.back().second;
+            if (next == end) {
+                onStack[v] = false;
+                stack.pop_back();
+                continue;
+            }
+
+            const DirectedEdge e = *next;
+            ++next;
+            const int w = e.to();
+            if (!marked[w]) {
+                edgeTo[w] = e;
+                push(w);
+            } else if (onStack[w]) {
+                // Back edge: walk the tree edges from v back to w, then close with e
+                std::optional<DirectedEdge> f = e;
+                for (; f->from() != w; f = edgeTo[f->from()]) {
+                    cycle_.push_back(*f);
+                }
+                cycle_.push_back(*f);
+                std::reverse(cycle_.begin(), cycle_.end());
+                assert(check());
+                return;
+            }
+        }
+    }
+
+    // Verify that consecutive edges connect and the last edge returns to the start
+    bool check() const {
+        for (size_t i = 0; i < cycle_.size(); ++i) {
+            const DirectedEdge& next = cycle_[(i + 1) % cycle_.size()];
+            if (cycle_[i].to() != next.from()) return false;
+        }
+        return true;
+    }
+
+public:
+    // Constructor: find a directed cycle in the edge-weighted digraph
+    template <typename GraphType>
+    explicit EdgeWeightedDirectedCycle(const GraphType& g) {
+        using Iterator = decltype(g.adj(0).begin());
+        std::vector<bool> marked(g.V(), false);
+        std::vector<bool> onStack(g.V(), false);
+        std::vector<std::optional<DirectedEdge>> edgeTo(g.V());
+
+        for (int v = 0; v < g.V() && cycle_.empty(); ++v) {
+            if (!marked[v]) {
+                dfs<GraphType, Iterator>(g, v, marked, onStack, edgeTo);
+            }
+        }
+    }
+
+    // Returns true if the digraph contains a directed cycle
+    bool hasCycle() const {
+        return !cycle_.empty();
+    }
+
+    // Returns the edges of a directed cycle in order (empty if no cycle exists)
+    std::vector<DirectedEdge> cycle() const {
+        return cycle_;
+    }
+};
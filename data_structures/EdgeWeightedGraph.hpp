@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <vector>
 
+#include "AdjacencyView.hpp"
 #include "Edge.hpp"
 
 /**
@@ -102,10 +103,10 @@ public:
     }
 
     // Get all edges incident to vertex v
-    // Returns a vector copy for safe iteration (caller can modify without affecting graph)
-    std::vector<Edge> adj(const int v) const {
+    // Returns a non-owning view; assign it to a std::vector<Edge> for an independent copy
+    AdjacencyView<std::list<Edge>::const_iterator> adj(const int v) const {
         validateVertex(v);
-        return std::vector<Edge>{adj_[v].begin(), adj_[v].end()};
+        return {adj_[v].begin(), adj_[v].end(), adj_[v].size()};
     }
 
     // Get the degree of vertex v (number of incident edges)
@@ -121,7 +122,6 @@ public:
         allEdges.reserve(E_);
 
         for (int v = 0; v < V_; ++v) {
-            int selfLoops = 0;
             for (const Edge& e : adj_[v]) {
                 const int w = e.other(v);
 
@@ -131,11 +131,8 @@ public:
                     allEdges.push_back(e);
                 }
                 else if (w == v) {
-                    // Self-loop: include every other occurrence to avoid duplicates
-                    if (selfLoops % 2 == 0) {
-                        allEdges.push_back(e);
-                    }
-                    ++selfLoops;
+                    // Self-loop: addEdge stores it only once, so include every occurrence
+                    allEdges.push_back(e);
                 }
                 // If w < v, skip (edge already included when processing vertex w)
             }
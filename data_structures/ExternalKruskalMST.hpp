@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Edge.hpp"
+#include "GraphFile.hpp"
+#include "WeightedQuickUnionPathCompressionUF.hpp"
+
+/**
+ * Computes a minimum spanning forest of an edge-weighted undirected graph
+ * whose edges are read from a binary file, without ever holding all of
+ * them in memory (semi-external Kruskal).
+ *
+ * An edge file is a plain sequence of GraphFileEdgeRecord structs
+ * {int32 v, int32 w, double weight} in native byte order, one per edge and
+ * with no header. writeEdgeFile() produces one from a graph or an edge list,
+ * but anything that appends records will do.
+ *
+ * The algorithm is an external merge sort fused with Kruskal's scan:
+ * 1. The file is read in runs of at most runEdges edges. Each run is sorted
+ *    by weight and written to a temporary file.
+ * 2. Runs are merged FAN_IN at a time as soon as FAN_IN of them build up at
+ *    one level, cascading upward like a counter in base FAN_IN, so at most
+ *    about FAN_IN temporary files per level are open at once. The last merge,
+ *    over what is left at every level, feeds Kruskal's scan with Union-Find.
+ * By the cycle property, an edge that closes a cycle within its own run
+ * cannot be in the minimum spanning forest of the whole graph. So a run of
+ * at least V edges is reduced to its own spanning forest before it is
+ * written, and intermediate merges do the same. Each temporary file then
+ * holds at most V - 1 edges, and the I/O after the first read is O(V) per
+ * run rather than O(E).
+ *
+ * Memory: the Union-Find structure (O(V)), one run buffer of runEdges edges
+ * and FAN_IN merge buffers of BUFFER_EDGES edges. Open temporary files:
+ * O(FAN_IN * log_FAN_IN(runs)). If the whole file fits in
+ * one run, nothing is written to disk. Temporary files come from
+ * std::tmpfile and are removed when they are closed, even on an exception.
+ *
+ * Ties are broken by position in the file (a stable sort), so for distinct
+ * weights the forest is exactly the one KruskalMST computes, and in any case
+ * it has the same total weight.
+ *
+ * Time complexity: O(E log E) comparisons; O(E + V * runs) edges of I/O
+ * Space complexity: O(V + runEdges) in memory
+ */
+class ExternalKruskalMST {
+public:
+    static constexpr std::size_t DEFAULT_RUN_EDGES = std::size_t{1} << 22;  // 64 MiB of records
+
+private:
+    static constexpr std::size_t FAN_IN = 64;                      // runs merged at a time
+    static constexpr std::size_t BUFFER_EDGES = std::size_t{1} << 12;  // read buffer per merged run
+
+    using Record = GraphFileEdgeRecord;
+    using File = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
+
+    int V_;
+    double weight_ = 0.0;
+    std::vector<Edge> mst;      // edges in the forest, in Kruskal order
+    int runs_ = 0;              // runs the file was split into
+    long long spilled_ = 0;     // edges written to temporary files, over all passes
+
+    // Buffered sequential reader over one sorted run
+    class RunReader {
+        std::FILE* file_;
+        std::vector<Record> buffer_;
+        std::size_t next_ = 0;
+
+    public:
+        explicit RunReader(std::FILE* file) : file_(file) {
+            std::rewind(file_);
+            buffer_.reserve(BUFFER_EDGES);
+            refill();
+        }
+
+        bool done() const { return next_ == buffer_.size(); }
+
+        const Record& current() const { return buffer_[next_]; }
+
+        void advance() {
+            if (++next_ == buffer_.size()) refill();
+        }
+
+    private:
+        void refill() {
+            buffer_.resize(BUFFER_EDGES);
+            const std::size_t n = std::fread(buffer_.data(), sizeof(Record), BUFFER_EDGES, file_);
+            if (n < BUFFER_EDGES && std::ferror(file_)) throw std::runtime_error("Failed reading temporary run file");
+            buffer_.resize(n);
+            next_ = 0;
+        }
+    };
+
+    static File temporaryFile() {
+        File file(std::tmpfile(), &std::fclose);
+        if (!file) throw std::runtime_error("Cannot create temporary run file");
+        return file;
+    }
+
+    void write(std::FILE* file, const Record* records, const std::size_t count) {
+        if (std::fwrite(records, sizeof(Record), count, file) != count) {
+            throw std::runtime_error("Failed writing temporary run file");
+        }
+        spilled_ += static_cast<long long>(count);
+    }
+
+    // Calls emit(record) for the records of a run sorted by weight that join a
+    // spanning forest of it, in order; stops once the forest spans
+    template <typename Emit>
+    void kruskal(const Record* first, const Record* last, Emit&& emit) const {
+        WeightedQuickUnionPathCompressionUF uf(V_);
+        int joined = 0;
+        for (; first != last && joined < V_ - 1; ++first) {
+            const int rootV = uf.find(first->v), rootW = uf.find(first->w);
+            if (rootV == rootW) continue;
+            uf.unite(rootV, rootW);
+            emit(*first);
+            ++joined;
+        }
+    }
+
+    // Merges sorted runs, which hold consecutive slices of the file in order,
+    // into one stream sorted by (weight, position in the file). emit(record)
+    // returns false to stop early
+    template <typename Emit>
+    static void merge(const std::vector<File>& runs, const std::size_t first, const std::size_t last, Emit&& emit) {
+        std::vector<RunReader> readers;
+        readers.reserve(last - first);
+        for (std::size_t i = first; i < last; ++i) readers.emplace_back(runs[i].get());
+
+        // Min-heap of reader indices; equal weights come from the earlier run first
+        const auto after = [&readers](const std::size_t a, const std::size_t b) {
+            const double wa = readers[a].current().weight, wb = readers[b].current().weight;
+            return wa > wb || (wa == wb && a > b);
+        };
+        std::vector<std::size_t> heap;
+        for (std::size_t i = 0; i < readers.size(); ++i) {
+            if (!readers[i].done()) heap.push_back(i);
+        }
+        std::make_heap(heap.begin(), heap.end(), after);
+
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), after);
+            RunReader& reader = readers[heap.back()];
+            if (!emit(reader.current())) return;
+            reader.advance();
+            if (reader.done()) {
+                heap.pop_back();
+            } else {
+                std::push_heap(heap.begin(), heap.end(), after);
+            }
+        }
+    }
+
+    // Merges runs[first, last) and reduces the result to its spanning forest
+    File mergeToRun(const std::vector<File>& runs, const std::size_t first, const std::size_t last) {
+        File out = temporaryFile();
+        WeightedQuickUnionPathCompressionUF uf(V_);
+        int joined = 0;
+        merge(runs, first, last, [&](const Record& r) {
+            const int rootV = uf.find(r.v), rootW = uf.find(r.w);
+            if (rootV != rootW) {
+                uf.unite(rootV, rootW);
+                write(out.get(), &r, 1);
+                ++joined;
+            }
+            return joined < V_ - 1;
+        });
+        std::fflush(out.get());
+        return out;
+    }
+
+    // Adds a run to levels[level], merging a full level into the next one up.
+    // Every level holds consecutive slices of the file in order, and higher
+    // levels hold earlier slices
+    void pushRun(std::vector<std::vector<File>>& levels, File run) {
+        for (std::size_t level = 0;; ++level) {
+            if (level == levels.size()) levels.emplace_back();
+            levels[level].push_back(std::move(run));
+            if (levels[level].size() < FAN_IN) return;
+            run = mergeToRun(levels[level], 0, FAN_IN);
+            levels[level].clear();
+        }
+    }
+
+    void validateRecord(const Record& r, const std::string& path) const {
+        if (r.v < 0 || r.v >= V_ || r.w < 0 || r.w >= V_) {
+            throw std::invalid_argument("Edge " + std::to_string(r.v) + "-" + std::to_string(r.w) + " in " + path +
+                                        " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    void add(const Record& r) {
+        mst.emplace_back(r.v, r.w, r.weight);
+        weight_ += r.weight;
+    }
+
+public:
+    /**
+     * Computes the minimum spanning forest of the edges in an edge file.
+     *
+     * @param path the edge file
+     * @param V the number of vertices
+     * @param runEdges the most edges held in memory at once while sorting
+     * @throws std::invalid_argument if V is negative, runEdges is zero or an endpoint is out of range
+     * @throws std::runtime_error if the file cannot be read or its size is not a whole number of edges
+     */
+    ExternalKruskalMST(const std::string& path, const int V, const std::size_t runEdges = DEFAULT_RUN_EDGES) :
+        V_(V) {
+
+        if (V < 0) throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(V));
+        if (runEdges == 0) throw std::invalid_argument("Run size must be positive");
+
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw std::runtime_error("Cannot open edge file " + path);
+        const auto bytes = static_cast<std::size_t>(in.tellg());
+        if (bytes % sizeof(Record) != 0) {
+            throw std::runtime_error("Invalid edge file " + path + ": size " + std::to_string(bytes) +
+                                     " is not a multiple of " + std::to_string(sizeof(Record)));
+        }
+        in.seekg(0);
+        const std::size_t E = bytes / sizeof(Record);
+
+        // Phase 1: sorted runs, each reduced to its own spanning forest if that is smaller
+        std::vector<Record> buffer;
+        buffer.reserve(std::min(E, runEdges));
+        std::vector<std::vector<File>> levels;
+        const auto byWeight = [](const Record& a, const Record& b) { return a.weight < b.weight; };
+
+        for (std::size_t start = 0; start < E; start += runEdges) {
+            buffer.resize(std::min(runEdges, E - start));
+            in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(Record)));
+            if (!in) throw std::runtime_error("Failed reading edge file " + path);
+            for (const Record& r : buffer) validateRecord(r, path);
+            std::stable_sort(buffer.begin(), buffer.end(), byWeight);
+            ++runs_;
+
+            // The whole file fits in one run: no temporary files
+            if (buffer.size() == E) {
+                kruskal(buffer.data(), buffer.data() + E, [this](const Record& r) { add(r); });
+                return;
+            }
+
+            File run = temporaryFile();
+            if (buffer.size() >= static_cast<std::size_t>(V_)) {
+                kruskal(buffer.data(), buffer.data() + buffer.size(),
+                        [&](const Record& r) { write(run.get(), &r, 1); });
+            } else {
+                write(run.get(), buffer.data(), buffer.size());
+            }
+            std::fflush(run.get());
+            pushRun(levels, std::move(run));
+        }
+        std::vector<Record>().swap(buffer);
+
+        // Phase 2: gather what is left in file order, then merge down to FAN_IN runs
+        std::vector<File> runs;
+        for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+            for (File& run : *level) runs.push_back(std::move(run));
+        }
+        levels.clear();
+        while (runs.size() > FAN_IN) {
+            std::vector<File> merged;
+            for (std::size_t first = 0; first < runs.size(); first += FAN_IN) {
+                merged.push_back(mergeToRun(runs, first, std::min(first + FAN_IN, runs.size())));
+            }
+            runs = std::move(merged);
+        }
+
+        // Phase 3: the last merge feeds Kruskal's scan
+        WeightedQuickUnionPathCompressionUF uf(V_);
+        merge(runs, 0, runs.size(), [&](const Record& r) {
+            const int rootV = uf.find(r.v), rootW = uf.find(r.w);
+            if (rootV != rootW) {
+                uf.unite(rootV, rootW);
+                add(r);
+            }
+            return static_cast<int>(mst.size()) < V_ - 1;
+        });
+    }
+
+    /**
+     * Writes the edges of a graph to an edge file, each edge once.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    template <typename GraphType>
+    static void writeEdgeFile(const GraphType& g, const std::string& path) {
+        writeEdgeFile(g.edges(), path);
+    }
+
+    /**
+     * Writes an edge list to an edge file, in order.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void writeEdgeFile(const std::vector<Edge>& edges, const std::string& path) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot create edge file " + path);
+
+        std::vector<Record> buffer;
+        buffer.reserve(std::min(edges.size(), BUFFER_EDGES));
+        for (std::size_t i = 0; i < edges.size(); i += BUFFER_EDGES) {
+            buffer.clear();
+            for (std::size_t j = i; j < std::min(i + BUFFER_EDGES, edges.size()); ++j) {
+                const int v = edges[j].either();
+                buffer.push_back(Record{v, edges[j].other(v), edges[j].weight()});
+            }
+            out.write(reinterpret_cast<const char*>(buffer.data()),
+                      static_cast<std::streamsize>(buffer.size() * sizeof(Record)));
+        }
+        out.close();
+        if (!out) throw std::runtime_error("Failed writing edge file " + path);
+    }
+
+    // Get all edges in the minimum spanning forest, in Kruskal order
+    std::vector<Edge> edges() const {
+        return mst;
+    }
+
+    // Get total weight of the minimum spanning forest
+    double weight() const {
+        return weight_;
+    }
+
+    // Number of sorted runs the edge file was split into
+    int runCount() const { return runs_; }
+
+    // Number of edges written to temporary files, over all merge passes
+    long long spilledCount() const { return spilled_; }
+};
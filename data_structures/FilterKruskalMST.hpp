@@ -0,0 +1,350 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Edge.hpp"
+#include "EdgeWeightedGraph.hpp"
+#include "ThreadPool.hpp"
+
+// How FilterKruskalMST sorts the edges that reach a base case
+enum class KruskalSort {
+    Comparison,  // std::sort on (weight, input position)
+    Radix        // LSD radix sort on the IEEE 754 bit pattern of the weight
+};
+
+/**
+ * Computes a minimum spanning forest of an edge-weighted undirected graph
+ * with the Filter-Kruskal algorithm.
+ *
+ * KruskalMST sorts every edge, although a sparse forest is usually complete
+ * long before the heavy edges are reached. Filter-Kruskal sorts lazily, in
+ * the manner of quicksort:
+ * 1. A range of at most BASE_SIZE edges is sorted and scanned with
+ *    Union-Find, exactly as in Kruskal's algorithm.
+ * 2. A larger range is partitioned around a pivot weight into light and
+ *    heavy edges. The light side is solved first. Heavy edges whose ends are
+ *    now in the same component can never join the forest, so they are
+ *    filtered out before the heavy side is solved.
+ * The algorithm stops as soon as the forest spans a single component, so the
+ * heaviest edges of a dense graph are often never looked at at all.
+ *
+ * Each weight is stored as a 64-bit key that orders like the weight (the
+ * IEEE 754 bits with the sign bit flipped, or all bits flipped for negative
+ * weights). The base-case sort is either std::sort or an LSD radix sort on
+ * that key, which skips the bytes that all keys share. The partitions and
+ * filters run on a ThreadPool: every block of edges is counted, the counts
+ * are prefix-summed and every block is scattered to its own slots, so each
+ * pass is stable and the result does not depend on the number of threads.
+ *
+ * Ties are broken by the edge's position in the input, so the forest is the
+ * same in both sort modes and is the one ParallelBoruvkaMST computes.
+ * Self-loops are ignored and -0.0 is treated as 0.0.
+ *
+ * Time complexity: O(E + V log V log(E / V)) expected with filtering,
+ *                  O(E log E) in the worst case
+ * Space complexity: O(E + V)
+ */
+class FilterKruskalMST {
+    static constexpr int BLOCK_SIZE = 4096;   // edges per unit of parallel work
+    static constexpr int BASE_SIZE = 16384;   // largest range sorted directly
+    static constexpr int SAMPLE_SIZE = 63;    // keys sampled to choose a pivot
+
+    // Edge with its sort key; id indexes the input edges
+    struct Item {
+        std::uint64_t key;
+        int v;
+        int w;
+        int id;
+    };
+
+    std::vector<Edge> input;    // input[id] = edge with that id
+    std::vector<Item> items;    // edges not yet discarded, partitioned in place
+    std::vector<Item> scratch;  // target of partitions and radix passes
+    std::vector<unsigned char> flags;  // flags[i] = items[i] passed the last split
+    std::vector<int> parent;    // Union-Find forest over the vertices
+    std::vector<int> treeSize;  // treeSize[r] = vertices in the tree rooted at r
+    std::vector<Edge> mst;      // edges in the minimum spanning forest, by weight
+    double weight_ = 0.0;       // total weight of the forest
+    int sorted = 0;             // edges sorted by a base case
+    int V_ = 0;                 // number of vertices
+    KruskalSort sortMode;       // how base cases are sorted
+
+    static std::uint64_t keyOf(double weight) {
+        if (weight == 0.0) weight = 0.0;  // -0.0 and 0.0 get the same key
+        std::uint64_t bits;
+        std::memcpy(&bits, &weight, sizeof bits);
+        return (bits >> 63) ? ~bits : bits | (std::uint64_t{1} << 63);
+    }
+
+    // Calls f(b) for every block index b in [0, blocks), spread across the pool
+    template <typename Function>
+    static void forEachBlock(ThreadPool& pool, const int blocks, const Function& f) {
+        if (pool.size() == 1 || blocks <= 1) {
+            for (int b = 0; b < blocks; ++b) f(b);
+            return;
+        }
+        std::atomic<int> nextBlock{0};
+        pool.run([&](int) {
+            for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) f(b);
+        });
+    }
+
+    void validateEdges(const int V) const {
+        if (V < 0) {
+            throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(V));
+        }
+        for (const Edge& e : input) {
+            const int v = e.either(), w = e.other(v);
+            if (v >= V || w >= V) {
+                throw std::invalid_argument("Edge endpoint is out of range [0, " + std::to_string(V) + ")");
+            }
+        }
+    }
+
+    // Root of v without modifying the forest, so it is safe to call from several threads
+    int root(int v) const {
+        while (parent[v] != v) v = parent[v];
+        return v;
+    }
+
+    // Root of v with path halving
+    int find(int v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    bool spanning() const {
+        return static_cast<int>(mst.size()) == V_ - 1;
+    }
+
+    /**
+     * Moves the items of [lo, hi) that satisfy keep to the front of the range,
+     * preserving their order, and returns how many there are. The other items
+     * follow in order if keepRest is true and are discarded otherwise.
+     */
+    template <typename Predicate>
+    int split(ThreadPool& pool, const int lo, const int hi, const Predicate& keep, const bool keepRest) {
+        const int n = hi - lo;
+        if (pool.size() == 1 || n <= BLOCK_SIZE) {
+            // Kept items are compacted in place; only the rest go through scratch
+            int front = lo, back = lo;
+            for (int i = lo; i < hi; ++i) {
+                if (keep(items[i])) {
+                    items[front++] = items[i];
+                } else if (keepRest) {
+                    scratch[back++] = items[i];
+                }
+            }
+            std::copy(scratch.begin() + lo, scratch.begin() + back, items.begin() + front);
+            return front - lo;
+        }
+
+        const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        std::vector<int> kept(blocks + 1, 0);  // kept[b + 1] = items kept in block b
+
+        forEachBlock(pool, blocks, [&](const int b) {
+            const int from = lo + b * BLOCK_SIZE, to = std::min(hi, from + BLOCK_SIZE);
+            int count = 0;
+            for (int i = from; i < to; ++i) {
+                flags[i] = keep(items[i]) ? 1 : 0;
+                count += flags[i];
+            }
+            kept[b + 1] = count;
+        });
+        std::partial_sum(kept.begin(), kept.end(), kept.begin());
+        const int total = kept[blocks];
+
+        forEachBlock(pool, blocks, [&](const int b) {
+            const int from = lo + b * BLOCK_SIZE, to = std::min(hi, from + BLOCK_SIZE);
+            int front = lo + kept[b];
+            int back = lo + total + (from - lo - kept[b]);
+            for (int i = from; i < to; ++i) {
+                if (flags[i]) {
+                    scratch[front++] = items[i];
+                } else if (keepRest) {
+                    scratch[back++] = items[i];
+                }
+            }
+        });
+
+        const int moved = keepRest ? n : total;
+        forEachBlock(pool, (moved + BLOCK_SIZE - 1) / BLOCK_SIZE, [&](const int b) {
+            const int from = lo + b * BLOCK_SIZE, to = std::min(lo + moved, from + BLOCK_SIZE);
+            std::copy(scratch.begin() + from, scratch.begin() + to, items.begin() + from);
+        });
+        return total;
+    }
+
+    // Median of keys sampled evenly across [lo, hi)
+    std::uint64_t pivot(const int lo, const int hi) const {
+        std::array<std::uint64_t, SAMPLE_SIZE> sample;
+        const double step = static_cast<double>(hi - lo) / SAMPLE_SIZE;
+        for (int i = 0; i < SAMPLE_SIZE; ++i) sample[i] = items[lo + static_cast<int>(i * step)].key;
+        std::nth_element(sample.begin(), sample.begin() + SAMPLE_SIZE / 2, sample.end());
+        return sample[SAMPLE_SIZE / 2];
+    }
+
+    // Stable LSD radix sort of [lo, hi) by key, one byte per pass
+    void radixSort(const int lo, const int hi) {
+        std::vector<std::array<int, 257>> count(8);
+        for (std::array<int, 257>& c : count) c.fill(0);
+        for (int i = lo; i < hi; ++i) {
+            const std::uint64_t key = items[i].key;
+            for (int d = 0; d < 8; ++d) ++count[d][((key >> (8 * d)) & 0xFF) + 1];
+        }
+
+        Item* from = items.data() + lo;
+        Item* to = scratch.data() + lo;
+        const int n = hi - lo;
+        for (int d = 0; d < 8; ++d) {
+            std::array<int, 257>& c = count[d];
+            if (*std::max_element(c.begin(), c.end()) == n) continue;  // every key has the same byte
+            std::partial_sum(c.begin(), c.end(), c.begin());
+            for (int i = 0; i < n; ++i) to[c[(from[i].key >> (8 * d)) & 0xFF]++] = from[i];
+            std::swap(from, to);
+        }
+        if (from != items.data() + lo) std::copy(from, from + n, items.data() + lo);
+    }
+
+    // Kruskal's algorithm on [lo, hi)
+    void kruskal(const int lo, const int hi) {
+        if (sortMode == KruskalSort::Radix) {
+            radixSort(lo, hi);
+        } else {
+            std::sort(items.begin() + lo, items.begin() + hi, [](const Item& a, const Item& b) {
+                return a.key < b.key || (a.key == b.key && a.id < b.id);
+            });
+        }
+        sorted += hi - lo;
+
+        for (int i = lo; i < hi && !spanning(); ++i) {
+            int v = find(items[i].v), w = find(items[i].w);
+            if (v == w) continue;
+            if (treeSize[v] < treeSize[w]) std::swap(v, w);
+            parent[w] = v;
+            treeSize[v] += treeSize[w];
+            mst.push_back(input[items[i].id]);
+            weight_ += input[items[i].id].weight();
+        }
+    }
+
+    void filterKruskal(ThreadPool& pool, const int lo, const int hi) {
+        if (hi - lo <= BASE_SIZE) {
+            kruskal(lo, hi);
+            return;
+        }
+
+        const std::uint64_t p = pivot(lo, hi);
+        const int mid = lo + split(pool, lo, hi, [p](const Item& x) { return x.key <= p; }, true);
+        if (mid == hi) {
+            // p is the largest key and many keys equal it: split at < p instead, so the
+            // equal block is filtered against the forest of the lighter keys
+            const int equal = lo + split(pool, lo, hi, [p](const Item& x) { return x.key < p; }, true);
+            filterKruskal(pool, lo, equal);
+            if (spanning()) return;
+            const int kept = split(pool, equal, hi, [this](const Item& x) { return root(x.v) != root(x.w); }, false);
+            kruskal(equal, equal + kept);  // one key: recursing would pick p again
+            return;
+        }
+        filterKruskal(pool, lo, mid);
+        if (spanning()) return;
+
+        const int heavy = split(pool, mid, hi, [this](const Item& x) { return root(x.v) != root(x.w); }, false);
+        filterKruskal(pool, mid, mid + heavy);
+    }
+
+    void solve(const int V, ThreadPool& pool) {
+        V_ = V;
+        parent.resize(V);
+        std::iota(parent.begin(), parent.end(), 0);
+        treeSize.assign(V, 1);
+
+        items.reserve(input.size());
+        for (int id = 0; id < static_cast<int>(input.size()); ++id) {
+            const int v = input[id].either(), w = input[id].other(v);
+            if (v != w) items.push_back({keyOf(input[id].weight()), v, w, id});
+        }
+        const int E = static_cast<int>(items.size());
+        scratch.resize(E);
+        if (pool.size() > 1) flags.resize(E);  // only the parallel split uses flags
+        if (E > 0) filterKruskal(pool, 0, E);
+
+        // Release the work arrays, which are as large as the input
+        std::vector<Item>().swap(items);
+        std::vector<Item>().swap(scratch);
+        std::vector<unsigned char>().swap(flags);
+    }
+
+    // Copies each edge of g once, in adjacency order
+    template <typename GraphType>
+    void collect(const GraphType& g) {
+        input.reserve(g.E());
+        for (int v = 0; v < g.V(); ++v) {
+            for (const Edge& e : g.adj(v)) {
+                if (e.other(v) > v) input.push_back(e);
+            }
+        }
+    }
+
+public:
+    /**
+     * Computes a minimum spanning forest using a temporary thread pool.
+     *
+     * @param g the edge-weighted graph
+     * @param sort how base cases are sorted
+     * @param threads the number of threads for partitioning (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if threads is not positive
+     */
+    template <typename GraphType>
+    explicit FilterKruskalMST(const GraphType& g, const KruskalSort sort = KruskalSort::Radix,
+                              const int threads = ThreadPool::defaultThreads()) :
+        sortMode(sort) {
+        ThreadPool pool(threads);
+        collect(g);
+        solve(g.V(), pool);
+    }
+
+    /**
+     * Computes a minimum spanning forest of a graph given as an edge list,
+     * using a temporary thread pool.
+     *
+     * @param V the number of vertices
+     * @param edges the edges; ties are broken by position in this list
+     * @param sort how base cases are sorted
+     * @param threads the number of threads for partitioning (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if V is negative, an edge has an endpoint
+     *         outside [0, V) or threads is not positive
+     */
+    FilterKruskalMST(const int V, std::vector<Edge> edges, const KruskalSort sort = KruskalSort::Radix,
+                     const int threads = ThreadPool::defaultThreads()) :
+        input(std::move(edges)),
+        sortMode(sort) {
+        validateEdges(V);
+        ThreadPool pool(threads);
+        solve(V, pool);
+    }
+
+    // Get all edges in the minimum spanning forest, in the order Kruskal's algorithm adds them
+    std::vector<Edge> edges() const {
+        return mst;
+    }
+
+    // Get total weight of the minimum spanning forest
+    double weight() const {
+        return weight_;
+    }
+
+    // Number of edges that reached a base case and were sorted
+    int sortedCount() const { return sorted; }
+};
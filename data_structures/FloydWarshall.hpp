@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DirectedEdge.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Computes all-pairs shortest paths in an edge-weighted digraph with the
+ * Floyd-Warshall algorithm, blocked for cache locality and run on a thread
+ * pool. Negative weights are allowed; negative cycles are detected.
+ *
+ * The distance matrix is split into B x B tiles. For each diagonal tile kk,
+ * the algorithm runs three phases:
+ * 1. the diagonal tile (kk, kk) is closed over its own intermediate vertices;
+ * 2. the tiles in row kk and column kk are updated through the diagonal tile,
+ *    in parallel;
+ * 3. all remaining tiles (i, j) are updated through tiles (i, kk) and (kk, j),
+ *    in parallel.
+ * Each tile update keeps three distance tiles (3 * B * B doubles) and two edge
+ * index tiles, (i, j) and (kk, j) (2 * B * B ints), hot in cache, and its
+ * inner loop runs over contiguous rows with no loop-carried dependency, so
+ * the compiler can vectorize it.
+ *
+ * Alongside the distances, an int matrix records for every pair the index of
+ * the last edge on the best known path, in a flat copy of the digraph's edges.
+ * path(s, t) follows these indices back from t, producing the same
+ * source-to-target edge sequence as DijkstraAllPairsSP::path. Parallel edges
+ * are reduced to the lightest one.
+ *
+ * If some dist(v, v) ends up negative, v lies on a negative cycle. Distances
+ * and paths are then undefined; a Bellman-Ford pass over the edges extracts
+ * one such cycle for negativeCycle().
+ *
+ * Time complexity: O(V³ / p) with p threads, plus O(VE) if there is a negative cycle
+ * Space complexity: O(V² + E)
+ */
+class FloydWarshall {
+    static constexpr int BLOCK = 64;  // tile side; one update's 96 KiB of doubles and 32 KiB of ints fit a 256 KiB L2
+    static constexpr double INF = std::numeric_limits<double>::infinity();
+
+    int V_;
+    int n;                            // V rounded up to a multiple of BLOCK (row stride)
+    std::vector<DirectedEdge> edges;  // copy of the digraph's edges
+    std::vector<double> distTo_;      // distTo_[s * n + t] = length of shortest known path from s to t
+    std::vector<int> edgeTo;          // edgeTo[s * n + t] = index in edges of the last edge on that path, or -1
+    std::vector<DirectedEdge> cycle;  // a negative cycle, if one exists
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    // Relaxes tile (ib, jb) through every intermediate vertex of block kb
+    void updateTile(const int ib, const int jb, const int kb) {
+        double* const d = distTo_.data();
+        int* const e = edgeTo.data();
+        for (int k = kb * BLOCK; k < (kb + 1) * BLOCK; ++k) {
+            const double* const dk = d + static_cast<std::size_t>(k) * n;
+            const int* const ek = e + static_cast<std::size_t>(k) * n;
+            for (int i = ib * BLOCK; i < (ib + 1) * BLOCK; ++i) {
+                double* const di = d + static_cast<std::size_t>(i) * n;
+                int* const ei = e + static_cast<std::size_t>(i) * n;
+                const double dik = di[k];
+                if (dik == INF) continue;
+                for (int j = jb * BLOCK; j < (jb + 1) * BLOCK; ++j) {
+                    const double through = dik + dk[j];
+                    const bool better = through < di[j];
+                    di[j] = better ? through : di[j];
+                    ei[j] = better ? ek[j] : ei[j];
+                }
+            }
+        }
+    }
+
+    // Runs update over count tiles, spreading them across the pool when there are several
+    template <typename Update>
+    static void forEachTile(ThreadPool& pool, const int count, const Update& update) {
+        if (pool.size() == 1 || count <= 1) {
+            for (int t = 0; t < count; ++t) update(t);
+            return;
+        }
+        std::atomic<int> next{0};
+        pool.run([&](int) {
+            for (int t; (t = next.fetch_add(1, std::memory_order_relaxed)) < count;) update(t);
+        });
+    }
+
+    void run(ThreadPool& pool) {
+        const int blocks = n / BLOCK;
+        for (int kb = 0; kb < blocks; ++kb) {
+            updateTile(kb, kb, kb);
+
+            // Row kb and column kb, skipping the diagonal tile
+            forEachTile(pool, 2 * (blocks - 1), [&](const int t) {
+                const int other = t / 2 < kb ? t / 2 : t / 2 + 1;
+                if (t % 2 == 0) {
+                    updateTile(kb, other, kb);
+                } else {
+                    updateTile(other, kb, kb);
+                }
+            });
+
+            // Every tile outside row kb and column kb
+            const int rest = blocks - 1;
+            forEachTile(pool, rest * rest, [&](const int t) {
+                const int ib = t / rest < kb ? t / rest : t / rest + 1;
+                const int jb = t % rest < kb ? t % rest : t % rest + 1;
+                updateTile(ib, jb, kb);
+            });
+        }
+    }
+
+    // Finds a negative cycle with Bellman-Ford from a virtual source joined to every vertex.
+    // The predecessor edges kept by Floyd-Warshall can close zero-weight cycles
+    // once distances go negative, so they are not used here.
+    void findNegativeCycle() {
+        std::vector<double> dist(V_, 0.0);
+        std::vector<int> last(V_, -1);  // last[w] = index in edges of the edge that last lowered dist[w]
+        int changed = -1;
+        for (int pass = 0; pass < V_; ++pass) {
+            changed = -1;
+            for (int i = 0; i < static_cast<int>(edges.size()); ++i) {
+                const DirectedEdge& e = edges[i];
+                if (dist[e.from()] + e.weight() < dist[e.to()]) {
+                    dist[e.to()] = dist[e.from()] + e.weight();
+                    last[e.to()] = i;
+                    changed = e.to();
+                }
+            }
+            if (changed == -1) return;
+        }
+
+        // A vertex still changing after V passes leads back into a cycle within V steps
+        int x = changed;
+        for (int step = 0; step < V_; ++step) x = edges[last[x]].from();
+        int v = x;
+        do {
+            cycle.push_back(edges[last[v]]);
+            v = edges[last[v]].from();
+        } while (v != x);
+        std::reverse(cycle.begin(), cycle.end());
+    }
+
+public:
+    /**
+     * Computes shortest paths between every pair of vertices.
+     *
+     * @param g the edge-weighted digraph
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if threads is not positive
+     */
+    template <typename GraphType>
+    explicit FloydWarshall(const GraphType& g, const int threads = ThreadPool::defaultThreads()) :
+        V_(g.V()),
+        n((g.V() + BLOCK - 1) / BLOCK * BLOCK) {
+
+        ThreadPool pool(threads);
+        const std::size_t cells = static_cast<std::size_t>(n) * n;
+        distTo_.assign(cells, INF);
+        edgeTo.assign(cells, -1);
+        for (int v = 0; v < V_; ++v) {
+            distTo_[static_cast<std::size_t>(v) * n + v] = 0.0;
+        }
+        for (int v = 0; v < V_; ++v) {
+            for (const auto& e : g.adj(v)) {
+                const std::size_t cell = static_cast<std::size_t>(e.from()) * n + e.to();
+                if (e.weight() < distTo_[cell]) {
+                    distTo_[cell] = e.weight();
+                    edgeTo[cell] = static_cast<int>(edges.size());
+                }
+                edges.push_back(e);
+            }
+        }
+
+        run(pool);
+
+        for (int v = 0; v < V_; ++v) {
+            if (distTo_[static_cast<std::size_t>(v) * n + v] < 0.0) {
+                findNegativeCycle();
+                break;
+            }
+        }
+    }
+
+    /**
+     * Returns true if the digraph contains a negative cycle.
+     */
+    bool hasNegativeCycle() const {
+        return !cycle.empty();
+    }
+
+    /**
+     * Returns a negative cycle as a sequence of directed edges, or an empty
+     * vector if there is none.
+     */
+    std::vector<DirectedEdge> negativeCycle() const {
+        return cycle;
+    }
+
+    /**
+     * Returns the length of a shortest path from s to t.
+     *
+     * @return the distance, or the maximum double value if there is no path
+     * @throws std::invalid_argument if s or t is invalid
+     * @throws std::logic_error if the digraph has a negative cycle
+     */
+    double dist(const int s, const int t) const {
+        validateVertex(s);
+        validateVertex(t);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+        const double d = distTo_[static_cast<std::size_t>(s) * n + t];
+        return d == INF ? std::numeric_limits<double>::max() : d;
+    }
+
+    /**
+     * Returns true if there is a path from s to t.
+     *
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    bool hasPath(const int s, const int t) const {
+        validateVertex(s);
+        validateVertex(t);
+        return distTo_[static_cast<std::size_t>(s) * n + t] < INF;
+    }
+
+    /**
+     * Returns a shortest path from s to t as a sequence of directed edges,
+     * or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if s or t is invalid
+     * @throws std::logic_error if the digraph has a negative cycle
+     */
+    std::vector<DirectedEdge> path(const int s, const int t) const {
+        validateVertex(s);
+        validateVertex(t);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+
+        std::vector<DirectedEdge> result;
+        const int* const row = edgeTo.data() + static_cast<std::size_t>(s) * n;
+        for (int i = row[t]; i != -1; i = row[edges[i].from()]) {
+            result.push_back(edges[i]);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    // Number of vertices
+    int V() const { return V_; }
+};
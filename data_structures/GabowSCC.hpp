@@ -1,7 +1,6 @@
 #pragma once
 
 #include <cassert>
-#include <stack>
 #include <stdexcept>
 #include <vector>
 
@@ -25,48 +24,85 @@
  * 3. When returning from DFS, if current vertex is top of stack2, it's an SCC root
  * 4. Pop vertices from stack1 until reaching the root - they form one SCC
  *
+ * The DFS runs on an explicit stack of frames, one per active vertex, so deep
+ * graphs such as long chains cannot overflow the thread's call stack.
+ *
  * Time complexity: O(V + E), Space complexity: O(V)
  */
 class GabowSCC {
-    std::vector<bool> marked;    // marked[v] = true if vertex v has been visited
     std::vector<int> id_;        // id_[v] = strongly connected component id of vertex v
-    std::vector<int> preorder;   // preorder[v] = preorder number of vertex v
+    std::vector<int> preorder;   // preorder[v] = preorder number of vertex v, or -1 if v is unvisited
     int pre;                     // counter for preorder numbering
     int count_;                  // number of strongly connected components
-    std::stack<int> stack1;      // stack of all vertices in current DFS path
-    std::stack<int> stack2;      // stack of potential SCC roots
-
-    // DFS to find strongly connected components using Gabow's two-stack algorithm
-    void dfs(const Digraph& g, const int v) {
-        marked[v] = true;
-        preorder[v] = pre++;     // Assign preorder number
-        stack1.push(v);          // Add to path stack
-        stack2.push(v);          // Add as potential SCC root
-
-        // Explore all adjacent vertices
-        for (const int w : g.adj(v)) {
-            if (!marked[w]) {
-                dfs(g, w);       // Recursive DFS for unvisited vertices
-            }
-            else if (id_[w] == -1) {  // w is visited but not yet assigned to an SCC
-                // Remove vertices from stack2 that cannot be roots of SCC containing w
-                while (!stack2.empty() && preorder[stack2.top()] > preorder[w]) {
-                    stack2.pop();
+    std::vector<int> stack1;     // stack of all vertices in current DFS path
+    std::vector<int> stack2;     // stack of potential SCC roots
+
+    // Iterative DFS from every unvisited vertex to find strongly connected
+    // components using Gabow's two-stack algorithm. The current vertex and its
+    // edge iterators stay in locals; frames hold the suspended callers, as the
+    // call stack does in the recursive version
+    template <typename GraphType>
+    void dfs(const GraphType& g) {
+        using Iterator = decltype(g.adj(0).begin());
+        struct Frame {
+            int v;
+            Iterator next;       // next edge of v to explore on return
+            Iterator end;
+        };
+        std::vector<Frame> frames;
+
+        for (int s = 0; s < g.V(); ++s) {
+            if (preorder[s] != -1) continue;
+
+            int v = s;
+            preorder[v] = pre++;     // Assign preorder number
+            stack1.push_back(v);     // Add to path stack
+            stack2.push_back(v);     // Add as potential SCC root
+            auto adj = g.adj(v);
+            Iterator next = adj.begin(), end = adj.end();
+
+            while (true) {
+                // Explore adjacent vertices, descending into unvisited ones
+                while (next != end) {
+                    const int w = *next++;
+                    if (preorder[w] == -1) {
+                        frames.push_back(Frame{v, next, end});
+                        v = w;
+                        preorder[v] = pre++;
+                        stack1.push_back(v);
+                        stack2.push_back(v);
+                        adj = g.adj(v);
+                        next = adj.begin();
+                        end = adj.end();
+                    }
+                    else if (id_[w] == -1) {  // w is visited but not yet assigned to an SCC
+                        // Remove vertices from stack2 that cannot be roots of SCC containing w
+                        while (!stack2.empty() && preorder[stack2.back()] > preorder[w]) {
+                            stack2.pop_back();
+                        }
+                    }
                 }
-            }
-        }
 
-        // If v is still on top of stack2, it's the root of an SCC
-        if (!stack2.empty() && stack2.top() == v) {
-            stack2.pop();
-            int w;
-            // Pop all vertices from stack1 until v to form the SCC
-            do {
-                w = stack1.top();
-                stack1.pop();
-                id_[w] = count_;  // Assign SCC id
-            } while (w != v);
-            ++count_;
+                // If v is still on top of stack2, it's the root of an SCC
+                if (!stack2.empty() && stack2.back() == v) {
+                    stack2.pop_back();
+                    int w;
+                    // Pop all vertices from stack1 until v to form the SCC
+                    do {
+                        w = stack1.back();
+                        stack1.pop_back();
+                        id_[w] = count_;  // Assign SCC id
+                    } while (w != v);
+                    ++count_;
+                }
+                if (frames.empty()) break;
+
+                // Return to the caller
+                v = frames.back().v;
+                next = frames.back().next;
+                end = frames.back().end;
+                frames.pop_back();
+            }
         }
     }
 
@@ -87,26 +123,25 @@ class GabowSCC {
 
     // Validate vertex index is within bounds
     void validateVertex(const int v) const {
-        if (v < 0 || v >= static_cast<int>(marked.size())) {
+        if (v < 0 || v >= static_cast<int>(id_.size())) {
             throw std::invalid_argument("Vertex out of range");
         }
     }
 
 public:
     // Constructor: compute strongly connected components using Gabow's algorithm
-    explicit GabowSCC(const Digraph& g) :
-        marked(g.V(), false),
+    template <typename GraphType>
+    explicit GabowSCC(const GraphType& g) :
         id_(g.V(), -1),          // Initialize to -1 to indicate unprocessed
-        preorder(g.V()),
+        preorder(g.V(), -1),
         pre(0),
         count_(0) {
 
+        stack1.reserve(g.V());
+        stack2.reserve(g.V());
+
         // Run DFS from each unvisited vertex
-        for (int v = 0; v < g.V(); ++v) {
-            if (!marked[v]) {
-                dfs(g, v);
-            }
-        }
+        dfs(g);
 
         // assert(check(g));  // Verify correctness
     }
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <stdexcept>
 #include <vector>
 
+#include "AdjacencyView.hpp"
+
 class Graph {
     const int V_;  // Number of vertices in the graph (immutable after construction)
     int E_;        // Number of edges in the graph (mutable, increases with addEdge)
@@ -40,16 +43,10 @@ public:
         ++E_;
     }
 
-    std::vector<int> adj(const int v) const {
+    // Returns a non-owning view of the vertices adjacent to v (no copy is made)
+    AdjacencyView<std::list<int>::const_iterator> adj(const int v) const {
         validateVertex(v);
-
-        std::vector<int> result;
-
-        for (const int neighbor : adj_[v]) {
-            result.push_back(neighbor);
-        }
-
-        return result;
+        return {adj_[v].begin(), adj_[v].end(), adj_[v].size()};
     }
 
     int degree(const int v) const {
@@ -64,9 +61,7 @@ public:
         for (int v = 0; v < graph.V(); ++v) {
             os << "V: " << v << "\tE: ";
 
-            // Get adjacency list for this vertex
-            std::vector<int> neighbors = graph.adj(v);
-            for (const int neighbor : neighbors) {
+            for (const int neighbor : graph.adj(v)) {
                 os << neighbor << ' ';
             }
             os << '\n';
@@ -0,0 +1,616 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AdjacencyView.hpp"
+#include "CSRDigraph.hpp"
+#include "CSRGraph.hpp"
+#include "Digraph.hpp"
+#include "DirectedEdge.hpp"
+#include "Edge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "EdgeWeightedGraph.hpp"
+#include "Graph.hpp"
+
+/**
+ * Binary on-disk graph format with a memory-mapped, read-only loader.
+ *
+ * A graph file is a CSR snapshot of a Graph, Digraph, EdgeWeightedGraph or
+ * EdgeWeightedDigraph. Loading maps the file with mmap and points straight into
+ * it, so opening even a very large graph takes constant time and no memory is
+ * copied; pages are faulted in by the OS as the graph is traversed.
+ *
+ * File layout (native byte order, every section 8-byte aligned):
+ *
+ *   offset 0             GraphFileHeader (64 bytes)
+ *   header.offsetsPos    int64[V + 1]  offsets[v] = index of v's first adjacency entry,
+ *                                      offsets[V] = header.entries
+ *   header.indegreePos   int32[V]      in-degree of each vertex (digraph kinds only)
+ *   header.entriesPos    adjacency entries, grouped by vertex in adj(v) order:
+ *                          Graph, Digraph:   int32 neighbor per entry
+ *                          weighted kinds:   GraphFileEdgeRecord {int32 v, int32 w, double weight}
+ *
+ * Undirected graphs store every edge in both endpoints' lists (a self-loop
+ * appears twice for Graph and once for EdgeWeightedGraph, matching the
+ * in-memory classes), so entries is 2E or slightly less.
+ *
+ * Files are written and read in native byte order and are not portable between
+ * machines of different endianness. The loader checks the header, the section
+ * sizes and the offsets (one O(V) pass) but trusts the adjacency data itself.
+ * Requires a POSIX system (mmap).
+ *
+ * Usage:
+ *   GraphFile::write(g, "roads.graph");
+ *   const MappedEdgeWeightedDigraph roads("roads.graph");
+ *   const DijkstraSP sp(roads, 0);
+ */
+
+constexpr std::uint32_t GRAPH_FILE_VERSION = 1;
+
+enum class GraphFileKind : std::uint32_t {
+    Graph = 1,
+    Digraph = 2,
+    EdgeWeightedGraph = 3,
+    EdgeWeightedDigraph = 4
+};
+
+struct GraphFileHeader {
+    char magic[8];              // "DSGRAPH" followed by a NUL byte
+    std::uint32_t version;      // format version, currently 1
+    std::uint32_t kind;         // a GraphFileKind value
+    std::int64_t V;             // number of vertices
+    std::int64_t E;             // number of edges
+    std::int64_t entries;       // number of adjacency entries
+    std::int64_t offsetsPos;    // byte position of the offsets section
+    std::int64_t indegreePos;   // byte position of the in-degree section
+    std::int64_t entriesPos;    // byte position of the entries section
+};
+
+// One adjacency entry of an edge-weighted graph, stored exactly as the edge was added
+struct GraphFileEdgeRecord {
+    std::int32_t v;
+    std::int32_t w;
+    double weight;
+};
+
+static_assert(sizeof(GraphFileHeader) == 64, "GraphFileHeader must be 64 bytes");
+static_assert(sizeof(GraphFileEdgeRecord) == 16, "GraphFileEdgeRecord must be 16 bytes");
+static_assert(sizeof(int) == sizeof(std::int32_t), "graph files store vertices as 32-bit ints");
+
+/**
+ * Iterator over GraphFileEdgeRecords that yields Edge or DirectedEdge values.
+ * Edges are constructed on the fly from the mapped records, so iterating a
+ * mapped adjacency list allocates nothing.
+ */
+template <typename EdgeType>
+class GraphFileEdgeIterator {
+    const GraphFileEdgeRecord* record_;
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = EdgeType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = EdgeType;
+
+    explicit GraphFileEdgeIterator(const GraphFileEdgeRecord* record) : record_(record) {}
+
+    EdgeType operator*() const {
+        return EdgeType(record_->v, record_->w, record_->weight);
+    }
+
+    GraphFileEdgeIterator& operator++() {
+        ++record_;
+        return *this;
+    }
+
+    GraphFileEdgeIterator operator++(int) {
+        GraphFileEdgeIterator old = *this;
+        ++record_;
+        return old;
+    }
+
+    bool operator==(const GraphFileEdgeIterator& other) const { return record_ == other.record_; }
+
+    bool operator!=(const GraphFileEdgeIterator& other) const { return record_ != other.record_; }
+};
+
+/**
+ * Read-only memory mapping of a graph file. Owns the mapping (move-only) and
+ * validates the header against the expected graph kind and the file size.
+ */
+class GraphFileMapping {
+    const char* data_;  // start of the mapping (nullptr once moved from)
+    std::size_t size_;  // length of the mapping in bytes
+
+    void fail(const std::string& path, const std::string& reason) {
+        release();
+        throw std::runtime_error("Invalid graph file " + path + ": " + reason);
+    }
+
+    void release() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+        }
+    }
+
+    void validate(const std::string& path, const GraphFileKind kind, const std::size_t entrySize) {
+        if (size_ < sizeof(GraphFileHeader)) fail(path, "file is too small");
+
+        const GraphFileHeader& h = header();
+        if (std::memcmp(h.magic, "DSGRAPH", 8) != 0) fail(path, "bad magic number");
+        if (h.version != GRAPH_FILE_VERSION) fail(path, "unsupported version " + std::to_string(h.version));
+        if (h.kind != static_cast<std::uint32_t>(kind)) fail(path, "file holds a different kind of graph");
+        if (h.V < 0 || h.V > INT32_MAX || h.E < 0 || h.E > INT32_MAX || h.entries < 0 || h.entries > 2 * h.E) {
+            fail(path, "vertex or edge count out of range");
+        }
+
+        const auto V = static_cast<std::size_t>(h.V);
+        const bool directed = kind == GraphFileKind::Digraph || kind == GraphFileKind::EdgeWeightedDigraph;
+        if (h.offsetsPos != static_cast<std::int64_t>(sizeof(GraphFileHeader)) ||
+            h.indegreePos != h.offsetsPos + static_cast<std::int64_t>((V + 1) * sizeof(std::int64_t)) ||
+            h.entriesPos < h.indegreePos + static_cast<std::int64_t>(directed ? V * sizeof(std::int32_t) : 0) ||
+            h.entriesPos % 8 != 0) {
+            fail(path, "bad section layout");
+        }
+        if (static_cast<std::size_t>(h.entriesPos) + static_cast<std::size_t>(h.entries) * entrySize != size_) {
+            fail(path, "file size does not match header");
+        }
+        const std::int64_t* off = offsets();
+        if (off[0] != 0 || off[V] != h.entries) fail(path, "bad offsets section");
+        // Monotone offsets between 0 and entries keep every adjacency range inside the mapping
+        for (std::size_t v = 0; v < V; ++v) {
+            if (off[v] > off[v + 1]) fail(path, "offsets decrease at vertex " + std::to_string(v));
+        }
+    }
+
+public:
+    /**
+     * Maps the file at path and validates its header.
+     *
+     * @param path the graph file to map
+     * @param kind the kind of graph the caller expects
+     * @param entrySize size in bytes of one adjacency entry for that kind
+     * @throws std::runtime_error if the file cannot be mapped or is not a valid graph file of that kind
+     */
+    GraphFileMapping(const std::string& path, const GraphFileKind kind, const std::size_t entrySize) :
+        data_(nullptr),
+        size_(0) {
+
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open graph file " + path);
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat graph file " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            throw std::runtime_error("Invalid graph file " + path + ": file is empty");
+        }
+
+        void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // the mapping keeps the file contents reachable
+        if (mapped == MAP_FAILED) throw std::runtime_error("Cannot map graph file " + path);
+        data_ = static_cast<const char*>(mapped);
+
+        validate(path, kind, entrySize);
+    }
+
+    GraphFileMapping(const GraphFileMapping&) = delete;
+    GraphFileMapping& operator=(const GraphFileMapping&) = delete;
+
+    GraphFileMapping(GraphFileMapping&& other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    GraphFileMapping& operator=(GraphFileMapping&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~GraphFileMapping() { release(); }
+
+    const GraphFileHeader& header() const {
+        return *reinterpret_cast<const GraphFileHeader*>(data_);
+    }
+
+    const std::int64_t* offsets() const {
+        return reinterpret_cast<const std::int64_t*>(data_ + header().offsetsPos);
+    }
+
+    const int* indegree() const {
+        return reinterpret_cast<const int*>(data_ + header().indegreePos);
+    }
+
+    template <typename Entry>
+    const Entry* entries() const {
+        return reinterpret_cast<const Entry*>(data_ + header().entriesPos);
+    }
+};
+
+/**
+ * Read-only undirected graph backed by a memory-mapped graph file.
+ * Provides the same read API as Graph/CSRGraph, so DepthFirstPaths,
+ * BreadthFirstPaths, ConnectedComponents, etc. run on it directly.
+ */
+class MappedGraph {
+    GraphFileMapping file_;
+    int V_;
+    int E_;
+    const std::int64_t* offsets_;
+    const int* targets_;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_ - 1) + "]");
+        }
+    }
+
+public:
+    explicit MappedGraph(const std::string& path) :
+        file_(path, GraphFileKind::Graph, sizeof(int)),
+        V_(static_cast<int>(file_.header().V)),
+        E_(static_cast<int>(file_.header().E)),
+        offsets_(file_.offsets()),
+        targets_(file_.entries<int>()) {}
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    AdjacencyView<const int*> adj(const int v) const {
+        validateVertex(v);
+        return {targets_ + offsets_[v], targets_ + offsets_[v + 1],
+                static_cast<std::size_t>(offsets_[v + 1] - offsets_[v])};
+    }
+
+    int degree(const int v) const {
+        validateVertex(v);
+        return static_cast<int>(offsets_[v + 1] - offsets_[v]);
+    }
+};
+
+/**
+ * Read-only directed graph backed by a memory-mapped graph file.
+ * Provides the same read API as Digraph/CSRDigraph; reverse() builds an
+ * in-memory CSRDigraph.
+ */
+class MappedDigraph {
+    GraphFileMapping file_;
+    int V_;
+    int E_;
+    const std::int64_t* offsets_;
+    const int* indegree_;
+    const int* targets_;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+public:
+    explicit MappedDigraph(const std::string& path) :
+        file_(path, GraphFileKind::Digraph, sizeof(int)),
+        V_(static_cast<int>(file_.header().V)),
+        E_(static_cast<int>(file_.header().E)),
+        offsets_(file_.offsets()),
+        indegree_(file_.indegree()),
+        targets_(file_.entries<int>()) {}
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    AdjacencyView<const int*> adj(const int v) const {
+        validateVertex(v);
+        return {targets_ + offsets_[v], targets_ + offsets_[v + 1],
+                static_cast<std::size_t>(offsets_[v + 1] - offsets_[v])};
+    }
+
+    int outdegree(const int v) const {
+        validateVertex(v);
+        return static_cast<int>(offsets_[v + 1] - offsets_[v]);
+    }
+
+    int indegree(const int v) const {
+        validateVertex(v);
+        return indegree_[v];
+    }
+
+    // Returns the reverse digraph as an in-memory CSRDigraph (same order as Digraph::reverse)
+    CSRDigraph reverse() const {
+        std::vector<std::pair<int, int>> edges;
+        edges.reserve(E_);
+        for (int v = 0; v < V_; ++v) {
+            for (const int w : adj(v)) {
+                edges.emplace_back(w, v);
+            }
+        }
+        return CSRDigraph(V_, edges);
+    }
+};
+
+/**
+ * Read-only edge-weighted undirected graph backed by a memory-mapped graph file.
+ * adj(v) yields Edge values built from the mapped records, so PrimMST,
+ * LazyPrimMST, KruskalMST, BoruvkaMST and DijkstraUndirectedSP run on it directly.
+ */
+class MappedEdgeWeightedGraph {
+    GraphFileMapping file_;
+    int V_;
+    int E_;
+    const std::int64_t* offsets_;
+    const GraphFileEdgeRecord* records_;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex out of range");
+        }
+    }
+
+public:
+    using AdjView = AdjacencyView<GraphFileEdgeIterator<Edge>>;
+
+    explicit MappedEdgeWeightedGraph(const std::string& path) :
+        file_(path, GraphFileKind::EdgeWeightedGraph, sizeof(GraphFileEdgeRecord)),
+        V_(static_cast<int>(file_.header().V)),
+        E_(static_cast<int>(file_.header().E)),
+        offsets_(file_.offsets()),
+        records_(file_.entries<GraphFileEdgeRecord>()) {}
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    AdjView adj(const int v) const {
+        validateVertex(v);
+        return {GraphFileEdgeIterator<Edge>(records_ + offsets_[v]),
+                GraphFileEdgeIterator<Edge>(records_ + offsets_[v + 1]),
+                static_cast<std::size_t>(offsets_[v + 1] - offsets_[v])};
+    }
+
+    int degree(const int v) const {
+        validateVertex(v);
+        return static_cast<int>(offsets_[v + 1] - offsets_[v]);
+    }
+
+    // Get all edges in the graph exactly once, in the same order as EdgeWeightedGraph::edges
+    std::vector<Edge> edges() const {
+        std::vector<Edge> allEdges;
+        allEdges.reserve(E_);
+        for (int v = 0; v < V_; ++v) {
+            for (std::int64_t i = offsets_[v]; i < offsets_[v + 1]; ++i) {
+                const GraphFileEdgeRecord& r = records_[i];
+                const int w = r.v == v ? r.w : r.v;
+                if (w >= v) allEdges.emplace_back(r.v, r.w, r.weight);
+            }
+        }
+        return allEdges;
+    }
+};
+
+/**
+ * Read-only edge-weighted digraph backed by a memory-mapped graph file.
+ * adj(v) yields DirectedEdge values built from the mapped records, so
+ * DijkstraSP and DijkstraAllPairsSP run on it directly.
+ */
+class MappedEdgeWeightedDigraph {
+    GraphFileMapping file_;
+    int V_;
+    int E_;
+    const std::int64_t* offsets_;
+    const int* indegree_;
+    const GraphFileEdgeRecord* records_;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+public:
+    using AdjView = AdjacencyView<GraphFileEdgeIterator<DirectedEdge>>;
+
+    explicit MappedEdgeWeightedDigraph(const std::string& path) :
+        file_(path, GraphFileKind::EdgeWeightedDigraph, sizeof(GraphFileEdgeRecord)),
+        V_(static_cast<int>(file_.header().V)),
+        E_(static_cast<int>(file_.header().E)),
+        offsets_(file_.offsets()),
+        indegree_(file_.indegree()),
+        records_(file_.entries<GraphFileEdgeRecord>()) {}
+
+    int V() const { return V_; }
+
+    int E() const { return E_; }
+
+    AdjView adj(const int v) const {
+        validateVertex(v);
+        return {GraphFileEdgeIterator<DirectedEdge>(records_ + offsets_[v]),
+                GraphFileEdgeIterator<DirectedEdge>(records_ + offsets_[v + 1]),
+                static_cast<std::size_t>(offsets_[v + 1] - offsets_[v])};
+    }
+
+    int outdegree(const int v) const {
+        validateVertex(v);
+        return static_cast<int>(offsets_[v + 1] - offsets_[v]);
+    }
+
+    int indegree(const int v) const {
+        validateVertex(v);
+        return indegree_[v];
+    }
+
+    std::vector<DirectedEdge> edges() const {
+        std::vector<DirectedEdge> edgeList;
+        edgeList.reserve(E_);
+        for (std::int64_t i = 0; i < offsets_[V_]; ++i) {
+            edgeList.emplace_back(records_[i].v, records_[i].w, records_[i].weight);
+        }
+        return edgeList;
+    }
+
+    // Returns the reverse digraph as an in-memory EdgeWeightedDigraph
+    EdgeWeightedDigraph reverse() const {
+        EdgeWeightedDigraph rev(V_);
+        for (std::int64_t i = 0; i < offsets_[V_]; ++i) {
+            rev.addEdge(DirectedEdge(records_[i].w, records_[i].v, records_[i].weight));
+        }
+        return rev;
+    }
+};
+
+/**
+ * Writes graphs in the binary graph file format described above.
+ * The resulting files are opened with MappedGraph, MappedDigraph,
+ * MappedEdgeWeightedGraph or MappedEdgeWeightedDigraph.
+ */
+class GraphFile {
+    static std::int64_t alignTo8(const std::int64_t pos) {
+        return (pos + 7) / 8 * 8;
+    }
+
+    template <typename T>
+    static void writeRaw(std::ofstream& out, const T* data, const std::size_t count) {
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    // Writes header, offsets and in-degrees; entries are appended by the caller
+    template <typename GraphType>
+    static std::ofstream writePrefix(const std::string& path, const GraphFileKind kind, const GraphType& g,
+                                     const std::vector<int>& indegree) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot create graph file " + path);
+
+        std::vector<std::int64_t> offsets(static_cast<std::size_t>(g.V()) + 1, 0);
+        for (int v = 0; v < g.V(); ++v) {
+            offsets[v + 1] = offsets[v] + static_cast<std::int64_t>(g.adj(v).size());
+        }
+
+        GraphFileHeader h{};
+        std::memcpy(h.magic, "DSGRAPH", 8);
+        h.version = GRAPH_FILE_VERSION;
+        h.kind = static_cast<std::uint32_t>(kind);
+        h.V = g.V();
+        h.E = g.E();
+        h.entries = offsets.back();
+        h.offsetsPos = sizeof(GraphFileHeader);
+        h.indegreePos = h.offsetsPos + static_cast<std::int64_t>(offsets.size() * sizeof(std::int64_t));
+        h.entriesPos = alignTo8(h.indegreePos + static_cast<std::int64_t>(indegree.size() * sizeof(int)));
+
+        writeRaw(out, &h, 1);
+        writeRaw(out, offsets.data(), offsets.size());
+        writeRaw(out, indegree.data(), indegree.size());
+
+        const std::int64_t padding = h.entriesPos - h.indegreePos - static_cast<std::int64_t>(indegree.size() * sizeof(int));
+        const char zeros[8] = {};
+        out.write(zeros, padding);
+        return out;
+    }
+
+    static void finish(std::ofstream& out, const std::string& path) {
+        out.close();
+        if (!out) throw std::runtime_error("Failed writing graph file " + path);
+    }
+
+    template <typename GraphType>
+    static void writeUnweighted(const GraphType& g, const std::string& path, const GraphFileKind kind,
+                                const std::vector<int>& indegree) {
+        std::ofstream out = writePrefix(path, kind, g, indegree);
+        std::vector<int> buffer;
+        for (int v = 0; v < g.V(); ++v) {
+            const auto neighbors = g.adj(v);
+            buffer.assign(neighbors.begin(), neighbors.end());
+            writeRaw(out, buffer.data(), buffer.size());
+        }
+        finish(out, path);
+    }
+
+    template <typename GraphType, typename EdgeType>
+    static void writeWeighted(const GraphType& g, const std::string& path, const GraphFileKind kind,
+                              const std::vector<int>& indegree) {
+        std::ofstream out = writePrefix(path, kind, g, indegree);
+        std::vector<GraphFileEdgeRecord> buffer;
+        for (int v = 0; v < g.V(); ++v) {
+            buffer.clear();
+            for (const EdgeType& e : g.adj(v)) {
+                buffer.push_back(record(e));
+            }
+            writeRaw(out, buffer.data(), buffer.size());
+        }
+        finish(out, path);
+    }
+
+    static GraphFileEdgeRecord record(const Edge& e) {
+        const int v = e.either();
+        return GraphFileEdgeRecord{v, e.other(v), e.weight()};
+    }
+
+    static GraphFileEdgeRecord record(const DirectedEdge& e) {
+        return GraphFileEdgeRecord{e.from(), e.to(), e.weight()};
+    }
+
+    template <typename GraphType>
+    static std::vector<int> indegrees(const GraphType& g) {
+        std::vector<int> indegree(g.V());
+        for (int v = 0; v < g.V(); ++v) indegree[v] = g.indegree(v);
+        return indegree;
+    }
+
+public:
+    /**
+     * Writes g to path, replacing any existing file.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void write(const Graph& g, const std::string& path) {
+        writeUnweighted(g, path, GraphFileKind::Graph, {});
+    }
+
+    static void write(const CSRGraph& g, const std::string& path) {
+        writeUnweighted(g, path, GraphFileKind::Graph, {});
+    }
+
+    static void write(const Digraph& g, const std::string& path) {
+        writeUnweighted(g, path, GraphFileKind::Digraph, indegrees(g));
+    }
+
+    static void write(const CSRDigraph& g, const std::string& path) {
+        writeUnweighted(g, path, GraphFileKind::Digraph, indegrees(g));
+    }
+
+    static void write(const EdgeWeightedGraph& g, const std::string& path) {
+        writeWeighted<EdgeWeightedGraph, Edge>(g, path, GraphFileKind::EdgeWeightedGraph, {});
+    }
+
+    static void write(const EdgeWeightedDigraph& g, const std::string& path) {
+        writeWeighted<EdgeWeightedDigraph, DirectedEdge>(g, path, GraphFileKind::EdgeWeightedDigraph, indegrees(g));
+    }
+};
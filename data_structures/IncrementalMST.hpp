@@ -0,0 +1,383 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Edge.hpp"
+#include "EdgeWeightedGraph.hpp"
+
+/**
+ * Maintains a minimum spanning forest of an edge-weighted undirected graph
+ * whose edges arrive one at a time or in batches.
+ *
+ * The forest is kept in a link-cut tree. Every forest edge is a node of its
+ * own between the nodes of its two endpoints, so the heaviest edge on the
+ * forest path between any two vertices is an aggregate of the splay trees.
+ * Inserting edge v-w then needs a single path query:
+ * - if v and w are in different trees, the edge links them;
+ * - otherwise the edge closes a cycle. By the cycle property, the heaviest
+ *   edge on it cannot be in the minimum spanning forest. If that is an old
+ *   forest edge it is cut and the new edge linked in its place; otherwise
+ *   the new edge is dropped.
+ * Non-forest edges are never needed again and are not stored, so memory is
+ * O(V) however long the stream gets.
+ *
+ * Decreasing the weight of an edge is the same as inserting it again with
+ * the lower weight: if the old copy was in the forest, the new one replaces
+ * it on the cycle the two form.
+ *
+ * Ties are broken by arrival order (earlier edges are lighter), so after any
+ * sequence of insertions the forest is the one Kruskal's algorithm with a
+ * stable sort builds from the same edges. A batch is sorted by weight before
+ * it is inserted, which saves the replacements that arriving in a bad order
+ * would cause, and gives the same forest.
+ *
+ * snapshot() shares an immutable copy of the forest edges. The copy is made
+ * only once per change of the forest, and it stays valid while later
+ * updates go on. weight() is likewise summed afresh over the forest edges
+ * after a change rather than updated by each swap, so rounding error does
+ * not build up over a long stream.
+ *
+ * Time complexity: O(log V) amortized per inserted edge; O(V) for edges()
+ *                  and for the first snapshot() or weight() after a change
+ * Space complexity: O(V)
+ */
+class IncrementalMST {
+    static constexpr int NONE = -1;
+
+    // Link-cut tree over V vertex nodes and V - 1 edge nodes. Vertex nodes
+    // have no key; edge nodes are ordered by (weight, arrival)
+    std::vector<std::array<int, 2>> child;
+    std::vector<int> parent;      // parent in the splay tree, or path-parent of a splay root
+    std::vector<char> flipped;    // lazy subtree reversal
+    std::vector<int> heaviest;    // heaviest[x] = heaviest edge node in x's splay subtree, or NONE
+    std::vector<int> splayPath;   // scratch for splay
+
+    std::vector<Edge> edgeOf;     // edgeOf[V + k] = edge held by edge node V + k
+    std::vector<long long> order; // order[V + k] = arrival number of that edge
+    std::vector<int> freeNodes;   // unused edge nodes
+    std::vector<int> forest;      // edge nodes in the forest
+    std::vector<int> forestSlot;  // forestSlot[x] = position of edge node x in forest
+
+    int V_;
+    long long arrivals = 0;       // edges inserted so far, self-loops included
+    mutable double weight_ = 0.0; // total weight of the forest, if not stale
+    mutable bool weightStale = false;
+    mutable std::shared_ptr<const std::vector<Edge>> cached;  // last snapshot, or null after a change
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    static int validateVertexCount(const int v) {
+        if (v < 0) {
+            throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(v));
+        }
+        return v;
+    }
+
+    // True if edge node a comes after edge node b in the (weight, arrival) order
+    bool heavier(const int a, const int b) const {
+        if (b == NONE) return a != NONE;
+        if (a == NONE) return false;
+        const double wa = edgeOf[a].weight(), wb = edgeOf[b].weight();
+        return wa > wb || (wa == wb && order[a] > order[b]);
+    }
+
+    bool isSplayRoot(const int x) const {
+        const int p = parent[x];
+        return p == NONE || (child[p][0] != x && child[p][1] != x);
+    }
+
+    void pull(const int x) {
+        int best = x >= V_ ? x : NONE;
+        for (const int c : child[x]) {
+            if (c != NONE && heavier(heaviest[c], best)) best = heaviest[c];
+        }
+        heaviest[x] = best;
+    }
+
+    void push(const int x) {
+        if (!flipped[x]) return;
+        std::swap(child[x][0], child[x][1]);
+        for (const int c : child[x]) {
+            if (c != NONE) flipped[c] ^= 1;
+        }
+        flipped[x] = 0;
+    }
+
+    void rotate(const int x) {
+        const int p = parent[x], g = parent[p];
+        const int side = child[p][1] == x ? 1 : 0;
+        if (!isSplayRoot(p)) child[g][child[g][1] == p ? 1 : 0] = x;
+        parent[x] = g;
+
+        const int moved = child[x][1 - side];
+        child[p][side] = moved;
+        if (moved != NONE) parent[moved] = p;
+        child[x][1 - side] = p;
+        parent[p] = x;
+        pull(p);
+        pull(x);
+    }
+
+    void splay(const int x) {
+        // Push pending reversals from the splay root down to x
+        std::vector<int>& path = splayPath;
+        path.clear();
+        for (int y = x;; y = parent[y]) {
+            path.push_back(y);
+            if (isSplayRoot(y)) break;
+        }
+        for (auto it = path.rbegin(); it != path.rend(); ++it) push(*it);
+
+        while (!isSplayRoot(x)) {
+            const int p = parent[x];
+            if (!isSplayRoot(p)) {
+                const int g = parent[p];
+                rotate((child[g][0] == p) == (child[p][0] == x) ? p : x);
+            }
+            rotate(x);
+        }
+    }
+
+    // Makes the root-to-x path preferred, with x at the root of its splay tree
+    void access(const int x) {
+        for (int y = x, last = NONE; y != NONE; last = y, y = parent[y]) {
+            splay(y);
+            child[y][1] = last;
+            pull(y);
+        }
+        splay(x);
+    }
+
+    void makeRoot(const int x) {
+        access(x);
+        flipped[x] ^= 1;
+    }
+
+    int findRoot(int x) {
+        access(x);
+        while (true) {
+            push(x);
+            if (child[x][0] == NONE) break;
+            x = child[x][0];
+        }
+        splay(x);
+        return x;
+    }
+
+    void link(const int x, const int y) {
+        makeRoot(x);
+        parent[x] = y;
+    }
+
+    // Removes the tree edge between adjacent nodes x and y
+    void cut(const int x, const int y) {
+        makeRoot(x);
+        access(y);
+        child[y][0] = NONE;
+        parent[x] = NONE;
+        pull(y);
+    }
+
+    void addToForest(const Edge& e, const long long arrival) {
+        const int x = freeNodes.back();
+        freeNodes.pop_back();
+        edgeOf[x] = e;
+        order[x] = arrival;
+        heaviest[x] = x;
+        const int v = e.either();
+        link(x, v);
+        link(x, e.other(v));
+
+        forestSlot[x] = static_cast<int>(forest.size());
+        forest.push_back(x);
+    }
+
+    void removeFromForest(const int x) {
+        const int v = edgeOf[x].either();
+        cut(x, v);
+        cut(x, edgeOf[x].other(v));
+        freeNodes.push_back(x);
+
+        const int slot = forestSlot[x];
+        forestSlot[forest.back()] = slot;
+        forest[slot] = forest.back();
+        forest.pop_back();
+    }
+
+    // Drops the snapshot and total weight of the previous forest
+    void changed() {
+        cached.reset();
+        weightStale = true;
+    }
+
+    bool insert(const Edge& e, const long long arrival) {
+        const int v = e.either(), w = e.other(v);
+        if (v == w) return false;
+
+        makeRoot(v);
+        if (findRoot(w) != v) {
+            addToForest(e, arrival);
+            changed();
+            return true;
+        }
+
+        // findRoot left w's root path, which is the whole v-w path, in w's splay tree
+        access(w);
+        const int x = heaviest[w];
+        const double wx = edgeOf[x].weight();
+        if (e.weight() > wx || (e.weight() == wx && arrival > order[x])) return false;
+
+        removeFromForest(x);
+        addToForest(e, arrival);
+        changed();
+        return true;
+    }
+
+public:
+    /**
+     * Initializes an empty forest on V vertices.
+     *
+     * @param V the number of vertices
+     * @throws std::invalid_argument if V is negative
+     */
+    explicit IncrementalMST(const int V) :
+        child(2 * static_cast<std::size_t>(validateVertexCount(V)), {NONE, NONE}),
+        parent(2 * static_cast<std::size_t>(V), NONE),
+        flipped(2 * static_cast<std::size_t>(V), 0),
+        heaviest(2 * static_cast<std::size_t>(V), NONE),
+        edgeOf(2 * static_cast<std::size_t>(V), Edge(0, 0, 0.0)),
+        order(2 * static_cast<std::size_t>(V), 0),
+        forestSlot(2 * static_cast<std::size_t>(V), NONE),
+        V_(V) {
+
+        // Edge nodes are V .. 2V - 2; handed out from the back, lowest first
+        for (int x = 2 * V - 2; x >= V; --x) freeNodes.push_back(x);
+        forest.reserve(V > 0 ? V - 1 : 0);
+    }
+
+    /**
+     * Initializes the forest with the edges of a graph, inserted as one batch.
+     *
+     * @param g the edge-weighted graph
+     */
+    template <typename GraphType, typename = std::enable_if_t<!std::is_arithmetic_v<GraphType>>>
+    explicit IncrementalMST(const GraphType& g) : IncrementalMST(g.V()) {
+        std::vector<Edge> edges;
+        edges.reserve(g.E());
+        for (int v = 0; v < g.V(); ++v) {
+            for (const Edge& e : g.adj(v)) {
+                if (e.other(v) > v) edges.push_back(e);
+            }
+        }
+        insert(edges);
+    }
+
+    IncrementalMST(const IncrementalMST&) = delete;
+    IncrementalMST& operator=(const IncrementalMST&) = delete;
+
+    /**
+     * Inserts one edge. A lighter copy of an edge already in the forest
+     * replaces it, which is how weight decreases are applied.
+     *
+     * @param e the edge
+     * @return true if the edge joined the forest
+     * @throws std::invalid_argument if an endpoint is out of range
+     */
+    bool insert(const Edge& e) {
+        const int v = e.either();
+        validateVertex(v);
+        validateVertex(e.other(v));
+        return insert(e, arrivals++);
+    }
+
+    /**
+     * Inserts a batch of edges as if one at a time in the given order,
+     * visiting them lightest first.
+     *
+     * @param batch the edges
+     * @return the number of edges of the batch that are in the forest afterwards
+     * @throws std::invalid_argument if an endpoint is out of range (then no edge is inserted)
+     */
+    int insert(const std::vector<Edge>& batch) {
+        for (const Edge& e : batch) {
+            const int v = e.either();
+            validateVertex(v);
+            validateVertex(e.other(v));
+        }
+
+        std::vector<int> byWeight(batch.size());
+        std::iota(byWeight.begin(), byWeight.end(), 0);
+        std::stable_sort(byWeight.begin(), byWeight.end(), [&batch](const int a, const int b) {
+            return batch[a].weight() < batch[b].weight();
+        });
+
+        // Later edges of the batch are heavier, so none can replace an earlier one
+        int joined = 0;
+        const long long first = arrivals;
+        arrivals += static_cast<long long>(batch.size());
+        for (const int i : byWeight) {
+            if (insert(batch[i], first + i)) ++joined;
+        }
+        return joined;
+    }
+
+    /**
+     * Returns true if v and w are in the same tree of the forest.
+     *
+     * @throws std::invalid_argument if v or w is out of range
+     */
+    bool connected(const int v, const int w) {
+        validateVertex(v);
+        validateVertex(w);
+        return findRoot(v) == findRoot(w);
+    }
+
+    // Get all edges in the minimum spanning forest
+    std::vector<Edge> edges() const {
+        std::vector<Edge> result;
+        result.reserve(forest.size());
+        for (const int x : forest) result.push_back(edgeOf[x]);
+        return result;
+    }
+
+    /**
+     * Returns an immutable copy of the forest edges that later updates do
+     * not affect. Repeated calls without an intervening change of the forest
+     * share one copy.
+     */
+    std::shared_ptr<const std::vector<Edge>> snapshot() const {
+        if (!cached) cached = std::make_shared<const std::vector<Edge>>(edges());
+        return cached;
+    }
+
+    // Get total weight of the minimum spanning forest
+    double weight() const {
+        if (weightStale) {
+            weight_ = 0.0;
+            for (const int x : forest) weight_ += edgeOf[x].weight();
+            weightStale = false;
+        }
+        return weight_;
+    }
+
+    // Number of edges in the forest
+    int size() const { return static_cast<int>(forest.size()); }
+
+    // Number of edges inserted so far
+    long long inserted() const { return arrivals; }
+
+    // Number of vertices
+    int V() const { return V_; }
+};
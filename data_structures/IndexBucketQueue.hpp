@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Indexed monotone priority queue for small integer keys (Dial's bucket queue).
+ *
+ * Every index with key k is kept in bucket k of a circular array. Because
+ * the removed keys never decrease (as in Dijkstra's algorithm with
+ * non-negative integer weights), removeMin only has to advance a cursor to
+ * the next non-empty bucket. Live keys always lie within one ring length of
+ * the cursor; when an insertion would fall outside it, the ring is doubled
+ * and its contents rehashed. With edge weights in [0, C], Dijkstra keeps all
+ * keys within C of the cursor, so the ring settles at O(C) buckets.
+ *
+ * Supports the same index-based operations as IndexMinPQ used by the
+ * shortest path algorithms, so it can be passed as their queue parameter.
+ * Keys must be non-negative integral values (floating point keys such as
+ * 3.0 are accepted), and no key may be inserted or decreased below the last
+ * removed minimum (std::invalid_argument otherwise).
+ *
+ * Time complexity: O(1) insert and decreaseKey; removeMin is O(1) plus the
+ *                  empty buckets skipped, O(D) in total where D is the largest key removed
+ * Space complexity: O(maxCap + C)
+ */
+template <typename Key = double>
+class IndexBucketQueue {
+    static_assert(std::is_arithmetic_v<Key>, "IndexBucketQueue keys must be arithmetic");
+    static constexpr int INITIAL_BUCKETS = 64;  // ring length; always a power of two
+
+    std::vector<std::vector<int>> ring;  // ring[k & mask] = indices with key k
+    std::vector<long long> bucketKey;    // bucketKey[i] = integer key of index i, or -1 if absent
+    std::vector<int> slotOf;             // slotOf[i] = position of i in its bucket
+    std::vector<Key> keys;               // keys[i] = priority of index i
+    long long mask = INITIAL_BUCKETS - 1;
+    long long cursor = 0;                // last removed minimum; no live key is smaller
+    int cap;
+    int count = 0;
+
+    void validateIndex(const int i) const {
+        if (i < 0) throw std::invalid_argument("Index is negative");
+        if (i >= cap) throw std::invalid_argument("Index is out of range");
+    }
+
+    long long checkedKey(const Key& key) const {
+        if constexpr (std::is_floating_point_v<Key>) {
+            if (!(key >= 0) || std::floor(key) != key || key > static_cast<Key>(1LL << 62)) {
+                throw std::invalid_argument("Bucket queue keys must be non-negative integers");
+            }
+        } else if constexpr (std::is_signed_v<Key>) {
+            if (key < 0) throw std::invalid_argument("Bucket queue keys must be non-negative integers");
+        }
+        const long long k = static_cast<long long>(key);
+        if (k < cursor) throw std::invalid_argument("Key is smaller than the last removed minimum");
+        return k;
+    }
+
+    // Doubles the ring until key k fits within one ring length of the cursor
+    void grow(const long long k) {
+        long long size = mask + 1;
+        while (k - cursor >= size) size *= 2;
+
+        std::vector<std::vector<int>> old(static_cast<size_t>(size));
+        old.swap(ring);
+        mask = size - 1;
+        for (auto& bucket : old) {
+            for (const int i : bucket) {
+                std::vector<int>& target = ring[bucketKey[i] & mask];
+                slotOf[i] = static_cast<int>(target.size());
+                target.push_back(i);
+            }
+        }
+    }
+
+    void place(const int i, const long long k) {
+        if (k - cursor > mask) grow(k);
+        bucketKey[i] = k;
+        std::vector<int>& bucket = ring[k & mask];
+        slotOf[i] = static_cast<int>(bucket.size());
+        bucket.push_back(i);
+    }
+
+    void detach(const int i) {
+        std::vector<int>& bucket = ring[bucketKey[i] & mask];
+        const int moved = bucket.back();
+        bucket[slotOf[i]] = moved;
+        slotOf[moved] = slotOf[i];
+        bucket.pop_back();
+        bucketKey[i] = -1;
+    }
+
+public:
+    explicit IndexBucketQueue(const int maxCap) :
+        ring(INITIAL_BUCKETS),
+        bucketKey(maxCap < 0 ? 0 : maxCap, -1),
+        slotOf(maxCap < 0 ? 0 : maxCap, 0),
+        keys(maxCap < 0 ? 0 : maxCap),
+        cap(maxCap) {
+        if (maxCap < 0) throw std::invalid_argument("Capacity cannot be negative");
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    bool contains(const int i) const {
+        validateIndex(i);
+        return bucketKey[i] != -1;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    void insert(const int i, const Key& key) {
+        validateIndex(i);
+        if (contains(i)) throw std::invalid_argument("Index already in PQ");
+
+        place(i, checkedKey(key));
+        keys[i] = key;
+        ++count;
+    }
+
+    int minIndex() {
+        if (empty()) throw std::underflow_error("PQ is empty");
+        while (ring[cursor & mask].empty()) ++cursor;
+        return ring[cursor & mask].back();
+    }
+
+    Key minKey() {
+        return keys[minIndex()];
+    }
+
+    int removeMin() {
+        const int min = minIndex();
+        detach(min);
+        --count;
+        return min;
+    }
+
+    Key keyOf(const int i) const {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        return keys[i];
+    }
+
+    void decreaseKey(const int i, const Key& key) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+
+        if (keys[i] == key)
+            throw std::invalid_argument("Calling decreaseKey() with a key equal to the key in the PQ");
+        if (keys[i] < key)
+            throw std::invalid_argument("Calling decreaseKey() with a key that is not smaller than the key in the PQ");
+
+        const long long k = checkedKey(key);
+        detach(i);
+        place(i, k);
+        keys[i] = key;
+    }
+
+    void remove(const int i) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        detach(i);
+        --count;
+    }
+
+    // Removes all elements in O(size + ring length) time and resets the cursor to zero
+    void clear() {
+        for (auto& bucket : ring) {
+            for (const int i : bucket) bucketKey[i] = -1;
+            bucket.clear();
+        }
+        count = 0;
+        cursor = 0;
+    }
+};
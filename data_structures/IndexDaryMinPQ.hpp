@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Indexed min priority queue implemented as a d-ary heap.
+ *
+ * Every heap node has D children instead of two, so the heap is only
+ * log_D(n) levels deep. decreaseKey and insert walk up the tree and do a
+ * single comparison per level, so they get cheaper as D grows; removeMin
+ * walks down and compares all D children per level, so it gets dearer.
+ * Algorithms that decrease keys far more often than they remove the minimum,
+ * such as Prim's and Dijkstra's algorithms on dense graphs, profit from
+ * D = 4 or 8.
+ *
+ * The heap is stored as a structure of arrays: heap[k] is the index at heap
+ * position k and heapKeys[k] its key, so comparing the D children of a node
+ * reads D adjacent keys instead of chasing D indices into a key array.
+ * qp[i] maps index i back to its heap position. Elements are moved into a
+ * hole instead of swapped, so each level costs one write per array.
+ *
+ * Supports the same operations as IndexMinPQ, so it can be passed as the
+ * queue parameter of PrimMST, DijkstraSP and DijkstraUndirectedSP.
+ *
+ * Time complexity: O(log_D n) insert and decreaseKey; O(D log_D n) removeMin,
+ *                  increaseKey and remove
+ * Space complexity: O(maxCap)
+ */
+template <typename Key = double, int D = 4>
+class IndexDaryMinPQ {
+    static_assert(D >= 2, "IndexDaryMinPQ needs at least two children per node");
+
+    std::vector<int> heap;      // heap[k] = index at heap position k (0-indexed)
+    std::vector<Key> heapKeys;  // heapKeys[k] = key of heap[k]
+    std::vector<int> qp;        // qp[i] = heap position of index i, or -1
+    int cap;                    // Maximum capacity
+    int count;                  // Number of elements in PQ
+
+    void validateIndex(const int i) const {
+        if (i < 0) throw std::invalid_argument("Index is negative");
+        if (i >= cap) throw std::invalid_argument("Index is out of range");
+    }
+
+    void place(const int k, const int i, const Key& key) {
+        heap[k] = i;
+        heapKeys[k] = key;
+        qp[i] = k;
+    }
+
+    // Moves the element at position k up until its parent is not larger
+    void swim(int k) {
+        const int i = heap[k];
+        const Key key = heapKeys[k];
+        while (k > 0) {
+            const int parent = (k - 1) / D;
+            if (!(key < heapKeys[parent])) break;
+            place(k, heap[parent], heapKeys[parent]);
+            k = parent;
+        }
+        place(k, i, key);
+    }
+
+    // Moves the element at position k down until no child is smaller
+    void sink(int k) {
+        const int i = heap[k];
+        const Key key = heapKeys[k];
+        while (true) {
+            const int first = D * k + 1;
+            if (first >= count) break;
+            const int last = std::min(first + D, count);
+
+            int smallest = first;
+            for (int c = first + 1; c < last; ++c) {
+                if (heapKeys[c] < heapKeys[smallest]) smallest = c;
+            }
+            if (!(heapKeys[smallest] < key)) break;
+            place(k, heap[smallest], heapKeys[smallest]);
+            k = smallest;
+        }
+        place(k, i, key);
+    }
+
+    // Removes the element at position k by moving the last element into its place
+    void removeAt(const int k) {
+        const int i = heap[k];
+        --count;
+        if (k != count) {
+            const int moved = heap[count];
+            place(k, moved, heapKeys[count]);
+            swim(k);
+            if (qp[moved] == k) sink(k);  // it did not move up, so it may have to move down
+        }
+        qp[i] = -1;
+    }
+
+public:
+    explicit IndexDaryMinPQ(const int maxCap) : cap(maxCap), count(0) {
+        if (maxCap < 0) throw std::invalid_argument("Capacity cannot be negative");
+        heap.resize(maxCap);
+        heapKeys.resize(maxCap);
+        qp.assign(maxCap, -1);
+    }
+
+    // Number of children per heap node
+    static constexpr int arity() { return D; }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    bool contains(const int i) const {
+        validateIndex(i);
+        return qp[i] != -1;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    void insert(const int i, const Key& key) {
+        validateIndex(i);
+        if (contains(i)) throw std::invalid_argument("Index already in PQ");
+
+        place(count, i, key);
+        swim(count++);
+    }
+
+    int minIndex() const {
+        if (empty()) throw std::underflow_error("PQ is empty");
+        return heap[0];
+    }
+
+    Key minKey() const {
+        if (empty()) throw std::underflow_error("PQ is empty");
+        return heapKeys[0];
+    }
+
+    int removeMin() {
+        if (empty()) throw std::underflow_error("PQ is empty");
+
+        const int min = heap[0];
+        --count;
+        if (count > 0) {
+            place(0, heap[count], heapKeys[count]);
+            sink(0);
+        }
+        qp[min] = -1;
+        return min;
+    }
+
+    Key keyOf(const int i) const {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        return heapKeys[qp[i]];
+    }
+
+    void changeKey(const int i, const Key& key) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+
+        heapKeys[qp[i]] = key;
+        swim(qp[i]);
+        sink(qp[i]);
+    }
+
+    void decreaseKey(const int i, const Key& key) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+
+        const Key& current = heapKeys[qp[i]];
+        if (current == key)
+            throw std::invalid_argument("Calling decreaseKey() with a key equal to the key in the PQ");
+        if (current < key)
+            throw std::invalid_argument("Calling decreaseKey() with a key that is not smaller than the key in the PQ");
+
+        heapKeys[qp[i]] = key;
+        swim(qp[i]);
+    }
+
+    void increaseKey(const int i, const Key& key) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+
+        const Key& current = heapKeys[qp[i]];
+        if (current == key)
+            throw std::invalid_argument("Calling increaseKey() with a key equal to the key in the PQ");
+        if (current > key)
+            throw std::invalid_argument("Calling increaseKey() with a key that is not greater than the key in the PQ");
+
+        heapKeys[qp[i]] = key;
+        sink(qp[i]);
+    }
+
+    void remove(const int i) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        removeAt(qp[i]);
+    }
+
+    // Removes all elements in O(size) time, leaving the capacity unchanged
+    void clear() {
+        for (int k = 0; k < count; ++k) {
+            qp[heap[k]] = -1;
+        }
+        count = 0;
+    }
+
+    std::vector<int> indices() const {
+        return std::vector<int>(heap.begin(), heap.begin() + count);
+    }
+
+    std::vector<Key> keys_in_heap_order() const {
+        return std::vector<Key>(heapKeys.begin(), heapKeys.begin() + count);
+    }
+};
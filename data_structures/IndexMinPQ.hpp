@@ -149,6 +149,14 @@ public:
         qp[i] = -1;                // Mark as not in PQ
     }
 
+    // Removes all elements in O(size) time, leaving the capacity unchanged
+    void clear() {
+        for (int k = 1; k <= count; ++k) {
+            qp[pq[k]] = -1;
+        }
+        count = 0;
+    }
+
     std::vector<int> indices() const {
         std::vector<int> result;
         result.reserve(count);
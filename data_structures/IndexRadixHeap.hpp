@@ -0,0 +1,216 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Indexed monotone priority queue implemented as a radix heap.
+ *
+ * A radix heap exploits the fact that in Dijkstra's algorithm the removed
+ * keys never decrease: every key in the queue is at least the last removed
+ * minimum. Keys are mapped to 64-bit unsigned integers (non-negative
+ * floating point values keep their order when their bit patterns are read
+ * as integers), and an element with key k lives in bucket i, where i is the
+ * position of the highest bit in which k differs from the last minimum
+ * (bucket 0 holds keys equal to it). removeMin takes from bucket 0; when it
+ * is empty, the lowest non-empty bucket is scanned for its minimum, which
+ * becomes the new last minimum, and its elements are redistributed into
+ * strictly lower buckets. Each element therefore moves at most 64 times.
+ *
+ * Supports the same index-based operations as IndexMinPQ used by the
+ * shortest path algorithms, so it can be passed as their queue parameter.
+ * Keys must be non-negative, and no key may be inserted or decreased below
+ * the last removed minimum (std::invalid_argument otherwise).
+ *
+ * Time complexity: O(1) insert and decreaseKey; O(log C) amortized removeMin,
+ *                  where C is the range of the key bit patterns (at most 64)
+ * Space complexity: O(maxCap)
+ */
+template <typename Key = double>
+class IndexRadixHeap {
+    static_assert(std::is_arithmetic_v<Key>, "IndexRadixHeap keys must be arithmetic");
+    static constexpr int BUCKETS = 65;
+
+    std::array<std::vector<int>, BUCKETS> buckets;  // buckets[b] = indices whose key is in bucket b
+    std::vector<int> bucketOf;                      // bucketOf[i] = bucket holding index i, or -1
+    std::vector<int> slotOf;                        // slotOf[i] = position of i in its bucket
+    std::vector<Key> keys;                          // keys[i] = priority of index i
+    std::vector<std::uint64_t> bits;                // bits[i] = order-preserving integer image of keys[i]
+    std::uint64_t last = 0;                         // image of the last removed minimum
+    int cap;
+    int count = 0;
+
+    void validateIndex(const int i) const {
+        if (i < 0) throw std::invalid_argument("Index is negative");
+        if (i >= cap) throw std::invalid_argument("Index is out of range");
+    }
+
+    static std::uint64_t toBits(const Key key) {
+        if constexpr (std::is_floating_point_v<Key>) {
+            if (!(key >= 0)) throw std::invalid_argument("Radix heap keys must be non-negative");
+            const double value = key == 0 ? 0.0 : static_cast<double>(key);  // folds -0.0 into 0.0
+            std::uint64_t result;
+            std::memcpy(&result, &value, sizeof(result));
+            return result;
+        } else {
+            if constexpr (std::is_signed_v<Key>) {
+                if (key < 0) throw std::invalid_argument("Radix heap keys must be non-negative");
+            }
+            return static_cast<std::uint64_t>(key);
+        }
+    }
+
+    // Number of significant bits in x (0 for x == 0)
+    static int bitLength(std::uint64_t x) {
+#if defined(__GNUC__)
+        return x == 0 ? 0 : 64 - __builtin_clzll(x);
+#else
+        int length = 0;
+        for (int shift = 32; shift > 0; shift /= 2) {
+            if (x >> shift) {
+                x >>= shift;
+                length += shift;
+            }
+        }
+        return length + static_cast<int>(x);
+#endif
+    }
+
+    static int bucketFor(const std::uint64_t x, const std::uint64_t min) {
+        return bitLength(x ^ min);
+    }
+
+    void place(const int i) {
+        const int b = bucketFor(bits[i], last);
+        bucketOf[i] = b;
+        slotOf[i] = static_cast<int>(buckets[b].size());
+        buckets[b].push_back(i);
+    }
+
+    void detach(const int i) {
+        std::vector<int>& bucket = buckets[bucketOf[i]];
+        const int moved = bucket.back();
+        bucket[slotOf[i]] = moved;
+        slotOf[moved] = slotOf[i];
+        bucket.pop_back();
+        bucketOf[i] = -1;
+    }
+
+    std::uint64_t checkedBits(const Key& key) const {
+        const std::uint64_t b = toBits(key);
+        if (b < last) throw std::invalid_argument("Key is smaller than the last removed minimum");
+        return b;
+    }
+
+    // Makes bucket 0 non-empty by redistributing the lowest non-empty bucket
+    void refill() {
+        if (!buckets[0].empty()) return;
+
+        int b = 1;
+        while (buckets[b].empty()) ++b;
+
+        std::uint64_t min = bits[buckets[b].front()];
+        for (const int i : buckets[b]) {
+            if (bits[i] < min) min = bits[i];
+        }
+        last = min;
+
+        std::vector<int> moving;
+        moving.swap(buckets[b]);
+        for (const int i : moving) place(i);
+        moving.clear();
+        buckets[b].swap(moving);  // keep the allocation for later use
+    }
+
+public:
+    explicit IndexRadixHeap(const int maxCap) :
+        bucketOf(maxCap < 0 ? 0 : maxCap, -1),
+        slotOf(maxCap < 0 ? 0 : maxCap, 0),
+        keys(maxCap < 0 ? 0 : maxCap),
+        bits(maxCap < 0 ? 0 : maxCap, 0),
+        cap(maxCap) {
+        if (maxCap < 0) throw std::invalid_argument("Capacity cannot be negative");
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    bool contains(const int i) const {
+        validateIndex(i);
+        return bucketOf[i] != -1;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    void insert(const int i, const Key& key) {
+        validateIndex(i);
+        if (contains(i)) throw std::invalid_argument("Index already in PQ");
+
+        bits[i] = checkedBits(key);
+        keys[i] = key;
+        place(i);
+        ++count;
+    }
+
+    int minIndex() {
+        if (empty()) throw std::underflow_error("PQ is empty");
+        refill();
+        return buckets[0].back();
+    }
+
+    Key minKey() {
+        return keys[minIndex()];
+    }
+
+    int removeMin() {
+        const int min = minIndex();
+        detach(min);
+        --count;
+        return min;
+    }
+
+    Key keyOf(const int i) const {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        return keys[i];
+    }
+
+    void decreaseKey(const int i, const Key& key) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+
+        if (keys[i] == key)
+            throw std::invalid_argument("Calling decreaseKey() with a key equal to the key in the PQ");
+        if (keys[i] < key)
+            throw std::invalid_argument("Calling decreaseKey() with a key that is not smaller than the key in the PQ");
+
+        bits[i] = checkedBits(key);
+        keys[i] = key;
+        detach(i);
+        place(i);
+    }
+
+    void remove(const int i) {
+        validateIndex(i);
+        if (!contains(i)) throw std::invalid_argument("Index not in PQ");
+        detach(i);
+        --count;
+    }
+
+    // Removes all elements in O(size) time and resets the last minimum to zero
+    void clear() {
+        for (auto& bucket : buckets) {
+            for (const int i : bucket) bucketOf[i] = -1;
+            bucket.clear();
+        }
+        count = 0;
+        last = 0;
+    }
+};
@@ -20,22 +20,35 @@
  * 2. Run DFS on G in that order
  * 3. Each DFS tree in step 2 is a strongly connected component
  *
+ * Both passes are iterative (DepthFirstOrder keeps an explicit stack of
+ * frames), so deep graphs such as long chains cannot overflow the thread's
+ * call stack.
+ *
  * Time complexity: O(V + E), Space complexity: O(V)
  */
 class KosarajuSharirSCC {
-    std::vector<bool> marked;  // marked[v] = true if vertex v has been visited
-    std::vector<int> id_;      // id_[v] = strongly connected component id of vertex v
+    std::vector<int> id_;      // id_[v] = strongly connected component id of vertex v, or -1 if unvisited
     int count_;                // number of strongly connected components
+    std::vector<int> stack;    // vertices marked but not yet explored
 
-    // DFS to mark vertices in the same strongly connected component
-    void dfs(const Digraph& g, const int v) {
-        marked[v] = true;
+    // Marks every unvisited vertex reachable from v as one strongly connected
+    // component. The order of the search does not change the set reached, so
+    // a plain stack of vertices replaces the recursion
+    template <typename GraphType>
+    void dfs(const GraphType& g, const int v) {
         id_[v] = count_;  // Assign current component id to vertex v
+        stack.push_back(v);
+
+        while (!stack.empty()) {
+            const int x = stack.back();
+            stack.pop_back();
 
-        // Visit all unvisited adjacent vertices
-        for (const int w : g.adj(v)) {
-            if (!marked[w]) {
-                dfs(g, w);
+            // Visit all unvisited adjacent vertices
+            for (const int w : g.adj(x)) {
+                if (id_[w] == -1) {
+                    id_[w] = count_;
+                    stack.push_back(w);
+                }
             }
         }
     }
@@ -57,25 +70,27 @@ class KosarajuSharirSCC {
 
     // Validate vertex index is within bounds
     void validateVertex(const int v) const {
-        if (v < 0 || v >= static_cast<int>(marked.size())) {
+        if (v < 0 || v >= static_cast<int>(id_.size())) {
             throw std::invalid_argument("Vertex out of range");
         }
     }
 
 public:
     // Constructor: compute strongly connected components using Kosaraju-Sharir algorithm
-    explicit KosarajuSharirSCC(const Digraph& g) :
-        marked(g.V(), false),
-        id_(g.V()),
+    template <typename GraphType>
+    explicit KosarajuSharirSCC(const GraphType& g) :
+        id_(g.V(), -1),
         count_(0) {
 
+        stack.reserve(g.V());
+
         // Step 1: Compute reverse postorder of reverse graph
         const DepthFirstOrder dfo(g.reverse());
 
         // Step 2: Run DFS on original graph in reverse postorder of G^R
         // Each DFS tree found is a strongly connected component
         for (const int v : dfo.reversePost()) {
-            if (!marked[v]) {
+            if (id_[v] == -1) {
                 dfs(g, v);    // Find one SCC starting from vertex v
                 ++count_;     // Increment SCC count
             }
@@ -117,7 +117,8 @@ class KruskalMST {
 
 public:
     // Constructor: compute MST using Kruskal's algorithm
-    explicit KruskalMST(const EdgeWeightedGraph& g) : weight_(0.0) {
+    template <typename GraphType>
+    explicit KruskalMST(const GraphType& g) : weight_(0.0) {
         // Step 1: Get all edges and sort them by weight
         std::vector<Edge> edges;
         edges.reserve(g.E());  // Reserve space for efficiency
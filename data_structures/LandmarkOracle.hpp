@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AStarSearch.hpp"
+#include "CSREdgeWeightedDigraph.hpp"
+#include "DijkstraSP.hpp"
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "ThreadPool.hpp"
+
+// How LandmarkOracle picks its landmark vertices
+enum class LandmarkSelection {
+    Farthest,  // each landmark is the vertex farthest from those already chosen
+    Degree     // the vertices with the most incident edges
+};
+
+/**
+ * Landmark (ALT) distance oracle for edge-weighted digraphs with
+ * non-negative weights.
+ *
+ * A few landmark vertices L are chosen, and DijkstraSP is run from each of
+ * them on the digraph and on its reverse, giving d(L, v) and d(v, L) for
+ * every vertex v. By the triangle inequality
+ *
+ *     d(s, t) >= d(L, t) - d(L, s)   and   d(s, t) >= d(s, L) - d(t, L)
+ *     d(s, t) <= d(s, L) + d(L, t)
+ *
+ * so the tables bound any distance in O(k) time for k landmarks. The lower
+ * bound is an admissible and consistent A* heuristic, which query() uses
+ * for exact point-to-point answers.
+ *
+ * Landmarks are chosen in one of two ways:
+ * - Farthest: starting from the vertex farthest from vertex 0, each new
+ *   landmark maximizes its distance from the landmarks so far (vertices no
+ *   landmark reaches come first). Each step needs the previous forward
+ *   runs, so these run one after another; the reverse runs then run in
+ *   parallel.
+ * - Degree: the k vertices with the largest indegree + outdegree; all 2k
+ *   runs are spread across a ThreadPool.
+ *
+ * The tables are vertex-major (the k distances of a vertex are adjacent)
+ * so a bound reads two short contiguous runs. Distance may be float to
+ * halve them; the bounds are then widened by the float rounding error so
+ * the lower bound stays admissible. Either way the bounds are exact only up
+ * to the rounding of the Dijkstra sums themselves.
+ *
+ * The oracle keeps a reference to the digraph for query(); it must outlive
+ * the oracle and must not change. Bounds are thread-safe; query() is not.
+ *
+ * Time complexity: O(k (E + V) log V) to build; O(k) per bound;
+ *                  O((V' + E') (k + log V')) per exact query over the explored region
+ * Space complexity: O(kV + E)
+ */
+template <typename GraphType = EdgeWeightedDigraph, typename Distance = double>
+class LandmarkOracle {
+    static_assert(std::is_floating_point_v<Distance>, "Distance must be a floating point type");
+
+    // A* heuristic backed by the landmark lower bound
+    struct LowerBound {
+        const LandmarkOracle* oracle;
+        double operator()(const int v, const int t) const { return oracle->bound(v, t); }
+    };
+
+    struct Allocate {};  // tag for the constructor shared by both public ones
+
+    static constexpr double INF = std::numeric_limits<double>::max();
+    // Relative error of storing a double distance as Distance (0 when nothing is lost)
+    static constexpr double slack = std::is_same_v<Distance, double> ? 0.0 : std::numeric_limits<Distance>::epsilon();
+
+    int V_;
+    int k;                       // number of landmarks
+    std::vector<int> landmarks_;
+    std::vector<Distance> from;  // from[v * k + i] = d(landmarks_[i], v), max if unreachable
+    std::vector<Distance> to;    // to[v * k + i] = d(v, landmarks_[i]), max if unreachable
+    AStarSearch<GraphType, LowerBound> search;
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= V_) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V_) + ")");
+        }
+    }
+
+    static int validateLandmarkCount(const int V, const int landmarks) {
+        if (landmarks < 1 || landmarks > V) {
+            throw std::invalid_argument("Number of landmarks must be in [1, " + std::to_string(V) +
+                                      "], got: " + std::to_string(landmarks));
+        }
+        return landmarks;
+    }
+
+    // Copies the distances of one Dijkstra run into column i of a table
+    void store(const DijkstraSP<>& sp, std::vector<Distance>& table, const int i) {
+        for (int v = 0; v < V_; ++v) {
+            table[static_cast<std::size_t>(v) * k + i] = sp.hasPathTo(v)
+                ? static_cast<Distance>(sp.distTo(v))
+                : std::numeric_limits<Distance>::max();
+        }
+    }
+
+    // Fills the given table columns, forward or reverse, spreading the runs across a thread pool
+    void computeColumns(const GraphType& g, const std::vector<std::pair<int, bool>>& columns, const int threads) {
+        if (columns.empty()) return;
+        bool needsReverse = false;
+        for (const auto& [i, forward] : columns) needsReverse = needsReverse || !forward;
+
+        std::vector<DirectedEdge> reversed;
+        if (needsReverse) {
+            reversed.reserve(g.E());
+            for (int v = 0; v < V_; ++v) {
+                for (const auto& e : g.adj(v)) reversed.emplace_back(e.to(), e.from(), e.weight());
+            }
+        }
+        const CSREdgeWeightedDigraph reverse(V_, reversed);
+
+        ThreadPool pool(std::min(threads, static_cast<int>(columns.size())));
+        std::atomic<int> next{0};
+        const int count = static_cast<int>(columns.size());
+        pool.run([&](int) {
+            for (int j; (j = next.fetch_add(1, std::memory_order_relaxed)) < count;) {
+                const auto [i, forward] = columns[j];
+                if (forward) {
+                    store(DijkstraSP<>(g, landmarks_[i]), from, i);
+                } else {
+                    store(DijkstraSP<>(reverse, landmarks_[i]), to, i);
+                }
+            }
+        });
+    }
+
+    // Picks landmarks one at a time, filling the forward table as a side effect
+    void selectFarthest(const GraphType& g) {
+        std::vector<double> nearest(V_, INF);  // nearest[v] = min over chosen L of d(L, v)
+        std::vector<bool> chosen(V_, false);
+
+        const DijkstraSP<> start(g, 0);
+        for (int v = 0; v < V_; ++v) nearest[v] = start.hasPathTo(v) ? start.distTo(v) : INF;
+
+        for (int i = 0; i < k; ++i) {
+            // Vertices unreachable from every landmark have nearest = INF and win first
+            int best = -1;
+            for (int v = 0; v < V_; ++v) {
+                if (!chosen[v] && (best == -1 || nearest[v] > nearest[best])) best = v;
+            }
+            chosen[best] = true;
+            landmarks_.push_back(best);
+
+            const DijkstraSP<> sp(g, best);
+            store(sp, from, i);
+            if (i == 0) std::fill(nearest.begin(), nearest.end(), INF);  // forget the distances from vertex 0
+            for (int v = 0; v < V_; ++v) {
+                if (sp.hasPathTo(v)) nearest[v] = std::min(nearest[v], sp.distTo(v));
+            }
+        }
+    }
+
+    void selectByDegree(const GraphType& g) {
+        std::vector<int> order(V_);
+        for (int v = 0; v < V_; ++v) order[v] = v;
+        std::stable_sort(order.begin(), order.end(), [&](const int a, const int b) {
+            return g.indegree(a) + g.outdegree(a) > g.indegree(b) + g.outdegree(b);
+        });
+        landmarks_.assign(order.begin(), order.begin() + k);
+    }
+
+    // Lower bound on d(v, t) without validation, for the search heuristic
+    double bound(const int v, const int t) const {
+        constexpr Distance unreachable = std::numeric_limits<Distance>::max();
+        const Distance* fromV = from.data() + static_cast<std::size_t>(v) * k;
+        const Distance* fromT = from.data() + static_cast<std::size_t>(t) * k;
+        const Distance* toV = to.data() + static_cast<std::size_t>(v) * k;
+        const Distance* toT = to.data() + static_cast<std::size_t>(t) * k;
+
+        double best = 0.0;
+        for (int i = 0; i < k; ++i) {
+            // L reaches v but not t, or t reaches L but v does not: v cannot reach t
+            if (fromV[i] != unreachable && fromT[i] == unreachable) return INF;
+            if (toT[i] != unreachable && toV[i] == unreachable) return INF;
+
+            if (fromV[i] != unreachable) {
+                const double a = fromT[i], b = fromV[i];
+                best = std::max(best, a - b - slack * (a + b));
+            }
+            if (toT[i] != unreachable) {
+                const double a = toV[i], b = toT[i];
+                best = std::max(best, a - b - slack * (a + b));
+            }
+        }
+        return best;
+    }
+
+    LandmarkOracle(const GraphType& g, const int landmarks, const int threads, Allocate) :
+        V_(g.V()),
+        k(validateLandmarkCount(g.V(), landmarks)),
+        from(static_cast<std::size_t>(g.V()) * k),
+        to(static_cast<std::size_t>(g.V()) * k),
+        search(g, LowerBound{this}) {
+
+        if (threads < 1) {
+            throw std::invalid_argument("Number of threads must be positive, got: " + std::to_string(threads));
+        }
+        landmarks_.reserve(k);
+    }
+
+public:
+    /**
+     * Chooses landmarks and precomputes their distance tables.
+     *
+     * @param g the edge-weighted digraph
+     * @param landmarks the number of landmarks, in [1, V]
+     * @param selection how landmarks are chosen
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if any edge has negative weight, landmarks is
+     *         out of range or threads is not positive
+     */
+    LandmarkOracle(const GraphType& g, const int landmarks,
+                   const LandmarkSelection selection = LandmarkSelection::Farthest,
+                   const int threads = ThreadPool::defaultThreads()) :
+        LandmarkOracle(g, landmarks, threads, Allocate{}) {
+
+        std::vector<std::pair<int, bool>> columns;
+        if (selection == LandmarkSelection::Farthest) {
+            selectFarthest(g);
+        } else {
+            selectByDegree(g);
+            for (int i = 0; i < k; ++i) columns.emplace_back(i, true);
+        }
+        for (int i = 0; i < k; ++i) columns.emplace_back(i, false);
+        computeColumns(g, columns, threads);
+    }
+
+    /**
+     * Precomputes distance tables for the given landmarks.
+     *
+     * @param g the edge-weighted digraph
+     * @param landmarks the landmark vertices
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if any edge has negative weight, the list is
+     *         empty, a landmark is invalid or threads is not positive
+     */
+    LandmarkOracle(const GraphType& g, const std::vector<int>& landmarks,
+                   const int threads = ThreadPool::defaultThreads()) :
+        LandmarkOracle(g, std::max(1, static_cast<int>(landmarks.size())), threads, Allocate{}) {
+
+        if (landmarks.empty()) throw std::invalid_argument("At least one landmark is required");
+        for (const int v : landmarks) validateVertex(v);
+        landmarks_ = landmarks;
+
+        std::vector<std::pair<int, bool>> columns;
+        for (int i = 0; i < k; ++i) {
+            columns.emplace_back(i, true);
+            columns.emplace_back(i, false);
+        }
+        computeColumns(g, columns, threads);
+    }
+
+    LandmarkOracle(const LandmarkOracle&) = delete;
+    LandmarkOracle& operator=(const LandmarkOracle&) = delete;
+
+    /**
+     * Returns a lower bound on the distance from s to t.
+     *
+     * @return the lower bound, or the maximum double value if the tables prove t unreachable from s
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double lowerBound(const int s, const int t) const {
+        validateVertex(s);
+        validateVertex(t);
+        return bound(s, t);
+    }
+
+    /**
+     * Returns an upper bound on the distance from s to t: the shortest route
+     * through a single landmark.
+     *
+     * @return the upper bound, or the maximum double value if no landmark lies between s and t
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double upperBound(const int s, const int t) const {
+        validateVertex(s);
+        validateVertex(t);
+        if (s == t) return 0.0;
+
+        constexpr Distance unreachable = std::numeric_limits<Distance>::max();
+        const Distance* toS = to.data() + static_cast<std::size_t>(s) * k;
+        const Distance* fromT = from.data() + static_cast<std::size_t>(t) * k;
+        double best = INF;
+        for (int i = 0; i < k; ++i) {
+            if (toS[i] != unreachable && fromT[i] != unreachable) {
+                const double a = toS[i], b = fromT[i];
+                best = std::min(best, (a + b) * (1.0 + slack));
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Computes the exact shortest path from s to t with A* search, using the
+     * landmark lower bound as the heuristic.
+     *
+     * @return the length of the shortest path, or the maximum double value if t is unreachable
+     * @throws std::invalid_argument if s or t is invalid
+     */
+    double query(const int s, const int t) { return search.query(s, t); }
+
+    /**
+     * Returns true if the last query found a path.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    bool hasPath() const { return search.hasPath(); }
+
+    /**
+     * Returns the shortest path found by the last query, or an empty vector if there is none.
+     *
+     * @throws std::logic_error if no query has been run yet
+     */
+    std::vector<DirectedEdge> path() const { return search.path(); }
+
+    // Number of vertices settled by the last query
+    int settledCount() const { return search.settledCount(); }
+
+    // Landmark vertices, in table column order
+    const std::vector<int>& landmarks() const { return landmarks_; }
+
+    // Number of vertices in the digraph
+    int V() const { return V_; }
+};
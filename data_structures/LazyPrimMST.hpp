@@ -41,7 +41,8 @@ class LazyPrimMST {
     double weight_;                  // total weight of MST
 
     // Run Prim's algorithm starting from vertex s
-    void prim(const EdgeWeightedGraph& g, const int s) {
+    template <typename GraphType>
+    void prim(const GraphType& g, const int s) {
         scan(g, s);  // Add vertex s to MST
 
         while (!pq.empty()) {
@@ -65,7 +66,8 @@ class LazyPrimMST {
     }
 
     // Add vertex v to MST and add all its crossing edges to priority queue
-    void scan(const EdgeWeightedGraph& g, const int v) {
+    template <typename GraphType>
+    void scan(const GraphType& g, const int v) {
         marked[v] = true;
 
         // Add all edges from v to unvisited vertices to priority queue
@@ -147,7 +149,8 @@ class LazyPrimMST {
 
 public:
     // Constructor: compute MST using Prim's algorithm
-    explicit LazyPrimMST(const EdgeWeightedGraph& g) :
+    template <typename GraphType>
+    explicit LazyPrimMST(const GraphType& g) :
         marked(g.V(), false),
         weight_(0.0) {
 
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Graph.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Multi-threaded level-synchronous breadth-first search for shortest paths
+ * from a single source vertex in a Graph, Digraph or any graph type with
+ * V() and adj(v).
+ *
+ * Each level splits the frontier into blocks that the pool's threads claim
+ * dynamically, and runs two passes over them:
+ * 1. Every frontier vertex at position i offers itself as parent to each
+ *    unvisited neighbor w with an atomic min on claim[w], so the winner is
+ *    the earliest frontier vertex adjacent to w.
+ * 2. The winning parent records w in its block's local next-frontier
+ *    buffer, in adjacency order, and sets w's bit in the atomic visited
+ *    bitmap.
+ * The block buffers are concatenated in block order. This reproduces the
+ * parent choice and queue order of the sequential BreadthFirstPaths, so
+ * distTo and pathTo are identical for any number of threads.
+ *
+ * Frontiers smaller than the block size are expanded on the calling thread.
+ *
+ * Time complexity: O((V + E) / p + depth) with p threads, given enough parallelism
+ * Space complexity: O(V)
+ */
+class ParallelBFS {
+    static constexpr int BLOCK_SIZE = 256;  // frontier vertices per unit of work
+
+    std::vector<bool> marked;   // marked[v] = true if v is reachable from source
+    std::vector<int> edgeTo;    // edgeTo[v] = previous vertex on shortest path from source to v
+    std::vector<int> distTo_;   // distTo_[v] = shortest distance from source to v
+    const int s;                // source vertex
+
+    // Validate vertex index is within bounds
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= static_cast<int>(marked.size())) {
+            throw std::invalid_argument("Vertex out of range");
+        }
+    }
+
+    template <typename GraphType>
+    void bfs(const GraphType& g, ThreadPool& pool) {
+        const int V = g.V();
+        std::vector<std::atomic<std::uint64_t>> visited((V + 63) / 64);
+        std::vector<std::atomic<int>> claim(V);
+        for (auto& c : claim) c.store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+
+        const auto isVisited = [&](const int v) {
+            return (visited[v >> 6].load(std::memory_order_relaxed) >> (v & 63)) & 1;
+        };
+        const auto setVisited = [&](const int v) {
+            visited[v >> 6].fetch_or(std::uint64_t{1} << (v & 63), std::memory_order_relaxed);
+        };
+
+        // Pass 1: the earliest frontier position adjacent to w claims it
+        const auto offerParents = [&](const std::vector<int>& frontier, const int lo, const int hi) {
+            for (int i = lo; i < hi; ++i) {
+                for (const int w : g.adj(frontier[i])) {
+                    if (isVisited(w)) continue;
+                    int current = claim[w].load(std::memory_order_relaxed);
+                    while (i < current && !claim[w].compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+                }
+            }
+        };
+
+        // Pass 2: each claimed vertex is appended by its parent, in adjacency order
+        const auto collectChildren = [&](const std::vector<int>& frontier, const int lo, const int hi,
+                                         const int level, std::vector<int>& out) {
+            for (int i = lo; i < hi; ++i) {
+                const int v = frontier[i];
+                for (const int w : g.adj(v)) {
+                    if (claim[w].load(std::memory_order_relaxed) != i || isVisited(w)) continue;
+                    setVisited(w);
+                    edgeTo[w] = v;
+                    distTo_[w] = level + 1;
+                    out.push_back(w);
+                }
+            }
+        };
+
+        std::vector<int> frontier{s};
+        std::vector<int> next;
+        std::vector<std::vector<int>> blockOutput;
+        setVisited(s);
+        distTo_[s] = 0;
+
+        for (int level = 0; !frontier.empty(); ++level) {
+            const int n = static_cast<int>(frontier.size());
+            next.clear();
+
+            if (pool.size() == 1 || n <= BLOCK_SIZE) {
+                offerParents(frontier, 0, n);
+                collectChildren(frontier, 0, n, level, next);
+            } else {
+                const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+                if (static_cast<int>(blockOutput.size()) < blocks) blockOutput.resize(blocks);
+                for (int b = 0; b < blocks; ++b) blockOutput[b].clear();
+
+                std::atomic<int> nextBlock{0};
+                pool.run([&](int) {
+                    for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+                        offerParents(frontier, b * BLOCK_SIZE, std::min(n, (b + 1) * BLOCK_SIZE));
+                    }
+                });
+                nextBlock.store(0, std::memory_order_relaxed);
+                pool.run([&](int) {
+                    for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+                        collectChildren(frontier, b * BLOCK_SIZE, std::min(n, (b + 1) * BLOCK_SIZE),
+                                        level, blockOutput[b]);
+                    }
+                });
+                for (int b = 0; b < blocks; ++b) {
+                    next.insert(next.end(), blockOutput[b].begin(), blockOutput[b].end());
+                }
+            }
+            frontier.swap(next);
+        }
+
+        for (int v = 0; v < V; ++v) marked[v] = isVisited(v);
+    }
+
+public:
+    /**
+     * Finds shortest paths from s using a temporary pool of the given size.
+     *
+     * @param g the graph
+     * @param s the source vertex
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if s is invalid or threads is not positive
+     */
+    template <typename GraphType>
+    ParallelBFS(const GraphType& g, const int s, const int threads = ThreadPool::defaultThreads()) :
+        marked(g.V(), false),
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<int>::max()),
+        s(s) {
+        validateVertex(s);
+        ThreadPool pool(threads);
+        bfs(g, pool);
+    }
+
+    /**
+     * Finds shortest paths from s using an existing pool, so that repeated
+     * searches do not start new threads.
+     *
+     * @param g the graph
+     * @param s the source vertex
+     * @param pool the thread pool
+     * @throws std::invalid_argument if s is invalid
+     */
+    template <typename GraphType>
+    ParallelBFS(const GraphType& g, const int s, ThreadPool& pool) :
+        marked(g.V(), false),
+        edgeTo(g.V()),
+        distTo_(g.V(), std::numeric_limits<int>::max()),
+        s(s) {
+        validateVertex(s);
+        bfs(g, pool);
+    }
+
+    // Is there a path from source to vertex v?
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return marked[v];
+    }
+
+    // Return shortest distance from source to vertex v
+    int distTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v];
+    }
+
+    // Return shortest path from source to vertex v (empty if no path exists)
+    std::vector<int> pathTo(const int v) const {
+        validateVertex(v);
+        if (!hasPathTo(v)) return std::vector<int>{};
+
+        std::vector<int> path;
+        for (int x = v; x != s; x = edgeTo[x]) {
+            path.push_back(x);
+        }
+        path.push_back(s);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
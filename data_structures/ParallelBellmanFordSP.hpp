@@ -0,0 +1,235 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CSREdgeWeightedDigraph.hpp"
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "EdgeWeightedDirectedCycle.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Computes shortest paths from a source vertex in an edge-weighted digraph
+ * whose edge weights may be negative, relaxing edges in parallel rounds.
+ *
+ * This is the round-synchronous form of the queue-based Bellman-Ford
+ * algorithm in BellmanFordSP. Each round relaxes the edges leaving every
+ * vertex whose distance changed in the previous round (the frontier). The
+ * frontier is split into blocks that the threads of a ThreadPool claim
+ * dynamically. A candidate distance is first compared against an atomic
+ * read of the target's distance; only improvements take one of a fixed set
+ * of striped locks, under which the distance and the predecessor edge are
+ * updated together. Each improved vertex joins the next frontier once,
+ * through a per-vertex atomic flag.
+ *
+ * As in BellmanFordSP, after every V relaxations the predecessor edges are
+ * checked for a cycle; one found there is a negative cycle reachable from
+ * the source, which stops the algorithm.
+ *
+ * Time complexity: O(V * E / p) worst case with p threads; typically near O(E / p)
+ * Space complexity: O(V)
+ */
+class ParallelBellmanFordSP {
+    static constexpr int BLOCK_SIZE = 256;     // frontier vertices per unit of work
+    static constexpr int LOCK_STRIPES = 4096;  // vertex v is guarded by lock v % LOCK_STRIPES
+
+    std::vector<double> distTo_;                      // distTo_[v] = distance of shortest known path from s to v
+    std::vector<std::optional<DirectedEdge>> edgeTo;  // edgeTo[v] = last edge on shortest known path from s to v
+    std::vector<DirectedEdge> cycle;                  // a negative cycle reachable from s (empty if none)
+    int rounds_ = 0;                                  // relaxation rounds performed
+
+    void validateVertex(const int v) const {
+        const int V = static_cast<int>(distTo_.size());
+        if (v < 0 || v >= V) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(V) + ")");
+        }
+    }
+
+    // Looks for a cycle among the edges of the current shortest path tree
+    void findNegativeCycle() {
+        const int V = static_cast<int>(distTo_.size());
+        std::vector<DirectedEdge> spt;
+        for (int v = 0; v < V; ++v) {
+            if (edgeTo[v].has_value()) spt.push_back(*edgeTo[v]);
+        }
+        const EdgeWeightedDirectedCycle finder(CSREdgeWeightedDigraph(V, spt));
+        cycle = finder.cycle();
+    }
+
+    template <typename GraphType>
+    void run(const GraphType& g, const int s, ThreadPool& pool) {
+        const int V = g.V();
+        std::vector<std::atomic<double>> dist(V);
+        for (auto& d : dist) d.store(std::numeric_limits<double>::max(), std::memory_order_relaxed);
+        std::vector<std::atomic<bool>> queued(V);  // queued[v] = is v already in the next frontier?
+        for (auto& q : queued) q.store(false, std::memory_order_relaxed);
+        std::vector<std::mutex> locks(LOCK_STRIPES);
+        std::vector<std::vector<int>> next(pool.size());
+        std::vector<long long> relaxed(pool.size(), 0);
+
+        const auto relaxRange = [&](const std::vector<int>& frontier, const int lo, const int hi, const int t) {
+            for (int i = lo; i < hi; ++i) {
+                const int v = frontier[i];
+                const double dv = dist[v].load(std::memory_order_relaxed);
+                for (const auto& e : g.adj(v)) {
+                    ++relaxed[t];
+                    const int w = e.to();
+                    const double candidate = dv + e.weight();
+                    if (!(candidate < dist[w].load(std::memory_order_relaxed))) continue;
+
+                    std::lock_guard<std::mutex> guard(locks[w % LOCK_STRIPES]);
+                    if (candidate < dist[w].load(std::memory_order_relaxed)) {
+                        dist[w].store(candidate, std::memory_order_relaxed);
+                        edgeTo[w] = e;
+                        if (!queued[w].exchange(true, std::memory_order_relaxed)) next[t].push_back(w);
+                    }
+                }
+            }
+        };
+
+        dist[s].store(0.0, std::memory_order_relaxed);
+        std::vector<int> frontier{s};
+        long long sinceCheck = 0;
+        while (!frontier.empty()) {
+            ++rounds_;
+            const int n = static_cast<int>(frontier.size());
+            if (pool.size() == 1 || n <= BLOCK_SIZE) {
+                relaxRange(frontier, 0, n, 0);
+            } else {
+                const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+                std::atomic<int> nextBlock{0};
+                pool.run([&](const int t) {
+                    for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+                        relaxRange(frontier, b * BLOCK_SIZE, std::min(n, (b + 1) * BLOCK_SIZE), t);
+                    }
+                });
+            }
+
+            frontier.clear();
+            for (int t = 0; t < pool.size(); ++t) {
+                for (const int w : next[t]) {
+                    queued[w].store(false, std::memory_order_relaxed);
+                    frontier.push_back(w);
+                }
+                next[t].clear();
+                sinceCheck += relaxed[t];
+                relaxed[t] = 0;
+            }
+
+            if (sinceCheck >= V) {
+                sinceCheck = 0;
+                findNegativeCycle();
+                if (!cycle.empty()) break;
+            }
+        }
+
+        for (int v = 0; v < V; ++v) distTo_[v] = dist[v].load(std::memory_order_relaxed);
+    }
+
+public:
+    /**
+     * Computes shortest paths from s using a temporary thread pool, or finds
+     * a negative cycle reachable from s.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if s is invalid or threads is not positive
+     */
+    template <typename GraphType>
+    ParallelBellmanFordSP(const GraphType& g, const int s, const int threads = ThreadPool::defaultThreads()) :
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        edgeTo(g.V()) {
+        validateVertex(s);
+        ThreadPool pool(threads);
+        run(g, s, pool);
+    }
+
+    /**
+     * Computes shortest paths from s on an existing thread pool.
+     *
+     * @param g the edge-weighted digraph
+     * @param s the source vertex
+     * @param pool the thread pool
+     * @throws std::invalid_argument if s is invalid
+     */
+    template <typename GraphType>
+    ParallelBellmanFordSP(const GraphType& g, const int s, ThreadPool& pool) :
+        distTo_(g.V(), std::numeric_limits<double>::max()),
+        edgeTo(g.V()) {
+        validateVertex(s);
+        run(g, s, pool);
+    }
+
+    /**
+     * Returns true if there is a negative cycle reachable from the source.
+     */
+    bool hasNegativeCycle() const {
+        return !cycle.empty();
+    }
+
+    /**
+     * Returns a negative cycle reachable from the source as a sequence of
+     * directed edges, or an empty vector if there is none.
+     */
+    std::vector<DirectedEdge> negativeCycle() const {
+        return cycle;
+    }
+
+    /**
+     * Returns the length of a shortest path from the source to v.
+     *
+     * @return the distance, or the maximum double value if there is no path
+     * @throws std::invalid_argument if vertex v is invalid
+     * @throws std::logic_error if there is a negative cycle
+     */
+    double distTo(const int v) const {
+        validateVertex(v);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+        return distTo_[v];
+    }
+
+    /**
+     * Returns true if there is a path from the source to v.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     */
+    bool hasPathTo(const int v) const {
+        validateVertex(v);
+        return distTo_[v] < std::numeric_limits<double>::max();
+    }
+
+    /**
+     * Returns a shortest path from the source to v as a sequence of directed
+     * edges, or an empty vector if there is none.
+     *
+     * @throws std::invalid_argument if vertex v is invalid
+     * @throws std::logic_error if there is a negative cycle
+     */
+    std::vector<DirectedEdge> pathTo(const int v) const {
+        validateVertex(v);
+        if (hasNegativeCycle()) throw std::logic_error("Negative cost cycle exists");
+        if (!hasPathTo(v)) return std::vector<DirectedEdge>{};
+
+        std::vector<DirectedEdge> path;
+        for (std::optional<DirectedEdge> e = edgeTo[v]; e.has_value(); e = edgeTo[e->from()]) {
+            path.push_back(*e);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Number of parallel relaxation rounds performed
+    int rounds() const { return rounds_; }
+
+    // Number of vertices
+    int V() const { return static_cast<int>(distTo_.size()); }
+};
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Edge.hpp"
+#include "EdgeWeightedGraph.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Computes a minimum spanning forest of an edge-weighted undirected graph
+ * with a parallel, contracting form of Borůvka's algorithm.
+ *
+ * The edges are copied once into a flat array of arcs between components
+ * (initially the vertices). Each round then runs four parallel passes on a
+ * ThreadPool:
+ * 1. Every arc offers itself to both of its components; each component
+ *    keeps the lightest offer with an atomic compare-and-swap.
+ * 2. Each component hooks onto the component at the other end of its
+ *    lightest arc, and that arc joins the forest. When two components pick
+ *    the same arc, the one with the smaller index becomes the root, so the
+ *    hooks form a forest of stars after pointer jumping.
+ * 3. Pointer jumping points every component at its root, and the roots are
+ *    numbered 0 .. C' - 1 to become the next round's components.
+ * 4. Arcs are relabeled to the new components; arcs inside a component are
+ *    dead and are dropped, so each round scans only the live arcs.
+ * The number of components at least halves every round, so there are at
+ * most log V rounds, and they get cheaper as arcs die.
+ *
+ * Ties are broken by the edge's position in the input, so the forest is
+ * unique and the result does not depend on the number of threads. Self-loops
+ * are ignored.
+ *
+ * Time complexity: O((E + V) log V / p) with p threads
+ * Space complexity: O(E + V)
+ */
+class ParallelBoruvkaMST {
+    static constexpr int BLOCK_SIZE = 4096;  // arcs or components per unit of work
+
+    // Edge between two current components; id indexes the input edges
+    struct Arc {
+        int u;
+        int v;
+        int id;
+    };
+
+    std::vector<Edge> input;  // input[id] = edge with that id
+    std::vector<Edge> mst;    // edges in the minimum spanning forest, by id
+    double weight_ = 0.0;     // total weight of the forest
+    int rounds_ = 0;          // Borůvka rounds run
+
+    // Calls f(lo, hi, t) for consecutive blocks of [0, n) spread across the pool
+    template <typename Function>
+    static void forBlocks(ThreadPool& pool, const int n, const Function& f) {
+        if (pool.size() == 1 || n <= BLOCK_SIZE) {
+            f(0, n, 0);
+            return;
+        }
+        const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        std::atomic<int> nextBlock{0};
+        pool.run([&](const int t) {
+            for (int b; (b = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+                f(b * BLOCK_SIZE, std::min(n, (b + 1) * BLOCK_SIZE), t);
+            }
+        });
+    }
+
+    void validateEdges(const int V) const {
+        if (V < 0) {
+            throw std::invalid_argument("Number of vertices cannot be negative, got: " + std::to_string(V));
+        }
+        for (const Edge& e : input) {
+            const int v = e.either(), w = e.other(v);
+            if (v >= V || w >= V) {
+                throw std::invalid_argument("Edge endpoint is out of range [0, " + std::to_string(V) + ")");
+            }
+        }
+    }
+
+    // True if the edge with id a comes before the one with id b in the (weight, id) order
+    bool lighter(const int a, const int b) const {
+        const double wa = input[a].weight(), wb = input[b].weight();
+        return wa < wb || (wa == wb && a < b);
+    }
+
+    void run(const int V, std::vector<Arc> arcs, ThreadPool& pool) {
+        const int threads = pool.size();
+        int C = V;  // current number of components
+        std::vector<std::atomic<int>> best(V);      // best[c] = id of c's lightest arc, or -1
+        std::vector<int> parent(V), jumped(V);
+        std::vector<int> label(V);                       // label[v] = current component of vertex v
+        std::iota(label.begin(), label.end(), 0);
+        std::vector<std::vector<int>> picked(threads);   // ids joining the forest, per thread
+        std::vector<int> forest;
+        std::vector<std::vector<Arc>> kept(threads);     // live arcs, per thread
+        std::vector<Arc> next;
+
+        while (!arcs.empty()) {
+            ++rounds_;
+            const int E = static_cast<int>(arcs.size());
+
+            // 1. Lightest arc of every component
+            forBlocks(pool, C, [&](const int lo, const int hi, int) {
+                for (int c = lo; c < hi; ++c) best[c].store(-1, std::memory_order_relaxed);
+            });
+            forBlocks(pool, E, [&](const int lo, const int hi, int) {
+                for (int i = lo; i < hi; ++i) {
+                    const Arc& a = arcs[i];
+                    for (const int c : {a.u, a.v}) {
+                        int current = best[c].load(std::memory_order_relaxed);
+                        while (current == -1 || lighter(a.id, current)) {
+                            if (best[c].compare_exchange_weak(current, a.id, std::memory_order_relaxed)) break;
+                        }
+                    }
+                }
+            });
+
+            // 2. Hook each component onto the other end of its lightest arc
+            forBlocks(pool, C, [&](const int lo, const int hi, const int t) {
+                for (int c = lo; c < hi; ++c) {
+                    const int id = best[c].load(std::memory_order_relaxed);
+                    parent[c] = c;
+                    if (id == -1) continue;
+
+                    // The arc's endpoints are found through its current labels
+                    const Edge& e = input[id];
+                    const int x = label[e.either()], y = label[e.other(e.either())];
+                    const int d = (x == c) ? y : x;
+                    if (best[d].load(std::memory_order_relaxed) == id && c < d) continue;  // root of a mutual pair
+                    parent[c] = d;
+                    picked[t].push_back(id);
+                }
+            });
+
+            // 3. Pointer jumping to the roots, then number the roots
+            for (bool changed = true; changed;) {
+                std::atomic<bool> anyChanged{false};
+                forBlocks(pool, C, [&](const int lo, const int hi, int) {
+                    bool local = false;
+                    for (int c = lo; c < hi; ++c) {
+                        jumped[c] = parent[parent[c]];
+                        local = local || jumped[c] != parent[c];
+                    }
+                    if (local) anyChanged.store(true, std::memory_order_relaxed);
+                });
+                parent.swap(jumped);
+                changed = anyChanged.load(std::memory_order_relaxed);
+            }
+
+            std::vector<int> component(C);
+            int roots = 0;
+            for (int c = 0; c < C; ++c) {
+                if (parent[c] == c) component[c] = roots++;
+            }
+            forBlocks(pool, C, [&](const int lo, const int hi, int) {
+                for (int c = lo; c < hi; ++c) {
+                    if (parent[c] != c) component[c] = component[parent[c]];
+                }
+            });
+            forBlocks(pool, V, [&](const int lo, const int hi, int) {
+                for (int v = lo; v < hi; ++v) label[v] = component[label[v]];
+            });
+
+            // 4. Relabel the arcs and drop the ones inside a component
+            forBlocks(pool, E, [&](const int lo, const int hi, const int t) {
+                for (int i = lo; i < hi; ++i) {
+                    const int u = component[arcs[i].u], v = component[arcs[i].v];
+                    if (u != v) kept[t].push_back({u, v, arcs[i].id});
+                }
+            });
+            std::vector<std::size_t> offset(threads + 1, 0);
+            for (int t = 0; t < threads; ++t) offset[t + 1] = offset[t] + kept[t].size();
+            next.resize(offset[threads]);
+            pool.run([&](const int t) {
+                std::copy(kept[t].begin(), kept[t].end(), next.begin() + static_cast<std::ptrdiff_t>(offset[t]));
+                kept[t].clear();
+            });
+            arcs.swap(next);
+
+            for (std::vector<int>& ids : picked) {
+                forest.insert(forest.end(), ids.begin(), ids.end());
+                ids.clear();
+            }
+            if (roots == C) break;  // no component had an arc left
+            C = roots;
+        }
+
+        std::sort(forest.begin(), forest.end());
+        mst.reserve(forest.size());
+        for (const int id : forest) {
+            mst.push_back(input[id]);
+            weight_ += input[id].weight();
+        }
+    }
+
+    void solve(const int V, ThreadPool& pool) {
+        std::vector<Arc> arcs;
+        arcs.reserve(input.size());
+        for (int id = 0; id < static_cast<int>(input.size()); ++id) {
+            const int v = input[id].either(), w = input[id].other(v);
+            if (v != w) arcs.push_back({v, w, id});
+        }
+        run(V, std::move(arcs), pool);
+    }
+
+    // Copies each edge of g once, in adjacency order
+    template <typename GraphType>
+    void collect(const GraphType& g) {
+        input.reserve(g.E());
+        for (int v = 0; v < g.V(); ++v) {
+            for (const Edge& e : g.adj(v)) {
+                if (e.other(v) > v) input.push_back(e);
+            }
+        }
+    }
+
+public:
+    /**
+     * Computes a minimum spanning forest using a temporary thread pool.
+     *
+     * @param g the edge-weighted graph
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if threads is not positive
+     */
+    template <typename GraphType>
+    explicit ParallelBoruvkaMST(const GraphType& g, const int threads = ThreadPool::defaultThreads()) {
+        ThreadPool pool(threads);
+        collect(g);
+        solve(g.V(), pool);
+    }
+
+    /**
+     * Computes a minimum spanning forest on an existing thread pool.
+     *
+     * @param g the edge-weighted graph
+     * @param pool the thread pool
+     */
+    template <typename GraphType>
+    ParallelBoruvkaMST(const GraphType& g, ThreadPool& pool) {
+        collect(g);
+        solve(g.V(), pool);
+    }
+
+    /**
+     * Computes a minimum spanning forest of a graph given as an edge list,
+     * using a temporary thread pool. This skips building an EdgeWeightedGraph
+     * for very large inputs.
+     *
+     * @param V the number of vertices
+     * @param edges the edges; ties are broken by position in this list
+     * @param threads the number of threads (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if V is negative, an edge has an endpoint
+     *         outside [0, V) or threads is not positive
+     */
+    ParallelBoruvkaMST(const int V, std::vector<Edge> edges, const int threads = ThreadPool::defaultThreads()) :
+        input(std::move(edges)) {
+        validateEdges(V);
+        ThreadPool pool(threads);
+        solve(V, pool);
+    }
+
+    /**
+     * Computes a minimum spanning forest of a graph given as an edge list,
+     * on an existing thread pool.
+     *
+     * @param V the number of vertices
+     * @param edges the edges; ties are broken by position in this list
+     * @param pool the thread pool
+     * @throws std::invalid_argument if V is negative or an edge has an endpoint outside [0, V)
+     */
+    ParallelBoruvkaMST(const int V, std::vector<Edge> edges, ThreadPool& pool) : input(std::move(edges)) {
+        validateEdges(V);
+        solve(V, pool);
+    }
+
+    // Get all edges in the minimum spanning forest
+    std::vector<Edge> edges() const {
+        return mst;
+    }
+
+    // Get total weight of the minimum spanning forest
+    double weight() const {
+        return weight_;
+    }
+
+    // Number of Borůvka rounds run
+    int rounds() const { return rounds_; }
+};
@@ -33,17 +33,28 @@
  * Time complexity: O(E log V), Space complexity: O(V)
  * where E is the number of edges and V is the number of vertices.
  * This is better than lazy Prim's O(E log E) when the graph is dense.
+ *
+ * Priority queue:
+ * - PriorityQueue defaults to the binary heap IndexMinPQ<double>
+ * - Prim's algorithm decreases keys far more often than it removes the
+ *   minimum on dense graphs, so the shallower d-ary heap IndexDaryMinPQ
+ *   usually does better: PrimMST<IndexDaryMinPQ<double, 4>> mst(g)
+ * - Monotone queues (IndexRadixHeap, IndexBucketQueue) do not apply, since
+ *   the removed keys are edge weights and need not increase
+ * - Over a CSREdgeWeightedGraph every scan reads one contiguous block of edges
  */
+template <typename PriorityQueue = IndexMinPQ<double>>
 class PrimMST {
     // static constexpr double EPS = 1.0e-12;  // Epsilon for floating-point comparison
 
     std::vector<std::optional<Edge>> edgeTo; // edgeTo[v] = shortest edge from tree vertex to non-tree vertex v
     std::vector<double> distTo;              // distTo[v] = weight of shortest such edge
     std::vector<bool> marked;                // marked[v] = true if v is on the tree
-    IndexMinPQ<double> pq;                  // eligible crossing edges (vertices not yet in MST)
+    PriorityQueue pq;                        // eligible crossing edges (vertices not yet in MST)
 
     // Run Prim's algorithm starting from vertex s
-    void prim(const EdgeWeightedGraph& g, const int s) {
+    template <typename GraphType>
+    void prim(const GraphType& g, const int s) {
         distTo[s] = 0.0;
         pq.insert(s, distTo[s]);
 
@@ -54,7 +65,8 @@ class PrimMST {
     }
 
     // Add vertex v to MST and update distances to adjacent vertices
-    void scan(const EdgeWeightedGraph& g, const int v) {
+    template <typename GraphType>
+    void scan(const GraphType& g, const int v) {
         marked[v] = true;
 
         // Check all edges from v to update minimum connection weights
@@ -150,7 +162,8 @@ class PrimMST {
 
 public:
     // Constructor: compute MST using eager Prim's algorithm
-    explicit PrimMST(const EdgeWeightedGraph& g) :
+    template <typename GraphType>
+    explicit PrimMST(const GraphType& g) :
         edgeTo(g.V()),  // Creates vector of std::optional<Edge> (default empty)
         distTo(g.V(), std::numeric_limits<double>::max()),
         marked(g.V(), false),
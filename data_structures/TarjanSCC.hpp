@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <stack>
 #include <stdexcept>
 #include <vector>
 
@@ -25,48 +24,91 @@
  * 3. When a vertex's low-link equals its discovery time, it's an SCC root
  * 4. Pop all vertices from stack until reaching the root - they form one SCC
  *
+ * The DFS runs on an explicit stack of frames, one per active vertex, so the
+ * depth of the graph is limited by heap memory rather than the thread's call
+ * stack. Components and their ids are the same as with the recursive
+ * formulation.
+ *
  * Time complexity: O(V + E), Space complexity: O(V)
  */
 class TarjanSCC {
-    std::vector<bool> marked;   // marked[v] = true if vertex v has been visited
     std::vector<int> id_;       // id_[v] = strongly connected component id of vertex v
-    std::vector<int> low;       // low[v] = lowest preorder number reachable from v
+    std::vector<int> low;       // low[v] = lowest preorder number reachable from v, or -1 if v is unvisited
     int pre;                    // counter for preorder numbering
     int count_;                 // number of strongly connected components
-    std::stack<int> stack;      // stack of vertices in current DFS path
-
-    // DFS to find strongly connected components using Tarjan's algorithm
-    void dfs(const Digraph& g, const int v) {
-        marked[v] = true;
-        low[v] = pre++;         // Initialize low-link value
-        int min = low[v];       // Track minimum low-link in subtree
-        stack.push(v);          // Add vertex to stack
-
-        // Explore all adjacent vertices
-        for (const int w : g.adj(v)) {
-            if (!marked[w]) {
-                dfs(g, w);      // Recursive DFS
-            }
-            // Update minimum low-link value considering edge v->w
-            min = std::min(low[w], min);
-        }
+    std::vector<int> stack;     // stack of vertices in current DFS path
 
-        // Update low-link value
-        if (min < low[v]) {
-            low[v] = min;
-            return;
-        }
+    // Iterative DFS from every unvisited vertex to find strongly connected
+    // components using Tarjan's algorithm. The current vertex, its running
+    // minimum and its edge iterators stay in locals; frames hold the suspended
+    // callers, as the call stack does in the recursive version
+    template <typename GraphType>
+    void dfs(const GraphType& g) {
+        using Iterator = decltype(g.adj(0).begin());
+        struct Frame {
+            int v;
+            int min;            // minimum low-link in v's subtree so far
+            Iterator next;      // next edge of v to explore on return
+            Iterator end;
+        };
+        std::vector<Frame> frames;
+
+        for (int s = 0; s < g.V(); ++s) {
+            if (low[s] != -1) continue;
+
+            int v = s;
+            low[v] = pre++;         // Initialize low-link value
+            int min = low[v];       // Track minimum low-link in subtree
+            stack.push_back(v);     // Add vertex to stack
+            auto adj = g.adj(v);
+            Iterator next = adj.begin(), end = adj.end();
+
+            while (true) {
+                // Explore adjacent vertices, descending into unvisited ones
+                while (next != end) {
+                    const int w = *next++;
+                    if (low[w] == -1) {
+                        frames.push_back(Frame{v, min, next, end});
+                        v = w;
+                        low[v] = pre++;
+                        min = low[v];
+                        stack.push_back(v);
+                        adj = g.adj(v);
+                        next = adj.begin();
+                        end = adj.end();
+                        continue;
+                    }
+                    // Update minimum low-link value considering edge v->w
+                    min = std::min(low[w], min);
+                }
 
-        // If low[v] == preorder[v], then v is root of an SCC
-        // Pop all vertices from stack until v to form the SCC
-        int w;
-        do {
-            w = stack.top();
-            stack.pop();
-            id_[w] = count_;         // Assign SCC id
-            low[w] = g.V();          // Mark as processed (set to infinity)
-        } while (w != v);
-        ++count_;
+                if (min < low[v]) {
+                    // Update low-link value
+                    low[v] = min;
+                }
+                else {
+                    // If low[v] == preorder[v], then v is root of an SCC
+                    // Pop all vertices from stack until v to form the SCC
+                    int w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        id_[w] = count_;         // Assign SCC id
+                        low[w] = g.V();          // Mark as processed (set to infinity)
+                    } while (w != v);
+                    ++count_;
+                }
+                if (frames.empty()) break;
+
+                // Return to the caller, which accounts for the edge to v
+                const int child = v;
+                v = frames.back().v;
+                min = std::min(low[child], frames.back().min);
+                next = frames.back().next;
+                end = frames.back().end;
+                frames.pop_back();
+            }
+        }
     }
 
     // Verify the correctness of SCC computation using transitive closure
@@ -86,26 +128,24 @@ class TarjanSCC {
 
     // Validate vertex index is within bounds
     void validateVertex(const int v) const {
-        if (v < 0 || v >= static_cast<int>(marked.size())) {
+        if (v < 0 || v >= static_cast<int>(id_.size())) {
             throw std::invalid_argument("Vertex out of range");
         }
     }
 
 public:
     // Constructor: compute strongly connected components using Tarjan's algorithm
-    explicit TarjanSCC(const Digraph& g) :
-        marked(g.V(), false),
+    template <typename GraphType>
+    explicit TarjanSCC(const GraphType& g) :
         id_(g.V(), -1),
-        low(g.V()),
+        low(g.V(), -1),
         pre(0),
         count_(0) {
 
+        stack.reserve(g.V());
+
         // Run DFS from each unvisited vertex
-        for (int v = 0; v < g.V(); ++v) {
-            if (!marked[v]) {
-                dfs(g, v);
-            }
-        }
+        dfs(g);
 
         // assert(check(g));  // Verify correctness
     }
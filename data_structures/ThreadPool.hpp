@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size fork-join thread pool for the parallel graph algorithms.
+ *
+ * run(task) calls task(t) once for every thread index t in [0, size())
+ * and returns when all calls have finished. The calling thread runs index 0
+ * itself, so a pool of size n keeps n - 1 worker threads parked between
+ * calls. If any call throws, the first exception is rethrown from run once
+ * all calls have finished.
+ *
+ * The pool is meant to be driven from one thread at a time: run must not be
+ * called concurrently or from inside a task.
+ */
+class ThreadPool {
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+    const std::function<void(int)>* task = nullptr;  // task of the current run
+    unsigned long generation = 0;                    // incremented once per run
+    int remaining = 0;                               // workers still busy with the current run
+    bool stopping = false;
+    std::exception_ptr error;                        // first exception thrown by the current run
+
+    void workerLoop(const int index) {
+        unsigned long seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            startCondition.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            const std::function<void(int)>* current = task;
+            lock.unlock();
+
+            std::exception_ptr failure;
+            try {
+                (*current)(index);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+
+            lock.lock();
+            if (failure && !error) error = failure;
+            if (--remaining == 0) doneCondition.notify_one();
+        }
+    }
+
+public:
+    /**
+     * Creates a pool that runs tasks on the given number of threads.
+     *
+     * @param threads the number of threads, including the calling thread
+     * @throws std::invalid_argument if threads is not positive
+     */
+    explicit ThreadPool(const int threads = defaultThreads()) {
+        if (threads < 1) {
+            throw std::invalid_argument("Number of threads must be positive, got: " + std::to_string(threads));
+        }
+        workers.reserve(threads - 1);
+        for (int t = 1; t < threads; ++t) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, t);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        startCondition.notify_all();
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    // Number of hardware threads, or 1 if unknown
+    static int defaultThreads() {
+        return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Number of threads that run each task, including the calling thread
+    int size() const { return static_cast<int>(workers.size()) + 1; }
+
+    /**
+     * Calls f(t) for every t in [0, size()) concurrently and waits for all of them.
+     *
+     * @param f the task, called with the thread index
+     */
+    void run(const std::function<void(int)>& f) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &f;
+            remaining = static_cast<int>(workers.size());
+            error = nullptr;
+            ++generation;
+        }
+        startCondition.notify_all();
+
+        std::exception_ptr failure;
+        try {
+            f(0);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [&] { return remaining == 0; });
+        task = nullptr;
+        if (!failure) failure = error;
+        lock.unlock();
+        if (failure) std::rethrow_exception(failure);
+    }
+};
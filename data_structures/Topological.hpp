@@ -1,11 +1,14 @@
 #pragma once
 
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DepthFirstOrder.hpp"
 #include "Digraph.hpp"
 #include "DirectedCycle.hpp"
+#include "EdgeWeightedDirectedCycle.hpp"
 
 /**
  * Computes a topological ordering of vertices in a directed acyclic graph (DAG).
@@ -13,6 +16,8 @@
  * directed edge (u,v), vertex u comes before vertex v in the ordering.
  *
  * Uses DFS-based algorithm: reverse postorder gives topological ordering for DAGs.
+ * Accepts both unweighted digraphs and edge-weighted digraphs; the latter are
+ * checked for cycles with EdgeWeightedDirectedCycle.
  * Time complexity: O(V + E), Space complexity: O(V)
  */
 class Topological {
@@ -28,9 +33,15 @@ class Topological {
 
 public:
     // Constructor: compute topological ordering if DAG, empty if has cycle
-    explicit Topological(const Digraph& g) : rank_(g.V()) {
+    template <typename GraphType>
+    explicit Topological(const GraphType& g) : rank_(g.V()) {
+        // Edge-weighted digraphs list DirectedEdge in adj(v) rather than vertices
+        using Entry = std::decay_t<decltype(*std::declval<const GraphType&>().adj(0).begin())>;
+        using CycleFinder = std::conditional_t<std::is_same_v<Entry, DirectedEdge>,
+                                               EdgeWeightedDirectedCycle, DirectedCycle>;
+
         // First check if graph has a directed cycle
-        if (const DirectedCycle finder(g); !finder.hasCycle()) {
+        if (const CycleFinder finder(g); !finder.hasCycle()) {
             // Graph is a DAG - compute topological ordering using DFS
             const DepthFirstOrder dfs(g);
             order_ = dfs.reversePost();  // Reverse postorder gives topological ordering
@@ -30,7 +30,8 @@ class TransitiveClosure {
 
 public:
     // Constructor: precompute reachability from each vertex using DFS
-    explicit TransitiveClosure(const Digraph& g) {
+    template <typename GraphType>
+    explicit TransitiveClosure(const GraphType& g) {
         tc.reserve(g.V());  // Reserve space for efficiency
 
         // For each vertex, compute all vertices reachable from it
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DijkstraQuery.hpp"
+#include "DirectedEdge.hpp"
+#include "EdgeWeightedDigraph.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Computes the k shortest loopless paths between two vertices of an
+ * edge-weighted digraph with non-negative weights, using Yen's algorithm.
+ *
+ * The first path is the shortest path. Each following path is found from
+ * the previous one, P: for every vertex v_i on P (the spur vertex) the
+ * prefix of P up to v_i is kept as the root path, and a spur search looks
+ * for the shortest path from v_i to t that
+ * - visits no vertex of the root path other than v_i, and
+ * - does not leave v_i by the edge that any accepted path with the same
+ *   root path uses next.
+ * Root path plus spur path is a candidate; the shortest candidate not yet
+ * accepted becomes the next path.
+ *
+ * Spur searches run on DijkstraQuery engines with an edge filter, so no
+ * copy of the digraph is made and each search resets only the vertices it
+ * touched. The spur searches of one path are independent and are spread
+ * across a ThreadPool, one engine per thread. Candidates are merged in
+ * spur order, so the result does not depend on the number of threads.
+ * Among paths of equal length, the order is by edge sequence. Parallel
+ * edges with equal weights compare equal, so paths that differ only in
+ * which of them they take are reported once.
+ *
+ * The digraph must outlive the engine and must not change. Queries modify
+ * internal state, so one engine must not be shared between threads.
+ *
+ * Time complexity: O(pE) to bind with p threads;
+ *                  O(k L (E + V) log V / p) per query, for paths of at most L edges
+ * Space complexity: O(pV + kL + candidates)
+ */
+template <typename GraphType = EdgeWeightedDigraph>
+class YenKShortestPaths {
+    // Path with its length, ordered by length and then by edge sequence
+    struct Candidate {
+        double length;
+        std::vector<DirectedEdge> edges;
+
+        bool operator<(const Candidate& other) const {
+            if (length != other.length) return length < other.length;
+            return std::lexicographical_compare(
+                edges.begin(), edges.end(), other.edges.begin(), other.edges.end(),
+                [](const DirectedEdge& a, const DirectedEdge& b) {
+                    return std::make_tuple(a.from(), a.to(), a.weight()) < std::make_tuple(b.from(), b.to(), b.weight());
+                });
+        }
+    };
+
+    // Per-thread spur search state
+    struct Worker {
+        DijkstraQuery<GraphType> engine;
+        std::vector<bool> removed;  // removed[v] = v is on the current root path
+
+        explicit Worker(const GraphType& g) : engine(g), removed(g.V(), false) {}
+    };
+
+    const GraphType& g;
+    ThreadPool pool;
+    std::vector<std::unique_ptr<Worker>> workers;  // one per pool thread
+    int spurs = 0;                                 // spur searches run by the last query
+
+    void validateVertex(const int v) const {
+        if (v < 0 || v >= g.V()) {
+            throw std::invalid_argument("Vertex " + std::to_string(v) +
+                                      " is out of range [0, " + std::to_string(g.V()) + ")");
+        }
+    }
+
+    // Runs the spur search from vertex i of path, writing the candidate (if any) to result
+    void spur(Worker& worker, const std::vector<DirectedEdge>& path, const int i,
+              const std::vector<Candidate>& accepted, const int t, std::vector<std::optional<Candidate>>& result) const {
+        const int spurVertex = (i == 0) ? path.front().from() : path[i - 1].to();
+
+        // Edges leaving the spur vertex that accepted paths with this root path take next
+        std::vector<DirectedEdge> blocked;
+        for (const Candidate& a : accepted) {
+            if (static_cast<int>(a.edges.size()) > i && std::equal(path.begin(), path.begin() + i, a.edges.begin())) {
+                blocked.push_back(a.edges[i]);
+            }
+        }
+        for (int j = 0; j < i; ++j) worker.removed[path[j].from()] = true;
+
+        worker.engine.query(spurVertex, t, [&](const DirectedEdge& e) {
+            if (worker.removed[e.to()]) return false;
+            if (e.from() != spurVertex) return true;
+            for (const DirectedEdge& b : blocked) {
+                if (e == b) return false;
+            }
+            return true;
+        });
+
+        for (int j = 0; j < i; ++j) worker.removed[path[j].from()] = false;
+        if (!worker.engine.hasPath()) return;
+
+        // Summed edge by edge so the same path found from two spurs gets the same length
+        Candidate candidate{0.0, std::vector<DirectedEdge>(path.begin(), path.begin() + i)};
+        for (const DirectedEdge& e : worker.engine.path()) candidate.edges.push_back(e);
+        for (const DirectedEdge& e : candidate.edges) candidate.length += e.weight();
+        result[i] = std::move(candidate);
+    }
+
+public:
+    /**
+     * Binds the engine to an edge-weighted digraph.
+     *
+     * @param g the edge-weighted digraph
+     * @param threads the number of threads for spur searches (defaults to the hardware concurrency)
+     * @throws std::invalid_argument if any edge has negative weight or threads is not positive
+     */
+    explicit YenKShortestPaths(const GraphType& g, const int threads = ThreadPool::defaultThreads()) :
+        g(g),
+        pool(threads) {
+        for (int t = 0; t < pool.size(); ++t) workers.push_back(std::make_unique<Worker>(g));
+    }
+
+    YenKShortestPaths(const YenKShortestPaths&) = delete;
+    YenKShortestPaths& operator=(const YenKShortestPaths&) = delete;
+
+    /**
+     * Computes up to k shortest loopless paths from s to t, shortest first.
+     * Fewer than k paths are returned if fewer exist; the only path from a
+     * vertex to itself is the empty one.
+     *
+     * @param s the source vertex
+     * @param t the target vertex
+     * @param k the maximum number of paths
+     * @return the paths as sequences of directed edges
+     * @throws std::invalid_argument if s or t is invalid or k is negative
+     */
+    std::vector<std::vector<DirectedEdge>> query(const int s, const int t, const int k) {
+        validateVertex(s);
+        validateVertex(t);
+        if (k < 0) throw std::invalid_argument("Number of paths cannot be negative, got: " + std::to_string(k));
+        spurs = 0;
+
+        std::vector<Candidate> accepted;
+        if (k > 0) {
+            DijkstraQuery<GraphType>& engine = workers.front()->engine;
+            engine.query(s, t);
+            if (engine.hasPath()) {
+                Candidate shortest{0.0, engine.path()};
+                for (const DirectedEdge& e : shortest.edges) shortest.length += e.weight();
+                accepted.push_back(std::move(shortest));
+            }
+        }
+
+        std::set<Candidate> candidates;
+        while (!accepted.empty() && static_cast<int>(accepted.size()) < k) {
+            const std::vector<DirectedEdge> path = accepted.back().edges;
+            const int n = static_cast<int>(path.size());
+
+            std::vector<std::optional<Candidate>> found(n);  // found[i] = candidate from spur vertex i
+            std::atomic<int> next{0};
+            pool.run([&](const int thread) {
+                for (int i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+                    spur(*workers[thread], path, i, accepted, t, found);
+                }
+            });
+            spurs += n;
+
+            for (std::optional<Candidate>& c : found) {
+                if (c.has_value()) candidates.insert(std::move(*c));
+            }
+            if (candidates.empty()) break;
+            accepted.push_back(*candidates.begin());
+            candidates.erase(candidates.begin());
+        }
+
+        std::vector<std::vector<DirectedEdge>> paths;
+        paths.reserve(accepted.size());
+        for (Candidate& c : accepted) paths.push_back(std::move(c.edges));
+        return paths;
+    }
+
+    // Number of spur searches run by the last query
+    int spurCount() const { return spurs; }
+
+    // Number of threads used for spur searches
+    int threads() const { return pool.size(); }
+
+    // Number of vertices in the bound digraph
+    int V() const { return g.V(); }
+};
@@ -0,0 +1,174 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../data_structures/AStarSearch.hpp"
+#include "../data_structures/BidirectionalDijkstra.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraQuery.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Road-like grid: n x n vertices at integer coordinates, edges to the four
+// neighbors in both directions, weight = length * random detour factor in [1, 1.5)
+struct Grid {
+    EdgeWeightedDigraph g;
+    std::vector<std::pair<double, double>> coordinates;
+
+    Grid(const int n, const unsigned seed) : g(n * n), coordinates(n * n) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> detour(1.0, 1.5);
+        for (int r = 0; r < n; ++r) {
+            for (int c = 0; c < n; ++c) {
+                const int v = r * n + c;
+                coordinates[v] = {static_cast<double>(c), static_cast<double>(r)};
+                if (c + 1 < n) {
+                    g.addEdge(DirectedEdge(v, v + 1, detour(rng)));
+                    g.addEdge(DirectedEdge(v + 1, v, detour(rng)));
+                }
+                if (r + 1 < n) {
+                    g.addEdge(DirectedEdge(v, v + n, detour(rng)));
+                    g.addEdge(DirectedEdge(v + n, v, detour(rng)));
+                }
+            }
+        }
+    }
+};
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 3, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 0.5));
+    g.addEdge(DirectedEdge(2, 3, 2.0));
+
+    AStarSearch search(g, [](int, int) { return 0.0; });
+    assert(search.query(0, 3) == 2.0);
+    assert(search.path().size() == 2);
+    assert(search.path()[0] == DirectedEdge(0, 1, 1.0));
+    assert(search.query(3, 0) == std::numeric_limits<double>::max());
+    assert(!search.hasPath());
+    assert(search.query(2, 2) == 0.0);
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testEuclideanHeuristic() {
+    const Grid grid(30, 5);
+    AStarSearch search(grid.g, EuclideanHeuristic(grid.coordinates));
+
+    for (const int s : {0, 17, 455, 899}) {
+        const DijkstraSP sp(grid.g, s);
+        for (int t = 0; t < grid.g.V(); t += 3) {
+            assert(close(search.query(s, t), sp.distTo(t)));
+            double total = 0.0;
+            int at = s;
+            for (const DirectedEdge& e : search.path()) {
+                assert(e.from() == at);
+                at = e.to();
+                total += e.weight();
+            }
+            assert(at == t);
+            assert(close(total, sp.distTo(t)));
+        }
+    }
+
+    std::cout << "testEuclideanHeuristic passed\n";
+}
+
+void testInconsistentHeuristic() {
+    // Admissible but inconsistent: vertex 1 looks much closer to the target than it is
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 4.0));
+    g.addEdge(DirectedEdge(2, 1, 1.0));  // unused
+    g.addEdge(DirectedEdge(1, 3, 4.0));
+    g.addEdge(DirectedEdge(2, 3, 0.5));
+    const std::vector<double> h = {4.5, 0.0, 0.5, 0.0};
+
+    AStarSearch search(g, [&](const int v, int) { return h[v]; });
+    assert(search.query(0, 3) == 4.5);
+
+    // Generic callables work through the default std::function parameter
+    AStarSearch<EdgeWeightedDigraph> generic(g, [](int, int) { return 0.0; });
+    assert(generic.query(0, 3) == 4.5);
+
+    std::cout << "testInconsistentHeuristic passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        AStarSearch search(negative, [](int, int) { return 0.0; });
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        EuclideanHeuristic h({{0.0, 0.0}}, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(2);
+    AStarSearch search(g, [](int, int) { return 0.0; });
+    try {
+        search.query(0, 2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: vertices settled per query by each point-to-point search on a road-like grid
+void benchmarkSettledVertices() {
+    const int n = 150;
+    const Grid grid(n, 42);
+    const CSREdgeWeightedDigraph g(grid.g);
+
+    DijkstraQuery<CSREdgeWeightedDigraph> dijkstra(g);
+    BidirectionalDijkstra<CSREdgeWeightedDigraph> bidirectional(g);
+    AStarSearch astar(g, EuclideanHeuristic(grid.coordinates));
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> vertex(0, g.V() - 1);
+    const int queries = 100;
+    long long settledDijkstra = 0, settledBidirectional = 0, settledAStar = 0;
+    for (int i = 0; i < queries; ++i) {
+        const int s = vertex(rng), t = vertex(rng);
+        const double d = dijkstra.query(s, t);
+        assert(close(bidirectional.query(s, t), d));
+        assert(close(astar.query(s, t), d));
+        settledDijkstra += dijkstra.settledCount();
+        settledBidirectional += bidirectional.settledCount();
+        settledAStar += astar.settledCount();
+    }
+
+    std::cout << "benchmarkSettledVertices (" << g.V() << " vertices, average per query):\n"
+              << "  full DijkstraSP:       " << g.V() << "\n"
+              << "  DijkstraQuery:         " << settledDijkstra / queries << "\n"
+              << "  BidirectionalDijkstra: " << settledBidirectional / queries << "\n"
+              << "  AStarSearch:           " << settledAStar / queries << "\n";
+    assert(settledBidirectional < settledDijkstra);
+    assert(settledAStar < settledDijkstra);
+}
+
+int main() {
+    std::cout << "Running AStarSearch tests...\n";
+
+    testSmallDigraph();
+    testEuclideanHeuristic();
+    testInconsistentHeuristic();
+    testInvalidArguments();
+    benchmarkSettledVertices();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/AcyclicLP.hpp"
+#include "../data_structures/AcyclicSP.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+void testTinyDag() {
+    // tinyEWDAG from Algorithms, 4th Edition
+    EdgeWeightedDigraph g(8);
+    g.addEdge(DirectedEdge(5, 4, 0.35));
+    g.addEdge(DirectedEdge(4, 7, 0.37));
+    g.addEdge(DirectedEdge(5, 7, 0.28));
+    g.addEdge(DirectedEdge(5, 1, 0.32));
+    g.addEdge(DirectedEdge(4, 0, 0.38));
+    g.addEdge(DirectedEdge(0, 2, 0.26));
+    g.addEdge(DirectedEdge(3, 7, 0.39));
+    g.addEdge(DirectedEdge(1, 3, 0.29));
+    g.addEdge(DirectedEdge(7, 2, 0.34));
+    g.addEdge(DirectedEdge(6, 2, 0.40));
+    g.addEdge(DirectedEdge(3, 6, 0.52));
+    g.addEdge(DirectedEdge(6, 0, 0.58));
+    g.addEdge(DirectedEdge(6, 4, 0.93));
+
+    const AcyclicLP lp(g, 5);
+    assert(lp.V() == 8);
+    const double expected[] = {2.44, 0.32, 2.77, 0.61, 2.06, 0.00, 1.13, 2.43};
+    for (int v = 0; v < 8; ++v) {
+        assert(lp.hasPathTo(v));
+        assert(nearlyEqual(lp.distTo(v), expected[v]));
+        assert(nearlyEqual(pathWeight(lp.pathTo(v), 5, v), expected[v]));
+    }
+    assert(lp.pathTo(2).size() == 6);  // 5->1->3->6->4->7->2
+
+    const AcyclicLP from3(g, 3);
+    assert(!from3.hasPathTo(5));
+    assert(from3.distTo(5) == std::numeric_limits<double>::lowest());
+    assert(from3.pathTo(5).empty());
+
+    std::cout << "testTinyDag passed\n";
+}
+
+void testCriticalPathSchedule() {
+    // jobsPC from Algorithms, 4th Edition: job i has a start vertex i and an end vertex i + n,
+    // joined by an edge of its duration; the source 2n and sink 2n + 1 frame the schedule
+    const int n = 10;
+    const double duration[] = {41.0, 51.0, 50.0, 36.0, 38.0, 45.0, 21.0, 32.0, 32.0, 29.0};
+    const std::vector<std::vector<int>> successors = {
+        {1, 7, 9}, {2}, {}, {}, {}, {}, {3, 8}, {3, 8}, {2}, {4, 6}};
+    const int source = 2 * n, sink = 2 * n + 1;
+    EdgeWeightedDigraph g(2 * n + 2);
+    for (int i = 0; i < n; ++i) {
+        g.addEdge(DirectedEdge(source, i, 0.0));
+        g.addEdge(DirectedEdge(i + n, sink, 0.0));
+        g.addEdge(DirectedEdge(i, i + n, duration[i]));
+        for (const int j : successors[i]) g.addEdge(DirectedEdge(i + n, j, 0.0));
+    }
+
+    const AcyclicLP lp(g, source);
+    const double start[] = {0.0, 41.0, 123.0, 91.0, 70.0, 0.0, 70.0, 41.0, 91.0, 41.0};
+    for (int i = 0; i < n; ++i) assert(lp.distTo(i) == start[i]);
+    assert(lp.distTo(sink) == 173.0);
+
+    std::cout << "testCriticalPathSchedule passed\n";
+}
+
+void testMatchesNegatedShortestPaths() {
+    // Longest paths are shortest paths with every weight negated
+    std::mt19937 rng(23);
+    const int V = 1500;
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(-1.0, 1.0);
+    std::vector<DirectedEdge> edges, negated;
+    for (int i = 0; i < 9000; ++i) {
+        const int a = vertex(rng), b = vertex(rng);
+        if (a == b) continue;
+        const double w = weight(rng);
+        edges.emplace_back(std::max(a, b), std::min(a, b), w);
+        negated.emplace_back(std::max(a, b), std::min(a, b), -w);
+    }
+    const CSREdgeWeightedDigraph g(V, edges);
+    const CSREdgeWeightedDigraph h(V, negated);
+    for (const int s : {V - 1, 900}) {
+        const AcyclicLP lp(g, s);
+        const AcyclicSP sp(h, s);
+        for (int v = 0; v < V; ++v) {
+            assert(lp.hasPathTo(v) == sp.hasPathTo(v));
+            if (!sp.hasPathTo(v)) continue;
+            assert(nearlyEqual(lp.distTo(v), -sp.distTo(v)));
+            assert(nearlyEqual(pathWeight(lp.pathTo(v), s, v), lp.distTo(v)));
+        }
+    }
+
+    std::cout << "testMatchesNegatedShortestPaths passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph cyclic(2);
+    cyclic.addEdge(DirectedEdge(0, 1, 1.0));
+    cyclic.addEdge(DirectedEdge(1, 0, 1.0));
+    try {
+        AcyclicLP lp(cyclic, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(2);
+    try {
+        AcyclicLP lp(g, -1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    const AcyclicLP lp(g, 1);
+    try {
+        lp.pathTo(2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running AcyclicLP tests...\n";
+
+    testTinyDag();
+    testCriticalPathSchedule();
+    testMatchesNegatedShortestPaths();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/AcyclicSP.hpp"
+#include "../data_structures/BellmanFordSP.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Random DAG: edges only go from a lower to a higher position of a shuffled vertex order
+std::vector<DirectedEdge> randomDagEdges(const int V, const int E, const double minWeight, const unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> label(V);
+    for (int v = 0; v < V; ++v) label[v] = v;
+    std::shuffle(label.begin(), label.end(), rng);
+    std::uniform_int_distribution<int> position(0, V - 1);
+    std::uniform_real_distribution<double> weight(minWeight, 1.0);
+    std::vector<DirectedEdge> edges;
+    while (static_cast<int>(edges.size()) < E) {
+        int a = position(rng), b = position(rng);
+        if (a == b) continue;
+        if (a > b) std::swap(a, b);
+        edges.emplace_back(label[a], label[b], weight(rng));
+    }
+    return edges;
+}
+
+void testTinyDag() {
+    // tinyEWDAG from Algorithms, 4th Edition
+    EdgeWeightedDigraph g(8);
+    g.addEdge(DirectedEdge(5, 4, 0.35));
+    g.addEdge(DirectedEdge(4, 7, 0.37));
+    g.addEdge(DirectedEdge(5, 7, 0.28));
+    g.addEdge(DirectedEdge(5, 1, 0.32));
+    g.addEdge(DirectedEdge(4, 0, 0.38));
+    g.addEdge(DirectedEdge(0, 2, 0.26));
+    g.addEdge(DirectedEdge(3, 7, 0.39));
+    g.addEdge(DirectedEdge(1, 3, 0.29));
+    g.addEdge(DirectedEdge(7, 2, 0.34));
+    g.addEdge(DirectedEdge(6, 2, 0.40));
+    g.addEdge(DirectedEdge(3, 6, 0.52));
+    g.addEdge(DirectedEdge(6, 0, 0.58));
+    g.addEdge(DirectedEdge(6, 4, 0.93));
+
+    const AcyclicSP sp(g, 5);
+    assert(sp.V() == 8);
+    const double expected[] = {0.73, 0.32, 0.62, 0.61, 0.35, 0.00, 1.13, 0.28};
+    for (int v = 0; v < 8; ++v) {
+        assert(sp.hasPathTo(v));
+        assert(nearlyEqual(sp.distTo(v), expected[v]));
+        assert(nearlyEqual(pathWeight(sp.pathTo(v), 5, v), expected[v]));
+    }
+    assert(sp.pathTo(5).empty());
+    assert(sp.pathTo(6).size() == 3);  // 5->1->3->6
+
+    // Vertices upstream of the source are unreachable
+    const AcyclicSP from3(g, 3);
+    assert(!from3.hasPathTo(5));
+    assert(!from3.hasPathTo(1));
+    assert(from3.distTo(1) == std::numeric_limits<double>::max());
+    assert(from3.pathTo(1).empty());
+    assert(nearlyEqual(from3.distTo(2), 0.73));
+
+    std::cout << "testTinyDag passed\n";
+}
+
+void testMatchesDijkstra() {
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        const std::vector<DirectedEdge> edges = randomDagEdges(2000, 12000, 0.0, seed);
+        EdgeWeightedDigraph g(2000);
+        for (const auto& e : edges) g.addEdge(e);
+        const CSREdgeWeightedDigraph csr(2000, edges);
+        for (const int s : {0, 1000}) {
+            const DijkstraSP expected(g, s);
+            const AcyclicSP sp(g, s);
+            const AcyclicSP spCsr(csr, s);
+            for (int v = 0; v < g.V(); ++v) {
+                assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+                assert(spCsr.hasPathTo(v) == expected.hasPathTo(v));
+                if (!expected.hasPathTo(v)) continue;
+                assert(nearlyEqual(sp.distTo(v), expected.distTo(v)));
+                assert(nearlyEqual(spCsr.distTo(v), expected.distTo(v)));
+                assert(nearlyEqual(pathWeight(sp.pathTo(v), s, v), expected.distTo(v)));
+            }
+        }
+    }
+
+    std::cout << "testMatchesDijkstra passed\n";
+}
+
+void testNegativeWeights() {
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 4.0));
+    g.addEdge(DirectedEdge(2, 1, -5.0));
+    g.addEdge(DirectedEdge(1, 3, 2.0));
+
+    const AcyclicSP sp(g, 0);
+    assert(sp.distTo(1) == -1.0);
+    assert(sp.distTo(3) == 1.0);
+    assert(sp.pathTo(3).size() == 3);
+
+    // Random DAGs with many negative weights agree with Bellman-Ford
+    const std::vector<DirectedEdge> edges = randomDagEdges(1000, 6000, -1.0, 17);
+    const CSREdgeWeightedDigraph dag(1000, edges);
+    for (const int s : {0, 500}) {
+        const BellmanFordSP expected(dag, s);
+        const AcyclicSP acyclic(dag, s);
+        for (int v = 0; v < dag.V(); ++v) {
+            assert(acyclic.hasPathTo(v) == expected.hasPathTo(v));
+            if (expected.hasPathTo(v)) assert(nearlyEqual(acyclic.distTo(v), expected.distTo(v)));
+        }
+    }
+
+    std::cout << "testNegativeWeights passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph cyclic(3);
+    cyclic.addEdge(DirectedEdge(0, 1, 1.0));
+    cyclic.addEdge(DirectedEdge(1, 2, 1.0));
+    cyclic.addEdge(DirectedEdge(2, 0, 1.0));
+    try {
+        AcyclicSP sp(cyclic, 0);
+        assert(false);
+    } catch (const std::invalid_argument& e) {
+        assert(std::string(e.what()).find("not acyclic") != std::string::npos);
+    }
+
+    const EdgeWeightedDigraph g(3);
+    try {
+        AcyclicSP sp(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    const AcyclicSP sp(g, 0);
+    try {
+        sp.distTo(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void benchmarkAgainstDijkstra() {
+    // Positions in topological order are the vertex ids, and a chain makes every vertex reachable from 0
+    const int V = 200000;
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<DirectedEdge> edges;
+    for (int v = 0; v + 1 < V; ++v) edges.emplace_back(v, v + 1, weight(rng));
+    while (static_cast<int>(edges.size()) < 1600000) {
+        const int a = vertex(rng), b = vertex(rng);
+        if (a != b) edges.emplace_back(std::min(a, b), std::max(a, b), weight(rng));
+    }
+    const CSREdgeWeightedDigraph g(V, edges);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    const DijkstraSP dijkstra(g, 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  DijkstraSP (V = " << V << ", E = " << g.E() << "): "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    const AcyclicSP acyclic(g, 0);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "  AcyclicSP:                                "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+    for (int v = 0; v < V; v += 97) {
+        assert(acyclic.hasPathTo(v) == dijkstra.hasPathTo(v));
+        assert(!dijkstra.hasPathTo(v) || nearlyEqual(acyclic.distTo(v), dijkstra.distTo(v)));
+    }
+
+    std::cout << "benchmarkAgainstDijkstra passed\n";
+}
+
+int main() {
+    std::cout << "Running AcyclicSP tests...\n";
+
+    testTinyDag();
+    testMatchesDijkstra();
+    testNegativeWeights();
+    testInvalidArguments();
+    benchmarkAgainstDijkstra();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
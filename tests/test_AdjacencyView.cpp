@@ -0,0 +1,83 @@
+#include <cassert>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "../data_structures/AdjacencyView.hpp"
+#include "../data_structures/Digraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+#include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/Graph.hpp"
+
+void testBasicOperations() {
+    const std::list<int> items = {4, 7, 9};
+    const AdjacencyView<std::list<int>::const_iterator> view(items.begin(), items.end(), items.size());
+
+    assert(view.size() == 3);
+    assert(!view.empty());
+    assert(view[0] == 4);
+    assert(view[2] == 9);
+
+    int sum = 0;
+    for (const int x : view) sum += x;
+    assert(sum == 20);
+
+    const int raw[] = {1, 2};
+    const AdjacencyView<const int*> empty(raw, raw, 0);
+    assert(empty.empty());
+    assert(empty.begin() == empty.end());
+
+    std::cout << "testBasicOperations passed\n";
+}
+
+void testConversionAndEquality() {
+    Graph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(0, 3);
+
+    // Implicit conversion produces an owning copy
+    std::vector<int> copy = g.adj(0);
+    assert((copy == std::vector{3, 2, 1}));
+    copy.clear();
+    assert(g.adj(0).size() == 3);
+
+    assert((g.adj(0) == std::vector{3, 2, 1}));
+    assert((std::vector{3, 2, 1} == g.adj(0)));
+    assert((g.adj(0) != std::vector{1, 2, 3}));
+    assert((g.adj(0) != std::vector{3, 2}));
+
+    std::cout << "testConversionAndEquality passed\n";
+}
+
+void testViewsDoNotCopy() {
+    Digraph g(3);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+
+    // Two views of the same vertex refer to the same stored elements
+    assert(&*g.adj(0).begin() == &*g.adj(0).begin());
+
+    EdgeWeightedGraph ewg(3);
+    ewg.addEdge(Edge(0, 1, 0.5));
+    assert(&ewg.adj(0)[0] == &ewg.adj(0)[0]);
+
+    EdgeWeightedDigraph ewd(3);
+    ewd.addEdge(DirectedEdge(0, 1, 0.5));
+    ewd.addEdge(DirectedEdge(0, 2, 1.5));
+    assert(&ewd.adj(0)[1] == &ewd.adj(0)[1]);
+    assert(ewd.adj(0)[0].to() == 2);
+
+    std::cout << "testViewsDoNotCopy passed\n";
+}
+
+int main() {
+    std::cout << "Running AdjacencyView tests...\n";
+
+    testBasicOperations();
+    testConversionAndEquality();
+    testViewsDoNotCopy();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BellmanFordSP.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Copy of g with every edge v->w reweighted by potential[v] - potential[w]
+EdgeWeightedDigraph shiftWeights(const EdgeWeightedDigraph& g, const std::vector<double>& potential) {
+    EdgeWeightedDigraph shifted(g.V());
+    for (const auto& e : g.edges()) {
+        shifted.addEdge(DirectedEdge(e.from(), e.to(), e.weight() + potential[e.from()] - potential[e.to()]));
+    }
+    return shifted;
+}
+
+void testSmallDigraph() {
+    // tinyEWDn from Algorithms, 4th Edition
+    EdgeWeightedDigraph g(8);
+    g.addEdge(DirectedEdge(4, 5, 0.35));
+    g.addEdge(DirectedEdge(5, 4, 0.35));
+    g.addEdge(DirectedEdge(4, 7, 0.37));
+    g.addEdge(DirectedEdge(5, 7, 0.28));
+    g.addEdge(DirectedEdge(7, 5, 0.28));
+    g.addEdge(DirectedEdge(5, 1, 0.32));
+    g.addEdge(DirectedEdge(0, 4, 0.38));
+    g.addEdge(DirectedEdge(0, 2, 0.26));
+    g.addEdge(DirectedEdge(7, 3, 0.39));
+    g.addEdge(DirectedEdge(1, 3, 0.29));
+    g.addEdge(DirectedEdge(2, 7, 0.34));
+    g.addEdge(DirectedEdge(6, 2, -1.20));
+    g.addEdge(DirectedEdge(3, 6, 0.52));
+    g.addEdge(DirectedEdge(6, 0, -1.40));
+    g.addEdge(DirectedEdge(6, 4, -1.25));
+
+    const BellmanFordSP sp(g, 0);
+    assert(!sp.hasNegativeCycle());
+    assert(sp.negativeCycle().empty());
+    assert(sp.V() == 8);
+    const double expected[] = {0.00, 0.93, 0.26, 0.99, 0.26, 0.61, 1.51, 0.60};
+    for (int v = 0; v < 8; ++v) {
+        assert(nearlyEqual(sp.distTo(v), expected[v]));
+        assert(nearlyEqual(pathWeight(sp.pathTo(v), 0, v), expected[v]));
+    }
+    assert(sp.pathTo(0).empty());
+    assert(sp.pathTo(4).size() == 5);  // 0->2->7->3->6->4
+    assert(sp.relaxations() > 0);
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testUnreachable() {
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, -2.0));
+    g.addEdge(DirectedEdge(2, 3, -5.0));
+    g.addEdge(DirectedEdge(3, 2, 1.0));  // negative cycle, but not reachable from 0
+
+    const BellmanFordSP sp(g, 0);
+    assert(!sp.hasNegativeCycle());
+    assert(sp.distTo(1) == -2.0);
+    assert(!sp.hasPathTo(2));
+    assert(sp.distTo(3) == std::numeric_limits<double>::max());
+    assert(sp.pathTo(3).empty());
+
+    std::cout << "testUnreachable passed\n";
+}
+
+void testMatchesDijkstra() {
+    for (int trial = 0; trial < 5; ++trial) {
+        const EdgeWeightedDigraph g(300, 2000);
+        const CSREdgeWeightedDigraph csr(g);
+        for (const int s : {0, 17, 299}) {
+            const DijkstraSP expected(g, s);
+            const BellmanFordSP sp(g, s);
+            const BellmanFordSP spCsr(csr, s);
+            assert(!sp.hasNegativeCycle());
+            for (int v = 0; v < g.V(); ++v) {
+                assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+                if (!expected.hasPathTo(v)) continue;
+                assert(nearlyEqual(sp.distTo(v), expected.distTo(v)));
+                assert(nearlyEqual(spCsr.distTo(v), expected.distTo(v)));
+                assert(nearlyEqual(pathWeight(sp.pathTo(v), s, v), expected.distTo(v)));
+            }
+        }
+    }
+
+    std::cout << "testMatchesDijkstra passed\n";
+}
+
+void testNegativeWeights() {
+    // Shifting by potentials keeps shortest paths but makes many weights negative
+    const EdgeWeightedDigraph base(400, 3000);
+    std::vector<double> potential(base.V());
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> shift(0.0, 2.0);
+    for (double& p : potential) p = shift(rng);
+    const EdgeWeightedDigraph g = shiftWeights(base, potential);
+
+    for (const int s : {0, 123}) {
+        const DijkstraSP expected(base, s);
+        const BellmanFordSP sp(g, s);
+        assert(!sp.hasNegativeCycle());
+        for (int v = 0; v < g.V(); ++v) {
+            assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+            if (!expected.hasPathTo(v)) continue;
+            const double shifted = expected.distTo(v) + potential[s] - potential[v];
+            assert(std::abs(sp.distTo(v) - shifted) < 1e-9);
+            assert(std::abs(pathWeight(sp.pathTo(v), s, v) - shifted) < 1e-9);
+        }
+    }
+
+    std::cout << "testNegativeWeights passed\n";
+}
+
+void testNegativeCycle() {
+    // tinyEWDnc from Algorithms, 4th Edition: 5->4->7->5 has weight -0.66 + 0.37 + 0.28
+    EdgeWeightedDigraph g(8);
+    g.addEdge(DirectedEdge(4, 5, 0.35));
+    g.addEdge(DirectedEdge(5, 4, -0.66));
+    g.addEdge(DirectedEdge(4, 7, 0.37));
+    g.addEdge(DirectedEdge(5, 7, 0.28));
+    g.addEdge(DirectedEdge(7, 5, 0.28));
+    g.addEdge(DirectedEdge(5, 1, 0.32));
+    g.addEdge(DirectedEdge(0, 4, 0.38));
+    g.addEdge(DirectedEdge(0, 2, 0.26));
+    g.addEdge(DirectedEdge(7, 3, 0.39));
+    g.addEdge(DirectedEdge(1, 3, 0.29));
+    g.addEdge(DirectedEdge(2, 7, 0.34));
+    g.addEdge(DirectedEdge(6, 2, 0.40));
+    g.addEdge(DirectedEdge(3, 6, 0.52));
+    g.addEdge(DirectedEdge(6, 0, 0.58));
+    g.addEdge(DirectedEdge(6, 4, 0.93));
+
+    const BellmanFordSP sp(g, 0);
+    assert(sp.hasNegativeCycle());
+    const std::vector<DirectedEdge> cycle = sp.negativeCycle();
+    assert(!cycle.empty());
+    assert(pathWeight(cycle, cycle.front().from(), cycle.front().from()) < 0.0);
+    try {
+        sp.distTo(1);
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        sp.pathTo(1);
+        assert(false);
+    } catch (const std::logic_error&) {}
+
+    // Negative self-loop on the source
+    EdgeWeightedDigraph loop(2);
+    loop.addEdge(DirectedEdge(0, 0, -1.0));
+    loop.addEdge(DirectedEdge(0, 1, 1.0));
+    const BellmanFordSP spLoop(loop, 0);
+    assert(spLoop.hasNegativeCycle());
+    assert(spLoop.negativeCycle().size() == 1);
+
+    // Random digraphs: any reported cycle is real and negative
+    int found = 0;
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> vertex(0, 199);
+        std::uniform_real_distribution<double> weight(-0.2, 1.0);
+        EdgeWeightedDigraph r(200);
+        for (int i = 0; i < 600; ++i) r.addEdge(DirectedEdge(vertex(rng), vertex(rng), weight(rng)));
+        const BellmanFordSP rsp(r, 0);
+        if (!rsp.hasNegativeCycle()) continue;
+        ++found;
+        const std::vector<DirectedEdge> c = rsp.negativeCycle();
+        assert(pathWeight(c, c.front().from(), c.front().from()) < 0.0);
+    }
+    assert(found > 0);
+
+    std::cout << "testNegativeCycle passed\n";
+}
+
+void testLongNegativeCycle() {
+    // One long cycle: the predecessor chain checked for cycles is V edges deep
+    const int V = 200000;
+    std::vector<DirectedEdge> edges;
+    for (int v = 0; v + 1 < V; ++v) edges.emplace_back(v, v + 1, -1.0);
+    edges.emplace_back(V - 1, 0, 1.0);
+    const BellmanFordSP sp(CSREdgeWeightedDigraph(V, edges), 0);
+    assert(sp.hasNegativeCycle());
+    assert(static_cast<int>(sp.negativeCycle().size()) == V);
+
+    std::cout << "testLongNegativeCycle passed\n";
+}
+
+void testInvalidArguments() {
+    const EdgeWeightedDigraph g(3);
+    try {
+        BellmanFordSP sp(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const BellmanFordSP sp(g, 0);
+    try {
+        sp.distTo(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        sp.pathTo(3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running BellmanFordSP tests...\n";
+
+    testSmallDigraph();
+    testUnreachable();
+    testMatchesDijkstra();
+    testNegativeWeights();
+    testNegativeCycle();
+    testLongNegativeCycle();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BidirectionalBFS.hpp"
+#include "../data_structures/BreadthFirstDirectedPaths.hpp"
+#include "../data_structures/CSRDigraph.hpp"
+#include "../data_structures/DigraphGenerator.hpp"
+
+// Checks that path follows edges of g from s to t
+template <typename GraphType>
+bool isPath(const GraphType& g, const std::vector<int>& path, const int s, const int t) {
+    if (path.empty() || path.front() != s || path.back() != t) return false;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        bool found = false;
+        for (const int w : g.adj(path[i])) found = found || w == path[i + 1];
+        if (!found) return false;
+    }
+    return true;
+}
+
+void testSmallDigraph() {
+    Digraph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(0, 4);
+    g.addEdge(4, 3);
+    g.addEdge(3, 5);
+
+    BidirectionalBFS query(g);
+    assert(query.distance(0, 5) == 3);
+    assert((query.path(0, 5) == std::vector<int>{0, 4, 3, 5}));
+    assert(query.hasPath(1, 5));
+    assert(!query.hasPath(5, 0));
+    assert(query.path(5, 0).empty());
+    assert(query.distance(5, 0) == std::numeric_limits<int>::max());
+    assert(query.path(2, 2) == std::vector<int>{2});
+    assert(query.distance(2, 2) == 0);
+    assert((query.path(2, 3) == std::vector<int>{2, 3}));
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesBreadthFirstDirectedPaths() {
+    const Digraph g = DigraphGenerator::simple(500, 1500);
+    BidirectionalBFS query(g);
+
+    for (int s = 0; s < 20; ++s) {
+        const BreadthFirstDirectedPaths bfs(g, s);
+        for (int t = 0; t < g.V(); ++t) {
+            assert(query.hasPath(s, t) == bfs.hasPathTo(t));
+            assert(query.distance(s, t) == bfs.distTo(t));
+            if (bfs.hasPathTo(t)) {
+                const std::vector<int> path = query.path(s, t);
+                assert(static_cast<int>(path.size()) == bfs.distTo(t) + 1);
+                assert(isPath(g, path, s, t));
+            }
+        }
+    }
+
+    std::cout << "testMatchesBreadthFirstDirectedPaths passed\n";
+}
+
+void testSharedReverse() {
+    const CSRDigraph g(DigraphGenerator::simple(300, 1200));
+    const CSRDigraph reverse = g.reverse();
+    BidirectionalBFS<CSRDigraph> query(g, reverse);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> vertex(0, g.V() - 1);
+    for (int i = 0; i < 500; ++i) {
+        const int s = vertex(rng), t = vertex(rng);
+        const BreadthFirstDirectedPaths bfs(g, s);
+        assert(query.distance(s, t) == bfs.distTo(t));
+    }
+
+    std::cout << "testSharedReverse passed\n";
+}
+
+void testQueryTouchesFewVertices() {
+    // Long path 0 -> 1 -> ... -> n-1: a query between neighbors must not scan the whole path
+    const int n = 100000;
+    Digraph g(n);
+    for (int v = 0; v + 1 < n; ++v) g.addEdge(v, v + 1);
+
+    BidirectionalBFS query(g);
+    assert(query.distance(500, 503) == 3);
+    assert(query.verticesVisited() <= 5);
+    assert(query.distance(0, n - 1) == n - 1);
+    assert(query.distance(10, 12) == 2);
+    assert(query.verticesVisited() <= 4);
+
+    std::cout << "testQueryTouchesFewVertices passed\n";
+}
+
+void testInvalidArguments() {
+    const Digraph g(3);
+    BidirectionalBFS query(g);
+    try {
+        query.path(0, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        query.distance(-1, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        BidirectionalBFS<Digraph> bad(g, Digraph(2));
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running BidirectionalBFS tests...\n";
+
+    testSmallDigraph();
+    testMatchesBreadthFirstDirectedPaths();
+    testSharedReverse();
+    testQueryTouchesFewVertices();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
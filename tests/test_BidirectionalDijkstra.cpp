@@ -0,0 +1,139 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BidirectionalDijkstra.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 3, 1.0));
+    g.addEdge(DirectedEdge(0, 4, 1.5));
+    g.addEdge(DirectedEdge(4, 3, 1.0));
+    g.addEdge(DirectedEdge(5, 0, 1.0));
+
+    BidirectionalDijkstra query(g);
+    assert(query.query(0, 3) == 2.5);
+    assert(query.hasPath());
+    const std::vector<DirectedEdge> path = query.path();
+    assert(path.size() == 2);
+    assert(path[0] == DirectedEdge(0, 4, 1.5));
+    assert(path[1] == DirectedEdge(4, 3, 1.0));
+
+    assert(query.query(0, 1) == 1.0);
+    assert(query.path().size() == 1);
+
+    assert(query.query(3, 0) == std::numeric_limits<double>::max());
+    assert(!query.hasPath());
+    assert(query.path().empty());
+
+    assert(query.query(5, 5) == 0.0);
+    assert(query.path().empty());
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesDijkstraSP() {
+    const EdgeWeightedDigraph g(300, 2000);
+    BidirectionalDijkstra query(g);
+
+    for (int s = 0; s < 10; ++s) {
+        const DijkstraSP sp(g, s);
+        for (int t = 0; t < g.V(); ++t) {
+            const double d = query.query(s, t);
+            assert(query.hasPath() == sp.hasPathTo(t));
+            if (!sp.hasPathTo(t)) {
+                assert(d == std::numeric_limits<double>::max());
+                continue;
+            }
+            assert(close(d, sp.distTo(t)));
+            assert(close(pathWeight(query.path(), s, t), sp.distTo(t)));
+        }
+    }
+
+    std::cout << "testMatchesDijkstraSP passed\n";
+}
+
+void testZeroWeightsAndSharedReverse() {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> vertex(0, 99);
+    std::uniform_int_distribution<int> weight(0, 2);
+    std::vector<DirectedEdge> edges;
+    for (int i = 0; i < 400; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    const CSREdgeWeightedDigraph g(100, edges);
+    const CSREdgeWeightedDigraph reverse = g.reverse();
+
+    BidirectionalDijkstra<CSREdgeWeightedDigraph> query(g, reverse);
+    for (int s = 0; s < 100; s += 7) {
+        const DijkstraSP sp(g, s);
+        for (int t = 0; t < 100; ++t) {
+            assert(query.query(s, t) == sp.distTo(t));
+            if (sp.hasPathTo(t)) assert(pathWeight(query.path(), s, t) == sp.distTo(t));
+        }
+    }
+
+    std::cout << "testZeroWeightsAndSharedReverse passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        BidirectionalDijkstra query(negative);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(3);
+    try {
+        BidirectionalDijkstra<EdgeWeightedDigraph> query(g, EdgeWeightedDigraph(2));
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    BidirectionalDijkstra query(g);
+    try {
+        query.path();
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        query.query(3, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running BidirectionalDijkstra tests...\n";
+
+    testSmallDigraph();
+    testMatchesDijkstraSP();
+    testZeroWeightsAndSharedReverse();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "../data_structures/BreadthFirstDirectedPaths.hpp"
+#include "../data_structures/CSRDigraph.hpp"
+#include "../data_structures/DepthFirstDirectedPaths.hpp"
+#include "../data_structures/DepthFirstOrder.hpp"
+#include "../data_structures/Digraph.hpp"
+#include "../data_structures/DigraphGenerator.hpp"
+#include "../data_structures/DirectedCycle.hpp"
+#include "../data_structures/GabowSCC.hpp"
+#include "../data_structures/KosarajuSharirSCC.hpp"
+#include "../data_structures/TarjanSCC.hpp"
+#include "../data_structures/Topological.hpp"
+#include "../data_structures/TransitiveClosure.hpp"
+
+// Collects a view into a vector for easy comparison
+template <typename View>
+std::vector<int> toVector(const View& view) {
+    return std::vector<int>(view.begin(), view.end());
+}
+
+void assertSameDigraph(const Digraph& g, const CSRDigraph& csr) {
+    assert(csr.V() == g.V());
+    assert(csr.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(toVector(csr.adj(v)) == g.adj(v));
+        assert(csr.outdegree(v) == g.outdegree(v));
+        assert(csr.indegree(v) == g.indegree(v));
+    }
+}
+
+void testFromDigraph() {
+    Digraph g(5);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(1, 2);
+    g.addEdge(2, 0);
+    g.addEdge(3, 3);
+
+    const CSRDigraph csr(g);
+    assertSameDigraph(g, csr);
+
+    // Neighbor order matches Digraph (most recent edge first)
+    assert((toVector(csr.adj(0)) == std::vector{2, 1}));
+    assert(csr.adj(4).empty());
+    assert(csr.adj(0).size() == 2);
+    assert(csr.adj(0)[0] == 2);
+
+    std::cout << "testFromDigraph passed\n";
+}
+
+void testFromEdgeList() {
+    const std::vector<std::pair<int, int>> edges = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {3, 3}, {0, 4}};
+
+    Digraph g(5);
+    for (const auto& [v, w] : edges) g.addEdge(v, w);
+
+    const CSRDigraph csr(5, edges);
+    assertSameDigraph(g, csr);
+
+    std::cout << "testFromEdgeList passed\n";
+}
+
+void testEmpty() {
+    const CSRDigraph csr(0, {});
+    assert(csr.V() == 0);
+    assert(csr.E() == 0);
+
+    const CSRDigraph isolated(Digraph(3));
+    assert(isolated.V() == 3);
+    assert(isolated.E() == 0);
+    for (int v = 0; v < 3; ++v) assert(isolated.adj(v).empty());
+
+    std::cout << "testEmpty passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        CSRDigraph csr(-1, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        CSRDigraph csr(3, {{0, 3}});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSRDigraph csr(3, {{0, 1}});
+    try {
+        csr.adj(3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        csr.outdegree(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void testReverse() {
+    const Digraph g = DigraphGenerator::simple(30, 120);
+    const CSRDigraph csr(g);
+
+    assertSameDigraph(g.reverse(), csr.reverse());
+    assertSameDigraph(g.reverse().reverse(), csr.reverse().reverse());
+
+    std::cout << "testReverse passed\n";
+}
+
+void testTraversalsMatchDigraph() {
+    const Digraph g = DigraphGenerator::simple(60, 200);
+    const CSRDigraph csr(g);
+
+    const BreadthFirstDirectedPaths bfs1(g, 0), bfs2(csr, 0);
+    const DepthFirstDirectedPaths dfs1(g, 0), dfs2(csr, 0);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(bfs1.hasPathTo(v) == bfs2.hasPathTo(v));
+        assert(bfs1.distTo(v) == bfs2.distTo(v));
+        assert(bfs1.pathTo(v) == bfs2.pathTo(v));
+        assert(dfs1.pathTo(v) == dfs2.pathTo(v));
+    }
+
+    const DepthFirstOrder order1(g), order2(csr);
+    assert(order1.pre() == order2.pre());
+    assert(order1.post() == order2.post());
+
+    const KosarajuSharirSCC ks1(g), ks2(csr);
+    const TarjanSCC t1(g), t2(csr);
+    const GabowSCC gb1(g), gb2(csr);
+    assert(ks1.count() == ks2.count());
+    assert(t1.count() == t2.count());
+    assert(gb1.count() == gb2.count());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(ks1.id(v) == ks2.id(v));
+        assert(t1.id(v) == t2.id(v));
+        assert(gb1.id(v) == gb2.id(v));
+    }
+
+    const TransitiveClosure tc1(g), tc2(csr);
+    for (int v = 0; v < g.V(); ++v)
+        for (int w = 0; w < g.V(); ++w)
+            assert(tc1.reachable(v, w) == tc2.reachable(v, w));
+
+    const DirectedCycle cycle1(g), cycle2(csr);
+    assert(cycle1.cycle() == cycle2.cycle());
+
+    std::cout << "testTraversalsMatchDigraph passed\n";
+}
+
+void testTopological() {
+    const Digraph dag = DigraphGenerator::dag(40, 100);
+    const CSRDigraph csr(dag);
+
+    const Topological t1(dag), t2(csr);
+    assert(t2.hasOrder());
+    assert(t1.order() == t2.order());
+    for (int v = 0; v < csr.V(); ++v) {
+        for (const int w : csr.adj(v)) {
+            assert(t2.rank(v) < t2.rank(w));
+        }
+    }
+
+    const CSRDigraph cyclic(3, {{0, 1}, {1, 2}, {2, 0}});
+    assert(!Topological(cyclic).hasOrder());
+
+    std::cout << "testTopological passed\n";
+}
+
+void testStreamOutput() {
+    Digraph g(3);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+
+    std::ostringstream expected, actual;
+    expected << g;
+    actual << CSRDigraph(g);
+    assert(expected.str() == actual.str());
+
+    std::cout << "testStreamOutput passed\n";
+}
+
+int main() {
+    std::cout << "Running CSRDigraph tests...\n";
+
+    testFromDigraph();
+    testFromEdgeList();
+    testEmpty();
+    testInvalidArguments();
+    testReverse();
+    testTraversalsMatchDigraph();
+    testTopological();
+    testStreamOutput();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+void testMatchesEdgeWeightedDigraph() {
+    const EdgeWeightedDigraph g(40, 200);
+    const CSREdgeWeightedDigraph csr(g);
+
+    assert(csr.V() == g.V());
+    assert(csr.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(g.adj(v) == std::vector<DirectedEdge>(csr.adj(v)));
+        assert(csr.outdegree(v) == g.outdegree(v));
+        assert(csr.indegree(v) == g.indegree(v));
+    }
+    assert(csr.edges() == g.edges());
+
+    std::cout << "testMatchesEdgeWeightedDigraph passed\n";
+}
+
+void testEdgeListConstructor() {
+    const std::vector<DirectedEdge> edges = {
+        DirectedEdge(0, 1, 0.5), DirectedEdge(0, 2, 1.5), DirectedEdge(2, 3, 0.25),
+        DirectedEdge(1, 3, 2.0), DirectedEdge(3, 3, 0.1), DirectedEdge(0, 3, 4.0)
+    };
+    EdgeWeightedDigraph g(5);
+    for (const DirectedEdge& e : edges) g.addEdge(e);
+    const CSREdgeWeightedDigraph csr(5, edges);
+
+    assert(csr.E() == 6);
+    for (int v = 0; v < 5; ++v) {
+        assert(g.adj(v) == std::vector<DirectedEdge>(csr.adj(v)));
+        assert(csr.indegree(v) == g.indegree(v));
+    }
+    assert(csr.adj(0)[0] == DirectedEdge(0, 3, 4.0));
+    assert(csr.adj(4).empty());
+    assert(csr.edges() == g.edges());
+
+    std::cout << "testEdgeListConstructor passed\n";
+}
+
+void testReverse() {
+    const EdgeWeightedDigraph g(30, 100);
+    const CSREdgeWeightedDigraph csr(g);
+
+    assert(csr.reverse().edges() == g.reverse().edges());
+    assert(csr.reverse().reverse().edges() == g.reverse().reverse().edges());
+
+    std::cout << "testReverse passed\n";
+}
+
+void testDijkstra() {
+    const EdgeWeightedDigraph g(50, 300);
+    const CSREdgeWeightedDigraph csr(g);
+
+    const DijkstraSP sp1(g, 0), sp2(csr, 0);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sp1.hasPathTo(v) == sp2.hasPathTo(v));
+        assert(sp1.distTo(v) == sp2.distTo(v));
+        assert(sp1.pathTo(v) == sp2.pathTo(v));
+    }
+
+    std::cout << "testDijkstra passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        CSREdgeWeightedDigraph g(-1, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        CSREdgeWeightedDigraph g(2, {DirectedEdge(0, 2, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSREdgeWeightedDigraph g(2, {DirectedEdge(0, 1, 1.0)});
+    try {
+        g.adj(2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        g.indegree(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSREdgeWeightedDigraph empty(0, {});
+    assert(empty.V() == 0 && empty.E() == 0);
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running CSREdgeWeightedDigraph tests...\n";
+
+    testMatchesEdgeWeightedDigraph();
+    testEdgeListConstructor();
+    testReverse();
+    testDijkstra();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedGraph.hpp"
+#include "../data_structures/DijkstraUndirectedSP.hpp"
+#include "../data_structures/IndexDaryMinPQ.hpp"
+#include "../data_structures/PrimMST.hpp"
+
+// Edge::operator== compares weights only, so compare endpoints too
+bool sameEdges(const std::vector<Edge>& a, const std::vector<Edge>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const int v = a[i].either();
+        if (b[i].either() != v || b[i].other(v) != a[i].other(v) || b[i].weight() != a[i].weight()) return false;
+    }
+    return true;
+}
+
+void testMatchesEdgeWeightedGraph() {
+    EdgeWeightedGraph g(40, 200);
+    g.addEdge(Edge(3, 3, 0.75));  // self-loop, listed once
+    const CSREdgeWeightedGraph csr(g);
+
+    assert(csr.V() == g.V());
+    assert(csr.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sameEdges(g.adj(v), csr.adj(v)));
+        assert(csr.degree(v) == g.degree(v));
+    }
+    assert(sameEdges(csr.edges(), g.edges()));
+
+    std::cout << "testMatchesEdgeWeightedGraph passed\n";
+}
+
+void testEdgeListConstructor() {
+    const std::vector<Edge> edges = {
+        Edge(0, 1, 0.5), Edge(0, 2, 1.5), Edge(2, 3, 0.25),
+        Edge(1, 3, 2.0), Edge(3, 3, 0.1), Edge(0, 3, 4.0)
+    };
+    EdgeWeightedGraph g(5);
+    for (const Edge& e : edges) g.addEdge(e);
+    const CSREdgeWeightedGraph csr(5, edges);
+
+    assert(csr.E() == 6);
+    for (int v = 0; v < 5; ++v) {
+        assert(sameEdges(g.adj(v), csr.adj(v)));
+    }
+    assert(csr.adj(0)[0].other(0) == 3);
+    assert(csr.degree(3) == 4);
+    assert(csr.adj(4).empty());
+    assert(sameEdges(csr.edges(), g.edges()));
+
+    std::cout << "testEdgeListConstructor passed\n";
+}
+
+void testAlgorithms() {
+    const EdgeWeightedGraph g(300, 2000);
+    const CSREdgeWeightedGraph csr(g);
+
+    const PrimMST prim1(g), prim2(csr);
+    const PrimMST<IndexDaryMinPQ<double, 4>> prim3(csr);
+    assert(sameEdges(prim1.edges(), prim2.edges()));
+    assert(std::abs(prim1.weight() - prim3.weight()) < 1e-9);  // ties may pick another tree of equal weight
+
+    const DijkstraUndirectedSP sp1(g, 0), sp2(csr, 0);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sp1.hasPathTo(v) == sp2.hasPathTo(v));
+        assert(sp1.distTo(v) == sp2.distTo(v));
+    }
+
+    std::cout << "testAlgorithms passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        CSREdgeWeightedGraph g(-1, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        CSREdgeWeightedGraph g(2, {Edge(0, 2, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSREdgeWeightedGraph g(2, {Edge(0, 1, 1.0)});
+    try {
+        g.adj(2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        g.degree(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSREdgeWeightedGraph empty(0, {});
+    assert(empty.V() == 0 && empty.E() == 0);
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running CSREdgeWeightedGraph tests...\n";
+
+    testMatchesEdgeWeightedGraph();
+    testEdgeListConstructor();
+    testAlgorithms();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
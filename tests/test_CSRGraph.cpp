@@ -0,0 +1,145 @@
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "../data_structures/Bipartite.hpp"
+#include "../data_structures/BreadthFirstPaths.hpp"
+#include "../data_structures/CSRGraph.hpp"
+#include "../data_structures/ConnectedComponents.hpp"
+#include "../data_structures/Cycle.hpp"
+#include "../data_structures/DepthFirstPaths.hpp"
+#include "../data_structures/Graph.hpp"
+#include "../data_structures/GraphGenerator.hpp"
+
+// Collects a view into a vector for easy comparison
+template <typename View>
+std::vector<int> toVector(const View& view) {
+    return std::vector<int>(view.begin(), view.end());
+}
+
+void assertSameGraph(const Graph& g, const CSRGraph& csr) {
+    assert(csr.V() == g.V());
+    assert(csr.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(toVector(csr.adj(v)) == g.adj(v));
+        assert(csr.degree(v) == g.degree(v));
+    }
+}
+
+void testFromGraph() {
+    Graph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(0, 3);
+    g.addEdge(2, 2);
+
+    const CSRGraph csr(g);
+    assertSameGraph(g, csr);
+
+    assert((toVector(csr.adj(0)) == std::vector{3, 2, 1}));
+    assert(csr.degree(2) == 3);  // edge to 0 plus a self-loop counted twice
+    assert(csr.adj(1)[0] == 0);
+
+    std::cout << "testFromGraph passed\n";
+}
+
+void testFromEdgeList() {
+    const std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {2, 0}, {3, 3}, {1, 4}, {0, 1}};
+
+    Graph g(5);
+    for (const auto& [v, w] : edges) g.addEdge(v, w);
+
+    assertSameGraph(g, CSRGraph(5, edges));
+
+    std::cout << "testFromEdgeList passed\n";
+}
+
+void testEmpty() {
+    const CSRGraph csr(0, {});
+    assert(csr.V() == 0);
+    assert(csr.E() == 0);
+
+    const CSRGraph isolated(Graph(2));
+    assert(isolated.adj(0).empty());
+    assert(isolated.degree(1) == 0);
+
+    std::cout << "testEmpty passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        CSRGraph csr(-2, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        CSRGraph csr(2, {{-1, 0}});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const CSRGraph csr(2, {{0, 1}});
+    try {
+        csr.adj(2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void testTraversalsMatchGraph() {
+    const Graph g = GraphGenerator::simple(80, 150);
+    const CSRGraph csr(g);
+
+    const BreadthFirstPaths bfs1(g, 0), bfs2(csr, 0);
+    const DepthFirstPaths dfs1(g, 0), dfs2(csr, 0);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(bfs1.distTo(v) == bfs2.distTo(v));
+        assert(bfs1.pathTo(v) == bfs2.pathTo(v));
+        assert(dfs1.pathTo(v) == dfs2.pathTo(v));
+    }
+
+    const ConnectedComponents cc1(g), cc2(csr);
+    assert(cc1.count() == cc2.count());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(cc1.id(v) == cc2.id(v));
+        assert(cc1.size(v) == cc2.size(v));
+    }
+
+    const Cycle cycle1(g), cycle2(csr);
+    assert(cycle1.cycle() == cycle2.cycle());
+
+    const Bipartite b1(g), b2(csr);
+    assert(b1.isBipartite() == b2.isBipartite());
+    assert(b1.oddCycle() == b2.oddCycle());
+
+    std::cout << "testTraversalsMatchGraph passed\n";
+}
+
+void testStreamOutput() {
+    Graph g(3);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+
+    std::ostringstream expected, actual;
+    expected << g;
+    actual << CSRGraph(g);
+    assert(expected.str() == actual.str());
+
+    std::cout << "testStreamOutput passed\n";
+}
+
+int main() {
+    std::cout << "Running CSRGraph tests...\n";
+
+    testFromGraph();
+    testFromEdgeList();
+    testEmpty();
+    testInvalidArguments();
+    testTraversalsMatchGraph();
+    testStreamOutput();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
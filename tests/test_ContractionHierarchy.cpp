@@ -0,0 +1,201 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/ContractionHierarchy.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraQuery.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Checks that path is made of edges of g, connects s to t and has the given length
+template <typename GraphType>
+void assertValidPath(const GraphType& g, const std::vector<DirectedEdge>& path, const int s, const int t,
+                     const double length) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        bool found = false;
+        for (const DirectedEdge& f : g.adj(at)) found = found || f == e;
+        assert(found);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    assert(close(total, length));
+}
+
+// Road-like grid with random detour factors on both directions of each street
+EdgeWeightedDigraph grid(const int n, const unsigned seed) {
+    EdgeWeightedDigraph g(n * n);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> weight(1.0, 2.0);
+    for (int r = 0; r < n; ++r) {
+        for (int c = 0; c < n; ++c) {
+            const int v = r * n + c;
+            if (c + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + 1, weight(rng)));
+                g.addEdge(DirectedEdge(v + 1, v, weight(rng)));
+            }
+            if (r + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + n, weight(rng)));
+                g.addEdge(DirectedEdge(v + n, v, weight(rng)));
+            }
+        }
+    }
+    return g;
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 3, 1.0));
+    g.addEdge(DirectedEdge(0, 3, 5.0));
+    g.addEdge(DirectedEdge(3, 4, 2.0));
+    g.addEdge(DirectedEdge(1, 1, 0.5));   // self-loop
+    g.addEdge(DirectedEdge(2, 3, 0.25));  // lighter parallel edge
+
+    ContractionHierarchy ch(g);
+    assert(ch.query(0, 4) == 4.25);
+    assert(ch.hasPath());
+    assertValidPath(g, ch.path(), 0, 4, 4.25);
+    assert(ch.path().size() == 4);
+
+    assert(ch.query(4, 0) == std::numeric_limits<double>::max());
+    assert(!ch.hasPath());
+    assert(ch.path().empty());
+    assert(ch.query(5, 1) == std::numeric_limits<double>::max());
+
+    assert(ch.query(3, 3) == 0.0);
+    assert(ch.hasPath());
+    assert(ch.path().empty());
+
+    // Ranks form a permutation of the vertices
+    std::vector<bool> seen(6, false);
+    for (int v = 0; v < 6; ++v) seen[ch.rank(v)] = true;
+    for (const bool b : seen) assert(b);
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesDijkstraOnRandomDigraphs() {
+    for (const unsigned seed : {1u, 2u, 3u}) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> vertex(0, 199);
+        std::uniform_int_distribution<int> weight(0, 10);
+        EdgeWeightedDigraph g(200);
+        for (int i = 0; i < 800; ++i) g.addEdge(DirectedEdge(vertex(rng), vertex(rng), weight(rng)));
+
+        ContractionHierarchy ch(g);
+        for (int s = 0; s < 200; s += 13) {
+            const DijkstraSP sp(g, s);
+            for (int t = 0; t < 200; ++t) {
+                assert(ch.query(s, t) == sp.distTo(t));
+                if (sp.hasPathTo(t)) assertValidPath(g, ch.path(), s, t, sp.distTo(t));
+            }
+        }
+    }
+
+    std::cout << "testMatchesDijkstraOnRandomDigraphs passed\n";
+}
+
+void testMatchesDijkstraOnGrid() {
+    const EdgeWeightedDigraph g = grid(30, 9);
+    const CSREdgeWeightedDigraph csr(g);
+    ContractionHierarchy ch(csr);
+    for (const int s : {0, 29, 450, 899}) {
+        const DijkstraSP sp(g, s);
+        for (int t = 0; t < g.V(); ++t) {
+            assert(close(ch.query(s, t), sp.distTo(t)));
+            assertValidPath(g, ch.path(), s, t, sp.distTo(t));
+        }
+    }
+
+    std::cout << "testMatchesDijkstraOnGrid passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        ContractionHierarchy ch(negative);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    ContractionHierarchy ch(EdgeWeightedDigraph(3));
+    try {
+        ch.hasPath();
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        ch.query(0, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ch.rank(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    ContractionHierarchy empty(EdgeWeightedDigraph(0));
+    assert(empty.V() == 0);
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: settled vertices and query time against point-to-point Dijkstra
+void benchmarkQueries() {
+    const EdgeWeightedDigraph g = grid(50, 4);
+    const auto startBuild = std::chrono::steady_clock::now();
+    ContractionHierarchy ch(g);
+    const double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startBuild).count();
+    DijkstraQuery dijkstra(g);
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> vertex(0, g.V() - 1);
+    const int queries = 200;
+    long long settledDijkstra = 0, settledCH = 0;
+    double msDijkstra = 0.0, msCH = 0.0;
+    for (int i = 0; i < queries; ++i) {
+        const int s = vertex(rng), t = vertex(rng);
+        auto start = std::chrono::steady_clock::now();
+        const double expected = dijkstra.query(s, t);
+        msDijkstra += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        const double actual = ch.query(s, t);
+        msCH += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        assert(close(actual, expected));
+        settledDijkstra += dijkstra.settledCount();
+        settledCH += ch.settledCount();
+    }
+
+    std::cout << "benchmarkQueries (" << g.V() << " vertices, " << g.E() << " edges, "
+              << ch.shortcutCount() << " shortcuts, built in " << buildMs << " ms), average per query:\n"
+              << "  DijkstraQuery:        " << settledDijkstra / queries << " settled, "
+              << 1000.0 * msDijkstra / queries << " us\n"
+              << "  ContractionHierarchy: " << settledCH / queries << " settled, "
+              << 1000.0 * msCH / queries << " us\n";
+    assert(settledCH * 4 < settledDijkstra);
+}
+
+int main() {
+    std::cout << "Running ContractionHierarchy tests...\n";
+
+    testSmallDigraph();
+    testMatchesDijkstraOnRandomDigraphs();
+    testMatchesDijkstraOnGrid();
+    testInvalidArguments();
+    benchmarkQueries();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
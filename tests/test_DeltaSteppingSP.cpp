@@ -0,0 +1,227 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DeltaSteppingSP.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+template <typename GraphType>
+void assertMatchesDijkstra(const GraphType& g, const int s, const double delta, const int threads) {
+    const DijkstraSP expected(g, s);
+    const DeltaSteppingSP sp(g, s, delta, threads);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+        if (!expected.hasPathTo(v)) {
+            assert(sp.distTo(v) == std::numeric_limits<double>::max());
+            assert(sp.pathTo(v).empty());
+            continue;
+        }
+        assert(nearlyEqual(sp.distTo(v), expected.distTo(v)));
+        assert(nearlyEqual(pathWeight(sp.pathTo(v), s, v), sp.distTo(v)));
+    }
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 3.0));
+    g.addEdge(DirectedEdge(2, 3, 0.5));
+    g.addEdge(DirectedEdge(0, 3, 10.0));
+    g.addEdge(DirectedEdge(4, 0, 1.0));
+
+    const DeltaSteppingSP sp(g, 0, 1.0, 2);
+    assert(sp.delta() == 1.0);
+    assert(sp.distTo(0) == 0.0);
+    assert(sp.distTo(2) == 2.0);
+    assert(sp.distTo(3) == 2.5);
+    assert(sp.pathTo(3).size() == 3);
+    assert(pathWeight(sp.pathTo(3), 0, 3) == 2.5);
+    assert(sp.pathTo(0).empty());
+    assert(!sp.hasPathTo(4));
+    assert(!sp.hasPathTo(5));
+    assert(sp.pathTo(5).empty());
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testDeltasAndThreads() {
+    const EdgeWeightedDigraph g(2000, 12000);
+    for (const double delta : {0.0, 0.01, 0.1, 0.5, 2.0}) {
+        for (const int threads : {1, 2, 4}) {
+            assertMatchesDijkstra(g, 0, delta, threads);
+        }
+    }
+
+    // delta = 0 picks max weight / average out-degree
+    const DeltaSteppingSP sp(g, 0);
+    assert(sp.delta() > 0.0 && sp.delta() < 1.0);
+
+    std::cout << "testDeltasAndThreads passed\n";
+}
+
+void testZeroWeightsAndCycles() {
+    // Zero-weight cycles must not produce cyclic predecessor chains
+    std::vector<DirectedEdge> edges;
+    const int n = 1000;
+    for (int v = 0; v + 1 < n; ++v) {
+        edges.emplace_back(v, v + 1, 0.0);
+        edges.emplace_back(v + 1, v, 0.0);
+    }
+    edges.emplace_back(0, n - 1, 5.0);
+    const CSREdgeWeightedDigraph g(n, edges);
+
+    for (const int threads : {1, 3}) {
+        const DeltaSteppingSP sp(g, 0, 0.0, threads);
+        for (int v = 0; v < n; ++v) {
+            assert(sp.distTo(v) == 0.0);
+            assert(static_cast<int>(sp.pathTo(v).size()) == v);
+        }
+    }
+    assertMatchesDijkstra(g, n / 2, 1.0, 2);
+
+    std::cout << "testZeroWeightsAndCycles passed\n";
+}
+
+void testWideFrontier() {
+    // Grid with integer weights: frontiers span many blocks and buckets hold ties
+    const int side = 120;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> weight(1, 9);
+    std::vector<DirectedEdge> edges;
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            const int v = r * side + c;
+            if (c + 1 < side) {
+                edges.emplace_back(v, v + 1, weight(rng));
+                edges.emplace_back(v + 1, v, weight(rng));
+            }
+            if (r + 1 < side) {
+                edges.emplace_back(v, v + side, weight(rng));
+                edges.emplace_back(v + side, v, weight(rng));
+            }
+        }
+    }
+    const CSREdgeWeightedDigraph g(side * side, edges);
+    for (const double delta : {1.0, 3.0, 20.0}) {
+        for (const int threads : {1, 4}) {
+            const DeltaSteppingSP sp(g, 0, delta, threads);
+            const DijkstraSP expected(g, 0);
+            for (int v = 0; v < g.V(); ++v) {
+                assert(sp.distTo(v) == expected.distTo(v));
+            }
+        }
+    }
+
+    std::cout << "testWideFrontier passed\n";
+}
+
+void testSharedPool() {
+    const EdgeWeightedDigraph g(500, 3000);
+    ThreadPool pool(3);
+    for (int s = 0; s < 20; ++s) {
+        const DijkstraSP expected(g, s);
+        const DeltaSteppingSP sp(g, s, 0.2, pool);
+        for (int v = 0; v < g.V(); ++v) {
+            assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+            assert(!expected.hasPathTo(v) || nearlyEqual(sp.distTo(v), expected.distTo(v)));
+        }
+    }
+
+    std::cout << "testSharedPool passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        DeltaSteppingSP sp(negative, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(3);
+    try {
+        DeltaSteppingSP sp(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        DeltaSteppingSP sp(g, 0, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        DeltaSteppingSP sp(g, 0, 1.0, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const DeltaSteppingSP sp(g, 0);
+    try {
+        sp.distTo(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void benchmarkAgainstDijkstra() {
+    const EdgeWeightedDigraph g(200000, 1600000);
+    const CSREdgeWeightedDigraph csr(g);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    const DijkstraSP dijkstra(csr, 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  DijkstraSP: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+    for (const int threads : {1, 2, 4, ThreadPool::defaultThreads()}) {
+        start = std::chrono::high_resolution_clock::now();
+        const DeltaSteppingSP sp(csr, 0, 0.0, threads);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "  DeltaSteppingSP (" << threads << " threads, delta " << sp.delta() << "): "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+        for (int v = 0; v < csr.V(); v += 97) {
+            assert(sp.hasPathTo(v) == dijkstra.hasPathTo(v));
+            assert(!dijkstra.hasPathTo(v) || nearlyEqual(sp.distTo(v), dijkstra.distTo(v)));
+        }
+    }
+
+    std::cout << "benchmarkAgainstDijkstra passed\n";
+}
+
+int main() {
+    std::cout << "Running DeltaSteppingSP tests...\n";
+
+    testSmallDigraph();
+    testDeltasAndThreads();
+    testZeroWeightsAndCycles();
+    testWideFrontier();
+    testSharedPool();
+    testInvalidArguments();
+    benchmarkAgainstDijkstra();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
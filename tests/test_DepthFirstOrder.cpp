@@ -1,9 +1,12 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "../data_structures/DepthFirstOrder.hpp"
 #include "../data_structures/Digraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
 
 void testSimpleDAG() {
     // Create simple DAG: 0->1->2, 0->2
@@ -322,6 +325,44 @@ void testInvalidVertex() {
     std::cout << "testInvalidVertex passed\n";
 }
 
+void testEdgeWeightedDigraph() {
+    // Same shape as testReversePostorder; the DFS follows edges to their heads
+    Digraph g(4);
+    EdgeWeightedDigraph ewg(4);
+    for (const auto& [v, w] : std::vector<std::pair<int, int>>{{0, 1}, {1, 3}, {0, 2}, {2, 3}}) {
+        g.addEdge(v, w);
+        ewg.addEdge(DirectedEdge(v, w, 1.0));
+    }
+
+    DepthFirstOrder unweighted(g);
+    DepthFirstOrder weighted(ewg);
+    assert(weighted.pre() == unweighted.pre());
+    assert(weighted.post() == unweighted.post());
+    assert(weighted.reversePost() == unweighted.reversePost());
+    for (int v = 0; v < 4; v++) {
+        assert(weighted.pre(v) == unweighted.pre(v));
+        assert(weighted.post(v) == unweighted.post(v));
+    }
+
+    std::cout << "testEdgeWeightedDigraph passed\n";
+}
+
+void testDeepChain() {
+    // A million-vertex path: far deeper than a recursive DFS can go on a default thread stack
+    const int V = 1000000;
+    Digraph g(V);
+    for (int v = 0; v + 1 < V; ++v) g.addEdge(v, v + 1);
+
+    const DepthFirstOrder dfo(g);
+    for (const int v : {0, 1, V / 2, V - 1}) {
+        assert(dfo.pre(v) == v);
+        assert(dfo.post(v) == V - 1 - v);
+    }
+    assert(dfo.reversePost().front() == 0);
+
+    std::cout << "testDeepChain passed\n";
+}
+
 int main() {
     std::cout << "Running DepthFirstOrder tests...\n";
 
@@ -336,6 +377,8 @@ int main() {
     testEmptyDigraph();
     testParentChildRelationship();
     testInvalidVertex();
+    testEdgeWeightedDigraph();
+    testDeepChain();
 
     std::cout << "All tests passed!\n";
     return 0;
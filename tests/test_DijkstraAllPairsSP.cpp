@@ -2,11 +2,16 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <random>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "../data_structures/BellmanFordSP.hpp"
 #include "../data_structures/DijkstraAllPairsSP.hpp"
+#include "../data_structures/DijkstraSP.hpp"
 #include "../data_structures/DirectedEdge.hpp"
 #include "../data_structures/EdgeWeightedDigraph.hpp"
 
@@ -517,6 +522,170 @@ void testPerformanceIndicator() {
     std::cout << "testPerformanceIndicator passed\n";
 }
 
+void testMatchesSingleSourceInParallel() {
+    const EdgeWeightedDigraph g(300, 2000);
+    for (const int threads : {1, 2, 4}) {
+        const DijkstraAllPairsSP allPairs(g, threads);
+        assert(allPairs.rowsComputed() == g.V());
+        assert(!allPairs.isLazy());
+        for (int s = 0; s < g.V(); s += 7) {
+            const DijkstraSP sp(g, s);
+            for (int v = 0; v < g.V(); ++v) {
+                assert(allPairs.dist(s, v) == sp.distTo(v));
+                assert(allPairs.hasPath(s, v) == sp.hasPathTo(v));
+                assert(allPairs.path(s, v) == sp.pathTo(v));
+            }
+        }
+    }
+
+    std::cout << "testMatchesSingleSourceInParallel passed\n";
+}
+
+void testFloatDistances() {
+    const EdgeWeightedDigraph g(200, 1200);
+    const DijkstraAllPairsSP<double> exact(g, 2);
+    const DijkstraAllPairsSP<float> compact(g, 2);
+    for (int s = 0; s < g.V(); ++s) {
+        for (int v = 0; v < g.V(); ++v) {
+            assert(compact.hasPath(s, v) == exact.hasPath(s, v));
+            if (!exact.hasPath(s, v)) {
+                assert(compact.dist(s, v) == std::numeric_limits<double>::max());
+                continue;
+            }
+            assert(std::abs(compact.dist(s, v) - exact.dist(s, v)) <= 1e-6 * std::max(1.0, exact.dist(s, v)));
+            assert(compact.path(s, v) == exact.path(s, v));  // predecessors are computed in double
+        }
+    }
+
+    std::cout << "testFloatDistances passed\n";
+}
+
+void testLazyRowsWithLRU() {
+    const EdgeWeightedDigraph g(100, 600);
+    const DijkstraAllPairsSP eager(g, 1);
+    const auto lazy = DijkstraAllPairsSP<>::lazy(g, 3);
+    assert(lazy.isLazy());
+    assert(lazy.rowsComputed() == 0);
+
+    // First touch of a source computes its row; repeats hit the cache
+    assert(lazy.dist(0, 5) == eager.dist(0, 5));
+    assert(lazy.hasPath(0, 7) == eager.hasPath(0, 7));
+    assert(lazy.rowsComputed() == 1);
+    assert(lazy.path(1, 9) == eager.path(1, 9));
+    assert(lazy.dist(2, 3) == eager.dist(2, 3));
+    assert(lazy.rowsComputed() == 3);
+
+    // Using row 0 makes row 1 the least recently used, so source 3 evicts it
+    lazy.dist(0, 1);
+    lazy.dist(3, 4);
+    assert(lazy.rowsComputed() == 4);
+    lazy.dist(0, 2);
+    lazy.dist(2, 2);
+    lazy.dist(3, 0);
+    assert(lazy.rowsComputed() == 4);
+    lazy.dist(1, 0);
+    assert(lazy.rowsComputed() == 5);
+
+    // Any access pattern gives the eager answers
+    for (int i = 0; i < 2000; ++i) {
+        const int s = (i * 37) % g.V(), v = (i * 11) % g.V();
+        assert(lazy.dist(s, v) == eager.dist(s, v));
+        assert(lazy.path(s, v) == eager.path(s, v));
+    }
+
+    // Moving a warm lazy instance keeps its cache usable
+    auto warm = DijkstraAllPairsSP<>::lazy(g, 2);
+    warm.dist(4, 1);
+    warm.dist(5, 1);
+    DijkstraAllPairsSP<> moved(std::move(warm));
+    assert(moved.rowsComputed() == 2);
+    assert(moved.dist(4, 8) == eager.dist(4, 8));
+    assert(moved.dist(6, 8) == eager.dist(6, 8));
+    assert(moved.rowsComputed() == 3);
+    auto reassigned = DijkstraAllPairsSP<>::lazy(g, 1);
+    reassigned = std::move(moved);
+    assert(reassigned.path(6, 2) == eager.path(6, 2));
+    assert(reassigned.dist(4, 2) == eager.dist(4, 2));
+    assert(reassigned.rowsComputed() == 3);
+    static_assert(!std::is_copy_constructible_v<DijkstraAllPairsSP<>>);
+    static_assert(!std::is_copy_assignable_v<DijkstraAllPairsSP<>>);
+
+    // A cache larger than V holds every row
+    const auto all = DijkstraAllPairsSP<float>::lazy(g, 1000);
+    for (int s = 0; s < g.V(); ++s) all.dist(s, 0);
+    for (int s = 0; s < g.V(); ++s) all.dist(s, 1);
+    assert(all.rowsComputed() == g.V());
+
+    try {
+        DijkstraAllPairsSP<>::lazy(g, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        DijkstraAllPairsSP<>::lazy(negative, 1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testLazyRowsWithLRU passed\n";
+}
+
+void testJohnsonReweighting() {
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 2.0));
+    g.addEdge(DirectedEdge(1, 2, -1.0));
+    g.addEdge(DirectedEdge(0, 2, 3.0));
+    g.addEdge(DirectedEdge(2, 3, -2.0));
+    g.addEdge(DirectedEdge(3, 1, 4.0));
+
+    const auto johnson = DijkstraAllPairsSP<>::johnson(g, 2);
+    assert(!johnson.isLazy());
+    assert(johnson.rowsComputed() == 4);
+    assert(isEqual(johnson.dist(0, 2), 1.0));
+    assert(isEqual(johnson.dist(0, 3), -1.0));
+    assert(isEqual(johnson.dist(3, 2), 3.0));
+    assert(johnson.path(0, 3).size() == 3);
+    assert(johnson.dist(0, 0) == 0.0);
+    assert(!johnson.hasPath(1, 0));
+    assert(johnson.dist(1, 0) == std::numeric_limits<double>::max());
+
+    // Random digraph with weights shifted by potentials: matches Bellman-Ford from every source
+    const EdgeWeightedDigraph base(150, 900);
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> shift(0.0, 2.0);
+    std::vector<double> potential(base.V());
+    for (double& p : potential) p = shift(rng);
+    EdgeWeightedDigraph shifted(base.V());
+    for (const auto& e : base.edges()) {
+        shifted.addEdge(DirectedEdge(e.from(), e.to(), e.weight() + potential[e.from()] - potential[e.to()]));
+    }
+    const auto all = DijkstraAllPairsSP<>::johnson(shifted, 3);
+    for (int s = 0; s < shifted.V(); ++s) {
+        const BellmanFordSP bf(shifted, s);
+        for (int v = 0; v < shifted.V(); ++v) {
+            assert(all.hasPath(s, v) == bf.hasPathTo(v));
+            if (!bf.hasPathTo(v)) continue;
+            assert(std::abs(all.dist(s, v) - bf.distTo(v)) < 1e-9);
+            double total = 0.0;
+            for (const auto& e : all.path(s, v)) total += e.weight();
+            assert(std::abs(total - bf.distTo(v)) < 1e-9);
+        }
+    }
+
+    EdgeWeightedDigraph cycle(3);
+    cycle.addEdge(DirectedEdge(0, 1, 1.0));
+    cycle.addEdge(DirectedEdge(1, 2, -3.0));
+    cycle.addEdge(DirectedEdge(2, 1, 2.0));
+    try {
+        DijkstraAllPairsSP<>::johnson(cycle);
+        assert(false);
+    } catch (const std::invalid_argument& e) {
+        assert(std::string(e.what()).find("negative cycle") != std::string::npos);
+    }
+
+    std::cout << "testJohnsonReweighting passed\n";
+}
+
 int main() {
     std::cout << "Running DijkstraAllPairsSP tests...\n";
 
@@ -540,6 +709,10 @@ int main() {
     testPathConsistency();
     testStronglyConnectedComponent();
     testPerformanceIndicator();
+    testMatchesSingleSourceInParallel();
+    testFloatDistances();
+    testLazyRowsWithLRU();
+    testJohnsonReweighting();
 
     std::cout << "All tests passed!\n";
     return 0;
@@ -0,0 +1,168 @@
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraQuery.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(5);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 3.0));
+    g.addEdge(DirectedEdge(2, 3, 0.5));
+    g.addEdge(DirectedEdge(4, 0, 1.0));
+
+    DijkstraQuery query(g);
+    assert(query.query(0, 3) == 2.5);
+    assert(query.hasPath());
+    const std::vector<DirectedEdge> path = query.path();
+    assert(path.size() == 3);
+    assert(pathWeight(path, 0, 3) == 2.5);
+
+    assert(query.query(3, 0) == std::numeric_limits<double>::max());
+    assert(!query.hasPath());
+    assert(query.path().empty());
+
+    assert(query.query(2, 2) == 0.0);
+    assert(query.hasPath());
+    assert(query.path().empty());
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesDijkstraSP() {
+    const EdgeWeightedDigraph g(300, 2000);
+    DijkstraQuery query(g);
+
+    for (int s = 0; s < 10; ++s) {
+        const DijkstraSP sp(g, s);
+        for (int t = 0; t < g.V(); ++t) {
+            assert(query.query(s, t) == sp.distTo(t));
+            assert(query.hasPath() == sp.hasPathTo(t));
+            if (sp.hasPathTo(t) && s != t) {
+                assert(pathWeight(query.path(), s, t) == sp.distTo(t));
+            }
+        }
+    }
+
+    std::cout << "testMatchesDijkstraSP passed\n";
+}
+
+void testEarlyExitAndReset() {
+    // Chain 0 -> 1 -> ... -> n-1 with unit weights
+    const int n = 10000;
+    std::vector<DirectedEdge> edges;
+    for (int v = 0; v + 1 < n; ++v) edges.emplace_back(v, v + 1, 1.0);
+    const CSREdgeWeightedDigraph g(n, edges);
+    DijkstraQuery<CSREdgeWeightedDigraph> query(g);
+
+    assert(query.query(0, n - 1) == n - 1);
+    assert(query.settledCount() == n);
+
+    // A short query after a long one only explores its own region
+    assert(query.query(100, 103) == 3.0);
+    assert(query.settledCount() == 4);
+    assert(query.touchedCount() == 4);
+    assert(query.path().size() == 3);
+
+    // Vertices touched by earlier queries are not reachable from later sources
+    assert(query.query(50, 20) == std::numeric_limits<double>::max());
+    assert(query.touchedCount() == n - 50);
+
+    std::cout << "testEarlyExitAndReset passed\n";
+}
+
+void testRandomQueries() {
+    const EdgeWeightedDigraph g(200, 1500);
+    DijkstraQuery query(g);
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> vertex(0, g.V() - 1);
+    for (int i = 0; i < 1000; ++i) {
+        const int s = vertex(rng), t = vertex(rng);
+        const DijkstraSP sp(g, s);
+        assert(query.query(s, t) == sp.distTo(t));
+        assert(query.settledCount() <= g.V());
+    }
+
+    std::cout << "testRandomQueries passed\n";
+}
+
+void testEdgeFilter() {
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 3, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 2.0));
+    g.addEdge(DirectedEdge(2, 3, 2.0));
+    g.addEdge(DirectedEdge(0, 3, 5.0));
+    DijkstraQuery query(g);
+
+    // Removing vertex 1 by rejecting the edges into it
+    assert(query.query(0, 3, [](const DirectedEdge& e) { return e.to() != 1; }) == 4.0);
+    assert(pathWeight(query.path(), 0, 3) == 4.0);
+
+    // Removing single edges
+    const DirectedEdge blocked(2, 3, 2.0);
+    assert(query.query(0, 3, [&](const DirectedEdge& e) { return e.to() != 1 && e != blocked; }) == 5.0);
+    assert(query.query(0, 3, [](const DirectedEdge&) { return false; }) == std::numeric_limits<double>::max());
+    assert(!query.hasPath());
+
+    // The filter applies to one query only
+    assert(query.query(0, 3) == 2.0);
+
+    std::cout << "testEdgeFilter passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        DijkstraQuery query(negative);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(3);
+    DijkstraQuery query(g);
+    try {
+        query.hasPath();
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        query.query(0, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running DijkstraQuery tests...\n";
+
+    testSmallDigraph();
+    testMatchesDijkstraSP();
+    testEarlyExitAndReset();
+    testRandomQueries();
+    testEdgeFilter();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
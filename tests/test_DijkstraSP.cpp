@@ -1,13 +1,18 @@
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <random>
 #include <stdexcept>
 #include <vector>
 
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
 #include "../data_structures/DijkstraSP.hpp"
 #include "../data_structures/DirectedEdge.hpp"
 #include "../data_structures/EdgeWeightedDigraph.hpp"
+#include "../data_structures/IndexBucketQueue.hpp"
+#include "../data_structures/IndexRadixHeap.hpp"
 
 const double EPS = 1e-9;
 
@@ -563,6 +568,88 @@ void testPerformanceWithDenseGraph() {
     std::cout << "testPerformanceWithDenseGraph passed\n";
 }
 
+// Random digraph with integer weights in [0, maxWeight]
+CSREdgeWeightedDigraph randomIntegerDigraph(const int V, const int E, const int maxWeight, const unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_int_distribution<int> weight(0, maxWeight);
+    std::vector<DirectedEdge> edges;
+    edges.reserve(E);
+    for (int i = 0; i < E; ++i) {
+        edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    }
+    return CSREdgeWeightedDigraph(V, edges);
+}
+
+void testAlternativeQueues() {
+    // Real weights: the radix heap must reproduce the binary heap exactly
+    const EdgeWeightedDigraph g(1000, 8000);
+    for (int s = 0; s < 5; ++s) {
+        const DijkstraSP heap(g, s);
+        const DijkstraSP<IndexRadixHeap<double>> radix(g, s);
+        for (int v = 0; v < g.V(); ++v) {
+            assert(radix.distTo(v) == heap.distTo(v));
+            assert(radix.hasPathTo(v) == heap.hasPathTo(v));
+        }
+    }
+
+    // Integer weights (including zero): all three queues agree
+    const CSREdgeWeightedDigraph ints = randomIntegerDigraph(1000, 8000, 20, 3);
+    for (int s = 0; s < 5; ++s) {
+        const DijkstraSP heap(ints, s);
+        const DijkstraSP<IndexRadixHeap<double>> radix(ints, s);
+        const DijkstraSP<IndexBucketQueue<double>> dial(ints, s);
+        for (int v = 0; v < ints.V(); ++v) {
+            assert(radix.distTo(v) == heap.distTo(v));
+            assert(dial.distTo(v) == heap.distTo(v));
+            if (heap.hasPathTo(v)) {
+                double total = 0.0;
+                for (const auto& e : dial.pathTo(v)) total += e.weight();
+                assert(total == heap.distTo(v));
+            }
+        }
+    }
+
+    // Dial's queue rejects fractional distances
+    EdgeWeightedDigraph fractional(2);
+    fractional.addEdge(DirectedEdge(0, 1, 0.5));
+    try {
+        DijkstraSP<IndexBucketQueue<double>> sp(fractional, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testAlternativeQueues passed\n";
+}
+
+template <typename PriorityQueue, typename GraphType>
+double timeDijkstra(const GraphType& g, const char* name) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    const DijkstraSP<PriorityQueue> sp(g, 0);
+    const auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "    " << name << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+    return sp.distTo(g.V() - 1);
+}
+
+void benchmarkQueues() {
+    const int V = 200000, E = 1600000;
+    const EdgeWeightedDigraph real(V, E);
+    const CSREdgeWeightedDigraph realCsr(real);
+    std::cout << "  Uniform [0, 1) weights:\n";
+    const double a = timeDijkstra<IndexMinPQ<double>>(realCsr, "IndexMinPQ     ");
+    const double b = timeDijkstra<IndexRadixHeap<double>>(realCsr, "IndexRadixHeap ");
+    assert(a == b);
+
+    const CSREdgeWeightedDigraph ints = randomIntegerDigraph(V, E, 100, 7);
+    std::cout << "  Integer [0, 100] weights:\n";
+    const double c = timeDijkstra<IndexMinPQ<double>>(ints, "IndexMinPQ      ");
+    const double d = timeDijkstra<IndexRadixHeap<double>>(ints, "IndexRadixHeap  ");
+    const double e = timeDijkstra<IndexBucketQueue<double>>(ints, "IndexBucketQueue");
+    assert(c == d && c == e);
+
+    std::cout << "benchmarkQueues passed\n";
+}
+
 int main() {
     std::cout << "Running DijkstraSP tests...\n";
 
@@ -589,6 +676,8 @@ int main() {
     testPathConsistency();
     testLargeWeights();
     testPerformanceWithDenseGraph();
+    testAlternativeQueues();
+    benchmarkQueues();
 
     std::cout << "All tests passed!\n";
     return 0;
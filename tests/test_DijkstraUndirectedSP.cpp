@@ -10,6 +10,8 @@
 #include "../data_structures/DijkstraUndirectedSP.hpp"
 #include "../data_structures/Edge.hpp"
 #include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/IndexBucketQueue.hpp"
+#include "../data_structures/IndexRadixHeap.hpp"
 
 const double EPS = 1e-9;
 
@@ -576,6 +578,28 @@ void testDenseGraph() {
     std::cout << "testDenseGraph passed\n";
 }
 
+void testAlternativeQueues() {
+    const EdgeWeightedGraph g(500, 3000);
+    EdgeWeightedGraph ints(500);
+    for (int i = 0; i < 3000; ++i) {
+        ints.addEdge(Edge(i % 500, (i * 7919) % 500, (i * 31) % 17));
+    }
+
+    for (int s = 0; s < 5; ++s) {
+        const DijkstraUndirectedSP heap(g, s);
+        const DijkstraUndirectedSP<IndexRadixHeap<double>> radix(g, s);
+        const DijkstraUndirectedSP intHeap(ints, s);
+        const DijkstraUndirectedSP<IndexBucketQueue<double>> dial(ints, s);
+        for (int v = 0; v < g.V(); ++v) {
+            assert(radix.distTo(v) == heap.distTo(v));
+            assert(dial.distTo(v) == intHeap.distTo(v));
+            assert(dial.hasPathTo(v) == intHeap.hasPathTo(v));
+        }
+    }
+
+    std::cout << "testAlternativeQueues passed\n";
+}
+
 int main() {
     std::cout << "Running DijkstraUndirectedSP tests...\n";
 
@@ -602,6 +626,7 @@ int main() {
     testDifferentSourceVertices();
     testSelfLoops();
     testDenseGraph();
+    testAlternativeQueues();
 
     std::cout << "All tests passed!\n";
     return 0;
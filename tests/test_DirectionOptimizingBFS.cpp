@@ -0,0 +1,163 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BreadthFirstDirectedPaths.hpp"
+#include "../data_structures/BreadthFirstPaths.hpp"
+#include "../data_structures/CSRDigraph.hpp"
+#include "../data_structures/CSRGraph.hpp"
+#include "../data_structures/DigraphGenerator.hpp"
+#include "../data_structures/DirectionOptimizingBFS.hpp"
+#include "../data_structures/GraphGenerator.hpp"
+
+// Checks that path is a directed path from s to v of length dist using edges of g
+template <typename GraphType>
+bool isShortestPath(const GraphType& g, const std::vector<int>& path, const int s, const int v, const int dist) {
+    if (static_cast<int>(path.size()) != dist + 1 || path.front() != s || path.back() != v) return false;
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        bool found = false;
+        for (const int w : g.adj(path[i])) found = found || w == path[i + 1];
+        if (!found) return false;
+    }
+    return true;
+}
+
+void testSmallDigraph() {
+    Digraph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(1, 3);
+    g.addEdge(2, 3);
+    g.addEdge(3, 4);
+    g.addEdge(5, 0);
+
+    // alpha large enough to force bottom-up steps on a tiny graph
+    const DirectionOptimizingBFS bfs(g, 0, 1000.0, 1.0);
+    assert(bfs.bottomUpSteps() > 0);
+    assert(bfs.hasPathTo(4));
+    assert(!bfs.hasPathTo(5));
+    assert(bfs.distTo(3) == 2);
+    assert(bfs.distTo(4) == 3);
+    assert(isShortestPath(g, bfs.pathTo(4), 0, 4, 3));
+    assert(bfs.pathTo(5).empty());
+    assert(bfs.pathTo(0) == std::vector<int>{0});
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesBreadthFirstDirectedPaths() {
+    for (const double alpha : {0.0, 1.0, 15.0, 1e9}) {
+        const Digraph g = DigraphGenerator::simple(300, 3000);
+        const BreadthFirstDirectedPaths expected(g, 0);
+        const DirectionOptimizingBFS bfs(g, 0, alpha);
+        if (alpha == 0.0) assert(bfs.bottomUpSteps() == 0);
+
+        for (int v = 0; v < g.V(); ++v) {
+            assert(bfs.hasPathTo(v) == expected.hasPathTo(v));
+            assert(bfs.distTo(v) == expected.distTo(v));
+            if (bfs.hasPathTo(v)) assert(isShortestPath(g, bfs.pathTo(v), 0, v, bfs.distTo(v)));
+        }
+    }
+
+    std::cout << "testMatchesBreadthFirstDirectedPaths passed\n";
+}
+
+void testUndirectedGraph() {
+    const Graph g = GraphGenerator::simple(400, 4000);
+    const CSRGraph csr(g);
+    const BreadthFirstPaths expected(g, 7);
+    const DirectionOptimizingBFS bfs(csr, 7);
+
+    for (int v = 0; v < g.V(); ++v) {
+        assert(bfs.hasPathTo(v) == expected.hasPathTo(v));
+        assert(bfs.distTo(v) == expected.distTo(v));
+        if (bfs.hasPathTo(v)) assert(isShortestPath(g, bfs.pathTo(v), 7, v, bfs.distTo(v)));
+    }
+
+    std::cout << "testUndirectedGraph passed\n";
+}
+
+void testFewerEdgeInspections() {
+    // Dense low-diameter digraph: bottom-up levels stop at the first parent found
+    const CSRDigraph g(DigraphGenerator::simple(2000, 100000));
+    const CSRDigraph reverse = g.reverse();
+
+    const DirectionOptimizingBFS topDown(g, reverse, 0, 0.0);
+    const DirectionOptimizingBFS hybrid(g, reverse, 0);
+    assert(hybrid.bottomUpSteps() > 0);
+    assert(hybrid.edgesExamined() < topDown.edgesExamined());
+    for (int v = 0; v < g.V(); ++v) assert(hybrid.distTo(v) == topDown.distTo(v));
+
+    std::cout << "testFewerEdgeInspections passed (" << topDown.edgesExamined() << " vs "
+              << hybrid.edgesExamined() << " edges)\n";
+}
+
+// Digraph that counts how often its reverse is built
+struct CountingDigraph {
+    const Digraph& g;
+    int& reversals;
+    int V() const { return g.V(); }
+    auto adj(const int v) const { return g.adj(v); }
+    Digraph reverse() const {
+        ++reversals;
+        return g.reverse();
+    }
+};
+
+void testInvalidArguments() {
+    Digraph g(3);
+    g.addEdge(0, 1);
+
+    try {
+        DirectionOptimizingBFS bfs(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        DirectionOptimizingBFS bfs(g, 0, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        DirectionOptimizingBFS bfs(g, Digraph(2), 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    // Bad arguments are rejected before the reverse graph is built
+    int reversals = 0;
+    const CountingDigraph counting{g, reversals};
+    try {
+        DirectionOptimizingBFS bfs(counting, -1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        DirectionOptimizingBFS bfs(counting, 0, 1.0, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    assert(reversals == 0);
+    const DirectionOptimizingBFS counted(counting, 0);
+    assert(reversals == 1);
+    assert(counted.distTo(1) == 1);
+
+    const DirectionOptimizingBFS bfs(g, 0);
+    try {
+        bfs.distTo(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running DirectionOptimizingBFS tests...\n";
+
+    testSmallDigraph();
+    testMatchesBreadthFirstDirectedPaths();
+    testUndirectedGraph();
+    testFewerEdgeInspections();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/DynamicDijkstraSP.hpp"
+
+constexpr double INF = std::numeric_limits<double>::max();
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Checks distances against a fresh DijkstraSP and paths against the distances
+void checkAgainstRebuild(const DynamicDijkstraSP& dynamic) {
+    const EdgeWeightedDigraph g = dynamic.digraph();
+    const DijkstraSP sp(g, dynamic.source());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(dynamic.hasPathTo(v) == sp.hasPathTo(v));
+        if (!sp.hasPathTo(v)) {
+            assert(dynamic.pathTo(v).empty());
+            continue;
+        }
+        assert(close(dynamic.distTo(v), sp.distTo(v)));
+
+        double total = 0.0;
+        int at = dynamic.source();
+        for (const DirectedEdge& e : dynamic.pathTo(v)) {
+            assert(e.from() == at);
+            assert(e.weight() == dynamic.weight(e.from(), e.to()));
+            at = e.to();
+            total += e.weight();
+        }
+        assert(at == v);
+        assert(close(total, sp.distTo(v)));
+    }
+}
+
+void testSmallDigraph() {
+    // 0 -> 1 -> 2 -> 3, plus a longer detour 0 -> 2
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 3, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 5.0));
+    g.addEdge(DirectedEdge(0, 2, 4.0));  // parallel edge: the lighter one is kept
+
+    DynamicDijkstraSP sp(g, 0);
+    assert(sp.E() == 4);
+    assert(sp.weight(0, 2) == 4.0);
+    assert(sp.weight(3, 0) == INF);
+    assert(sp.distTo(3) == 3.0);
+    assert(sp.touchedCount() == 4);
+
+    // Increase on the tree: 2 and 3 are reset and reconnected through the detour
+    assert(sp.update(DirectedEdge(1, 2, 10.0)) == 2);
+    assert(sp.distTo(2) == 4.0);
+    assert(sp.distTo(3) == 5.0);
+    assert(sp.pathTo(3)[0] == DirectedEdge(0, 2, 4.0));
+
+    // Increase off the tree touches nothing
+    assert(sp.update(DirectedEdge(1, 2, 20.0)) == 0);
+
+    // Insertion that shortens the path to 3 only
+    assert(sp.update(DirectedEdge(1, 3, 0.5)) == 1);
+    assert(sp.distTo(3) == 1.5);
+
+    // Batch: the last weight of a repeated edge wins
+    sp.update({DirectedEdge(0, 1, 7.0), DirectedEdge(0, 1, 0.25), DirectedEdge(3, 0, 1.0)});
+    assert(sp.distTo(3) == 0.75);
+    assert(sp.weight(3, 0) == 1.0);
+    checkAgainstRebuild(sp);
+
+    // Raising a weight to the maximum double value disconnects like a removal
+    sp.update({DirectedEdge(0, 1, INF), DirectedEdge(0, 2, INF)});
+    assert(!sp.hasPathTo(3));
+    assert(sp.pathTo(3).empty());
+    checkAgainstRebuild(sp);
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testRandomBatches() {
+    std::mt19937 rng(11);
+    const int V = 300;
+    EdgeWeightedDigraph g(V);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 10.0);
+    for (int i = 0; i < 4 * V; ++i) g.addEdge(DirectedEdge(vertex(rng), vertex(rng), weight(rng)));
+
+    DynamicDijkstraSP sp(g, 0);
+    checkAgainstRebuild(sp);
+
+    std::uniform_real_distribution<double> factor(0.2, 3.0);
+    std::uniform_int_distribution<int> size(1, 20);
+    for (int round = 0; round < 200; ++round) {
+        // Mix of increases and decreases of existing edges, insertions and ties
+        const EdgeWeightedDigraph current = sp.digraph();
+        const std::vector<DirectedEdge> edges = current.edges();
+        std::uniform_int_distribution<int> pick(0, static_cast<int>(edges.size()) - 1);
+        std::vector<DirectedEdge> batch;
+        for (int i = size(rng); i > 0; --i) {
+            const DirectedEdge& e = edges[pick(rng)];
+            switch (rng() % 4) {
+                case 0: batch.emplace_back(vertex(rng), vertex(rng), weight(rng)); break;
+                case 1: batch.emplace_back(e.from(), e.to(), 0.0); break;
+                default: batch.emplace_back(e.from(), e.to(), e.weight() * factor(rng)); break;
+            }
+        }
+        sp.update(batch);
+        checkAgainstRebuild(sp);
+    }
+
+    std::cout << "testRandomBatches passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        DynamicDijkstraSP sp(negative, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    EdgeWeightedDigraph g(2);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    try {
+        DynamicDijkstraSP sp(g, 2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    // A rejected batch leaves the structure unchanged
+    DynamicDijkstraSP sp(g, 0);
+    try {
+        sp.update({DirectedEdge(0, 1, 5.0), DirectedEdge(1, 0, -1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        sp.update({DirectedEdge(0, 1, 5.0), DirectedEdge(1, 2, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    assert(sp.weight(0, 1) == 1.0);
+    assert(sp.distTo(1) == 1.0);
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: small weight changes on a road-like grid, repaired versus rebuilt with DijkstraSP
+void benchmarkUpdates() {
+    const int n = 200;
+    EdgeWeightedDigraph g(n * n);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> detour(1.0, 1.5);
+    for (int r = 0; r < n; ++r) {
+        for (int c = 0; c < n; ++c) {
+            const int v = r * n + c;
+            if (c + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + 1, detour(rng)));
+                g.addEdge(DirectedEdge(v + 1, v, detour(rng)));
+            }
+            if (r + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + n, detour(rng)));
+                g.addEdge(DirectedEdge(v + n, v, detour(rng)));
+            }
+        }
+    }
+    const std::vector<DirectedEdge> edges = g.edges();
+
+    DynamicDijkstraSP sp(g, n * (n / 2) + n / 2);
+    std::uniform_int_distribution<int> pick(0, static_cast<int>(edges.size()) - 1);
+    std::uniform_real_distribution<double> factor(0.5, 2.0);
+    const int batches = 200;
+    long long touched = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < batches; ++i) {
+        std::vector<DirectedEdge> batch;
+        for (int j = 0; j < 10; ++j) {
+            const DirectedEdge& e = edges[pick(rng)];
+            batch.emplace_back(e.from(), e.to(), e.weight() * factor(rng));
+        }
+        touched += sp.update(batch);
+    }
+    const auto repaired = std::chrono::steady_clock::now() - start;
+
+    const EdgeWeightedDigraph current = sp.digraph();
+    const auto rebuildStart = std::chrono::steady_clock::now();
+    const DijkstraSP rebuilt(current, sp.source());
+    const auto rebuild = std::chrono::steady_clock::now() - rebuildStart;
+    for (int v = 0; v < current.V(); v += 97) assert(close(sp.distTo(v), rebuilt.distTo(v)));
+
+    using std::chrono::microseconds;
+    std::cout << "benchmarkUpdates (" << g.V() << " vertices, batches of 10 weight changes):\n"
+              << "  vertices touched per batch: " << touched / batches << "\n"
+              << "  repair per batch:           "
+              << std::chrono::duration_cast<microseconds>(repaired).count() / batches << " us\n"
+              << "  DijkstraSP rebuild:         "
+              << std::chrono::duration_cast<microseconds>(rebuild).count() << " us\n";
+    assert(touched / batches < g.V() / 4);
+}
+
+int main() {
+    std::cout << "Running DynamicDijkstraSP tests...\n";
+
+    testSmallDigraph();
+    testRandomBatches();
+    testInvalidArguments();
+    benchmarkUpdates();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../data_structures/DigraphGenerator.hpp"
+#include "../data_structures/EdgeListReader.hpp"
+
+void testWhitespaceAndCsv() {
+    std::istringstream in(
+        "# comment line\n"
+        "0 1\n"
+        "\n"
+        "0\t2\n"
+        "% another comment\n"
+        "  2, 3\r\n"
+        "1,3,7\n"
+        "3 0");  // no trailing newline
+    const CSRDigraph g = EdgeListReader::readDigraph(in);
+
+    Digraph expected(4);
+    expected.addEdge(0, 1);
+    expected.addEdge(0, 2);
+    expected.addEdge(2, 3);
+    expected.addEdge(1, 3);
+    expected.addEdge(3, 0);
+
+    assert(g.V() == 4);
+    assert(g.E() == 5);
+    for (int v = 0; v < 4; ++v) {
+        assert(expected.adj(v) == std::vector<int>(g.adj(v)));
+        assert(g.indegree(v) == expected.indegree(v));
+    }
+
+    std::cout << "testWhitespaceAndCsv passed\n";
+}
+
+void testWeighted() {
+    std::istringstream in("0 1 0.5\n1 2 1e-3\n2,0,-2.25\n0 2 3\n");
+    const CSREdgeWeightedDigraph g = EdgeListReader::readEdgeWeightedDigraph(in);
+
+    assert(g.V() == 3);
+    assert(g.E() == 4);
+    assert(g.adj(0)[0] == DirectedEdge(0, 2, 3.0));
+    assert(g.adj(0)[1] == DirectedEdge(0, 1, 0.5));
+    assert(g.adj(1)[0].weight() == 1e-3);
+    assert(g.adj(2)[0].weight() == -2.25);
+
+    std::cout << "testWeighted passed\n";
+}
+
+void testVertexCount() {
+    std::istringstream in1("0 1\n");
+    assert(EdgeListReader::readDigraph(in1, 10).V() == 10);
+
+    std::istringstream in2("# nothing here\n");
+    const CSRDigraph empty = EdgeListReader::readDigraph(in2);
+    assert(empty.V() == 0 && empty.E() == 0);
+
+    std::istringstream in3("0 5\n");
+    try {
+        EdgeListReader::readDigraph(in3, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testVertexCount passed\n";
+}
+
+void testMalformedInput() {
+    const std::vector<std::string> bad = {"0\n", "0 x\n", "0 1x\n", "a b\n", "0 -\n"};
+    for (const std::string& text : bad) {
+        std::istringstream in(text);
+        try {
+            EdgeListReader::readDigraph(in);
+            assert(false);
+        } catch (const std::invalid_argument&) {}
+    }
+
+    std::istringstream missingWeight("0 1\n");
+    try {
+        EdgeListReader::readEdgeWeightedDigraph(missingWeight);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::istringstream parallelBad("0 1\n1 2\n2 oops\n3 4\n");
+    try {
+        EdgeListReader::readDigraphParallel(parallelBad, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::istringstream noThreads("0 1\n");
+    try {
+        EdgeListReader::readDigraphParallel(noThreads, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testMalformedInput passed\n";
+}
+
+void testLargeInputAcrossChunks() {
+    // More than one read chunk, so lines straddle chunk boundaries
+    const Digraph g = DigraphGenerator::simple(20000, 200000);
+    std::string text;
+    for (int v = 0; v < g.V(); ++v) {
+        for (const int w : g.adj(v)) text += std::to_string(v) + " " + std::to_string(w) + "\n";
+    }
+    assert(text.size() > (1 << 20));
+
+    std::istringstream in(text);
+    const CSRDigraph sequential = EdgeListReader::readDigraph(in, g.V());
+    assert(sequential.E() == g.E());
+
+    // Lines are read in adjacency order, which the builder reverses per vertex
+    for (int v = 0; v < g.V(); ++v) {
+        std::vector<int> adj = g.adj(v);
+        assert(std::vector<int>(adj.rbegin(), adj.rend()) == std::vector<int>(sequential.adj(v)));
+    }
+
+    for (const int threads : {1, 2, 3, 8}) {
+        std::istringstream pin(text);
+        const CSRDigraph parallel = EdgeListReader::readDigraphParallel(pin, threads, g.V());
+        assert(parallel.E() == sequential.E());
+        for (int v = 0; v < g.V(); ++v) {
+            assert(std::vector<int>(parallel.adj(v)) == std::vector<int>(sequential.adj(v)));
+        }
+    }
+
+    std::cout << "testLargeInputAcrossChunks passed\n";
+}
+
+void testParallelWeighted() {
+    const EdgeWeightedDigraph g(500, 5000);
+    std::ostringstream out;
+    out.precision(17);
+    for (const DirectedEdge& e : g.edges()) out << e.from() << "," << e.to() << "," << e.weight() << "\n";
+
+    std::istringstream in1(out.str()), in2(out.str());
+    const CSREdgeWeightedDigraph sequential = EdgeListReader::readEdgeWeightedDigraph(in1, g.V());
+    const CSREdgeWeightedDigraph parallel = EdgeListReader::readEdgeWeightedDigraphParallel(in2, 4, g.V());
+
+    assert(sequential.edges() == parallel.edges());
+    const auto byEndpoints = [](const DirectedEdge& a, const DirectedEdge& b) {
+        return std::make_tuple(a.from(), a.to(), a.weight()) < std::make_tuple(b.from(), b.to(), b.weight());
+    };
+    std::vector<DirectedEdge> sortedIn = g.edges(), sortedOut = sequential.edges();
+    std::sort(sortedIn.begin(), sortedIn.end(), byEndpoints);
+    std::sort(sortedOut.begin(), sortedOut.end(), byEndpoints);
+    assert(sortedIn == sortedOut);
+
+    std::cout << "testParallelWeighted passed\n";
+}
+
+int main() {
+    std::cout << "Running EdgeListReader tests...\n";
+
+    testWhitespaceAndCsv();
+    testWeighted();
+    testVertexCount();
+    testMalformedInput();
+    testLargeInputAcrossChunks();
+    testParallelWeighted();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
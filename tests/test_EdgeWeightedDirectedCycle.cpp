@@ -0,0 +1,96 @@
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+#include "../data_structures/EdgeWeightedDirectedCycle.hpp"
+
+// Checks that the edges form a closed walk
+void assertClosed(const std::vector<DirectedEdge>& cycle) {
+    assert(!cycle.empty());
+    for (size_t i = 0; i < cycle.size(); ++i) {
+        assert(cycle[i].to() == cycle[(i + 1) % cycle.size()].from());
+    }
+}
+
+void testAcyclic() {
+    EdgeWeightedDigraph g(5);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(0, 2, 1.0));
+    g.addEdge(DirectedEdge(1, 3, 1.0));
+    g.addEdge(DirectedEdge(2, 3, 1.0));
+    g.addEdge(DirectedEdge(3, 4, 1.0));
+
+    const EdgeWeightedDirectedCycle finder(g);
+    assert(!finder.hasCycle());
+    assert(finder.cycle().empty());
+
+    const EdgeWeightedDirectedCycle empty(EdgeWeightedDigraph(0));
+    assert(!empty.hasCycle());
+
+    std::cout << "testAcyclic passed\n";
+}
+
+void testCycle() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 2.0));
+    g.addEdge(DirectedEdge(2, 3, 3.0));
+    g.addEdge(DirectedEdge(3, 1, -4.0));
+    g.addEdge(DirectedEdge(3, 4, 1.0));
+    g.addEdge(DirectedEdge(4, 5, 1.0));
+
+    const EdgeWeightedDirectedCycle finder(g);
+    assert(finder.hasCycle());
+    const std::vector<DirectedEdge> cycle = finder.cycle();
+    assert(cycle.size() == 3);
+    assertClosed(cycle);
+    double total = 0.0;
+    for (const auto& e : cycle) total += e.weight();
+    assert(total == 1.0);
+
+    std::cout << "testCycle passed\n";
+}
+
+void testSelfLoop() {
+    EdgeWeightedDigraph g(3);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(2, 2, -1.0));
+
+    const EdgeWeightedDirectedCycle finder(g);
+    assert(finder.hasCycle());
+    assert(finder.cycle().size() == 1);
+    assert(finder.cycle()[0].from() == 2 && finder.cycle()[0].to() == 2);
+
+    std::cout << "testSelfLoop passed\n";
+}
+
+void testLongChain() {
+    // A chain far deeper than a recursive DFS could handle, closed at the end
+    const int V = 500000;
+    std::vector<DirectedEdge> edges;
+    for (int v = 0; v + 1 < V; ++v) edges.emplace_back(v, v + 1, 1.0);
+    const CSREdgeWeightedDigraph chain(V, edges);
+    assert(!EdgeWeightedDirectedCycle(chain).hasCycle());
+
+    edges.emplace_back(V - 1, 0, -1.0);
+    const EdgeWeightedDirectedCycle finder(CSREdgeWeightedDigraph(V, edges));
+    assert(finder.hasCycle());
+    assert(static_cast<int>(finder.cycle().size()) == V);
+    assertClosed(finder.cycle());
+
+    std::cout << "testLongChain passed\n";
+}
+
+int main() {
+    std::cout << "Running EdgeWeightedDirectedCycle tests...\n";
+
+    testAcyclic();
+    testCycle();
+    testSelfLoop();
+    testLongChain();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
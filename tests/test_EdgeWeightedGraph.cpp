@@ -418,9 +418,9 @@ void testCopySemantics() {
     g.addEdge(Edge(0, 1, 1.5));
     g.addEdge(Edge(1, 2, 2.5));
 
-    // Test that adj() returns a copy
-    auto adj1_copy1 = g.adj(1);
-    auto adj1_copy2 = g.adj(1);
+    // adj() returns a view; copying it into vectors gives independent objects
+    std::vector<Edge> adj1_copy1 = g.adj(1);
+    std::vector<Edge> adj1_copy2 = g.adj(1);
 
     // Both should have same content but be independent objects
     assert(adj1_copy1.size() == adj1_copy2.size());
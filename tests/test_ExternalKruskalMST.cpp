@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "../data_structures/Edge.hpp"
+#include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/ExternalKruskalMST.hpp"
+#include "../data_structures/FilterKruskalMST.hpp"
+#include "../data_structures/KruskalMST.hpp"
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("test_ExternalKruskalMST_" + name)).string();
+}
+
+// Edge::operator== compares weights only, so compare endpoints too
+bool sameEdges(const std::vector<Edge>& a, const std::vector<Edge>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const int v = a[i].either();
+        if (b[i].either() != v || b[i].other(v) != a[i].other(v) || b[i].weight() != a[i].weight()) return false;
+    }
+    return true;
+}
+
+std::vector<Edge> randomEdges(const int V, const int E, const bool integerWeights, std::mt19937& rng) {
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_int_distribution<int> integer(-20, 20);
+    std::uniform_real_distribution<double> real(0.0, 1.0);
+    std::vector<Edge> edges;
+    for (int i = 0; i < E; ++i) {
+        edges.emplace_back(vertex(rng), vertex(rng), integerWeights ? integer(rng) : real(rng));
+    }
+    return edges;
+}
+
+void testSmallGraph() {
+    EdgeWeightedGraph g(4);
+    g.addEdge(Edge(0, 1, 1.0));
+    g.addEdge(Edge(1, 2, 2.0));
+    g.addEdge(Edge(2, 3, 1.5));
+    g.addEdge(Edge(0, 3, 4.0));
+    g.addEdge(Edge(1, 3, 0.5));
+    g.addEdge(Edge(2, 2, 0.1));
+
+    const std::string path = tempPath("small.bin");
+    ExternalKruskalMST::writeEdgeFile(g, path);
+    assert(std::filesystem::file_size(path) == 6 * sizeof(GraphFileEdgeRecord));
+
+    const ExternalKruskalMST mst(path, 4);
+    assert(mst.weight() == 3.0);
+    assert(sameEdges(mst.edges(), {Edge(1, 3, 0.5), Edge(0, 1, 1.0), Edge(2, 3, 1.5)}));
+    assert(mst.runCount() == 1);
+    assert(mst.spilledCount() == 0);  // fits in one run: no temporary files
+
+    std::remove(path.c_str());
+    std::cout << "testSmallGraph passed\n";
+}
+
+void testMatchesKruskal() {
+    std::mt19937 rng(24);
+    const std::string path = tempPath("random.bin");
+    for (int trial = 0; trial < 6; ++trial) {
+        const int V = 200 + 150 * trial;
+        const std::vector<Edge> edges = randomEdges(V, 12 * V, false, rng);
+        EdgeWeightedGraph g(V);
+        for (const Edge& e : edges) g.addEdge(e);
+        ExternalKruskalMST::writeEdgeFile(g, path);
+
+        // Distinct weights: the very same forest, for any run size
+        const KruskalMST expected(g);
+        for (const std::size_t runEdges : {std::size_t{7}, std::size_t{500}, static_cast<std::size_t>(V) * 3,
+                                           ExternalKruskalMST::DEFAULT_RUN_EDGES}) {
+            const ExternalKruskalMST mst(path, V, runEdges);
+            assert(sameEdges(mst.edges(), expected.edges()));
+            assert(mst.weight() == expected.weight());
+        }
+    }
+    std::remove(path.c_str());
+
+    std::cout << "testMatchesKruskal passed\n";
+}
+
+void testTiesAndMergePasses() {
+    std::mt19937 rng(7);
+    const std::string path = tempPath("ties.bin");
+    const int V = 300;
+    const std::vector<Edge> edges = randomEdges(V, 20000, true, rng);
+    ExternalKruskalMST::writeEdgeFile(edges, path);
+
+    // Ties are broken by file position, as in FilterKruskalMST on the same list
+    const FilterKruskalMST expected(V, edges, KruskalSort::Comparison, 1);
+
+    // 20 000 / 50 = 400 runs: more than one merge pass
+    const ExternalKruskalMST multiPass(path, V, 50);
+    assert(multiPass.runCount() == 400);
+    assert(sameEdges(multiPass.edges(), expected.edges()));
+    assert(multiPass.weight() == expected.weight());
+
+    // Runs of at least V edges are reduced to their spanning forest before being written
+    const ExternalKruskalMST filtered(path, V, 1000);
+    assert(filtered.runCount() == 20);
+    assert(filtered.spilledCount() <= 20LL * (V - 1));
+    assert(sameEdges(filtered.edges(), expected.edges()));
+
+    std::remove(path.c_str());
+    std::cout << "testTiesAndMergePasses passed\n";
+}
+
+void testManyRuns() {
+    std::mt19937 rng(11);
+    const std::string path = tempPath("many.bin");
+    const int V = 200;
+    EdgeWeightedGraph g(V);
+    for (const Edge& e : randomEdges(V, 6000, false, rng)) g.addEdge(e);
+    ExternalKruskalMST::writeEdgeFile(g, path);
+    const KruskalMST expected(g);
+
+    // 6000 one-edge runs, with fewer descriptors allowed than there are runs:
+    // full levels are merged as they fill, so only a few dozen files are open at once
+    rlimit saved{};
+    getrlimit(RLIMIT_NOFILE, &saved);
+    rlimit limited = saved;
+    limited.rlim_cur = std::min<rlim_t>(saved.rlim_cur, 512);
+    setrlimit(RLIMIT_NOFILE, &limited);
+    const ExternalKruskalMST mst(path, V, 1);
+    setrlimit(RLIMIT_NOFILE, &saved);
+
+    assert(mst.runCount() == 6000);
+    assert(sameEdges(mst.edges(), expected.edges()));
+    assert(mst.weight() == expected.weight());
+
+    std::remove(path.c_str());
+    std::cout << "testManyRuns passed\n";
+}
+
+void testDisconnected() {
+    const std::string path = tempPath("forest.bin");
+    ExternalKruskalMST::writeEdgeFile({Edge(0, 1, 2.0), Edge(2, 3, 1.0), Edge(1, 0, 1.0), Edge(3, 2, 5.0)}, path);
+    const ExternalKruskalMST mst(path, 6, 1);
+    assert(mst.runCount() == 4);
+    assert(sameEdges(mst.edges(), {Edge(2, 3, 1.0), Edge(1, 0, 1.0)}));
+
+    ExternalKruskalMST::writeEdgeFile(std::vector<Edge>{}, path);
+    const ExternalKruskalMST empty(path, 3);
+    assert(empty.edges().empty() && empty.weight() == 0.0 && empty.runCount() == 0);
+
+    std::remove(path.c_str());
+    std::cout << "testDisconnected passed\n";
+}
+
+void testInvalidArguments() {
+    const std::string path = tempPath("invalid.bin");
+    ExternalKruskalMST::writeEdgeFile({Edge(0, 1, 1.0), Edge(1, 4, 1.0)}, path);
+
+    try {
+        ExternalKruskalMST mst(path, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ExternalKruskalMST mst(path, -1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ExternalKruskalMST mst(path, 5, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ExternalKruskalMST mst(tempPath("missing.bin"), 5);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Truncated file
+    std::filesystem::resize_file(path, sizeof(GraphFileEdgeRecord) + 3);
+    try {
+        ExternalKruskalMST mst(path, 5);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    std::remove(path.c_str());
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: 2 million edges streamed with a budget of 1/16 of them in memory
+void benchmarkExternal() {
+    const int V = 100000, E = 2000000;
+    std::mt19937 rng(42);
+    const std::vector<Edge> edges = randomEdges(V, E, false, rng);
+    const std::string path = tempPath("benchmark.bin");
+    ExternalKruskalMST::writeEdgeFile(edges, path);
+
+    using std::chrono::milliseconds;
+    const auto time = [](const auto& f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double externalWeight = 0.0, inMemoryWeight = 0.0;
+    long long spilled = 0;
+    const auto external = time([&] {
+        const ExternalKruskalMST mst(path, V, E / 16);
+        externalWeight = mst.weight();
+        spilled = mst.spilledCount();
+    });
+    const auto oneRun = time([&] { ExternalKruskalMST mst(path, V, E); });
+
+    EdgeWeightedGraph g(V);
+    const auto build = time([&] {
+        for (const Edge& e : edges) g.addEdge(e);
+    });
+    const auto inMemory = time([&] { inMemoryWeight = KruskalMST(g).weight(); });
+    assert(externalWeight == inMemoryWeight);
+
+    std::cout << "benchmarkExternal (" << V << " vertices, " << E << " edges):\n"
+              << "  ExternalKruskalMST, 16 runs:  " << external << " ms (" << spilled << " edges spilled)\n"
+              << "  ExternalKruskalMST, one run:  " << oneRun << " ms\n"
+              << "  EdgeWeightedGraph build:      " << build << " ms\n"
+              << "  KruskalMST on the graph:      " << inMemory << " ms\n";
+
+    std::remove(path.c_str());
+}
+
+int main() {
+    std::cout << "Running ExternalKruskalMST tests...\n";
+
+    testSmallGraph();
+    testMatchesKruskal();
+    testTiesAndMergePasses();
+    testManyRuns();
+    testDisconnected();
+    testInvalidArguments();
+    benchmarkExternal();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../data_structures/BoruvkaMST.hpp"
+#include "../data_structures/Edge.hpp"
+#include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/FilterKruskalMST.hpp"
+#include "../data_structures/KruskalMST.hpp"
+#include "../data_structures/LazyPrimMST.hpp"
+#include "../data_structures/ParallelBoruvkaMST.hpp"
+#include "../data_structures/PrimMST.hpp"
+#include "../data_structures/WeightedQuickUnionPathCompressionUF.hpp"
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Checks that the edges form a forest with one tree per connected component of g
+void checkSpanningForest(const std::vector<Edge>& forest, const int V, const std::vector<Edge>& graphEdges) {
+    WeightedQuickUnionPathCompressionUF uf(V);
+    for (const Edge& e : forest) {
+        const int v = e.either(), w = e.other(v);
+        assert(!uf.connected(v, w));
+        uf.unite(v, w);
+    }
+    for (const Edge& e : graphEdges) {
+        assert(uf.connected(e.either(), e.other(e.either())));
+    }
+}
+
+// Edges as (v, w, weight) tuples with v <= w, in sorted order
+std::vector<std::tuple<int, int, double>> canonical(const std::vector<Edge>& edges) {
+    std::vector<std::tuple<int, int, double>> result;
+    for (const Edge& e : edges) {
+        const int v = e.either(), w = e.other(v);
+        result.emplace_back(std::min(v, w), std::max(v, w), e.weight());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<Edge> randomEdges(std::mt19937& rng, const int V, const int E, const int maxWeight) {
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_int_distribution<int> weight(-maxWeight, maxWeight);
+    std::vector<Edge> edges;
+    for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng) / 4.0);
+    return edges;
+}
+
+void testSmallGraph() {
+    EdgeWeightedGraph g(5);
+    g.addEdge(Edge(0, 1, 1.0));
+    g.addEdge(Edge(1, 2, 2.0));
+    g.addEdge(Edge(0, 2, 3.0));
+    g.addEdge(Edge(2, 3, 0.5));
+    g.addEdge(Edge(3, 3, 0.1));  // self-loop, ignored
+    g.addEdge(Edge(1, 3, 4.0));
+
+    for (const KruskalSort sort : {KruskalSort::Comparison, KruskalSort::Radix}) {
+        const FilterKruskalMST mst(g, sort, 2);
+        assert(mst.edges().size() == 3);
+        assert(mst.weight() == 3.5);
+        checkSpanningForest(mst.edges(), g.V(), g.edges());
+
+        // Edges come out in the order Kruskal's algorithm adds them
+        const std::vector<Edge> edges = mst.edges();
+        assert(edges[0].weight() == 0.5 && edges[1].weight() == 1.0 && edges[2].weight() == 2.0);
+    }
+
+    const FilterKruskalMST empty(EdgeWeightedGraph(3));
+    assert(empty.edges().empty());
+    assert(empty.weight() == 0.0);
+    assert(empty.sortedCount() == 0);
+
+    std::cout << "testSmallGraph passed\n";
+}
+
+void testNegativeAndZeroWeights() {
+    // Negative weights reverse the bit order of the key. -0.0 ties with 0.0, so
+    // vertex 4 joins through the earlier edge (1, 4)
+    const std::vector<Edge> edges = {Edge(0, 1, -2.5), Edge(1, 4, 0.0), Edge(3, 4, -0.0), Edge(0, 3, -1.0),
+                                     Edge(1, 3, -3.0), Edge(0, 2, 1e300), Edge(2, 4, 1e-300)};
+    for (const KruskalSort sort : {KruskalSort::Comparison, KruskalSort::Radix}) {
+        const FilterKruskalMST mst(5, edges, sort, 1);
+        const std::vector<Edge> result = mst.edges();
+        assert(result.size() == 4);
+        assert(mst.weight() == -5.5 + 1e-300);
+        assert(result[0].weight() == -3.0 && result[1].weight() == -2.5);
+        assert(result[2].either() == 1 && result[2].other(1) == 4);
+        assert(result[3].weight() == 1e-300);
+    }
+
+    std::cout << "testNegativeAndZeroWeights passed\n";
+}
+
+void testMatchesOtherAlgorithms() {
+    std::mt19937 rng(11);
+    for (int trial = 0; trial < 12; ++trial) {
+        // Large enough to partition and filter several times
+        const int V = 2000 + trial * 1500;
+        const int E = (trial % 3 == 0) ? V / 2 : 8 * V;  // some very disconnected graphs
+        const std::vector<Edge> edges = randomEdges(rng, V, E, 40);  // few distinct weights: many ties
+        EdgeWeightedGraph g(V);
+        for (const Edge& e : edges) g.addEdge(e);
+
+        const KruskalMST kruskal(g);
+        const ParallelBoruvkaMST boruvka(V, edges, 1);
+        const FilterKruskalMST comparison(V, edges, KruskalSort::Comparison, 1);
+        const FilterKruskalMST radix(V, edges, KruskalSort::Radix, 1);
+        const FilterKruskalMST parallel(V, edges, KruskalSort::Radix, 4);
+        const FilterKruskalMST fromGraph(g, KruskalSort::Radix, 3);
+
+        // Weights are multiples of 1/4, so the sums are exact
+        assert(comparison.weight() == kruskal.weight());
+        assert(fromGraph.weight() == kruskal.weight());
+        assert(comparison.edges().size() == kruskal.edges().size());
+        checkSpanningForest(comparison.edges(), V, edges);
+        checkSpanningForest(fromGraph.edges(), V, edges);
+
+        // Same tie-breaking everywhere, so the same forest in the same order
+        assert(canonical(comparison.edges()) == canonical(boruvka.edges()));
+        assert(canonical(radix.edges()) == canonical(comparison.edges()));
+        assert(canonical(parallel.edges()) == canonical(radix.edges()));
+        const std::vector<Edge> a = radix.edges(), b = parallel.edges(), c = comparison.edges();
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            assert(a[i].either() == b[i].either() && a[i].other(a[i].either()) == b[i].other(b[i].either()));
+            assert(a[i].either() == c[i].either() && a[i].other(a[i].either()) == c[i].other(c[i].either()));
+        }
+    }
+
+    std::cout << "testMatchesOtherAlgorithms passed\n";
+}
+
+void testFiltering() {
+    // On a dense graph most heavy edges are filtered out before they are sorted
+    std::mt19937 rng(5);
+    const int V = 5000, E = 400000;
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<Edge> edges;
+    for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+
+    const FilterKruskalMST mst(V, edges, KruskalSort::Radix, 2);
+    assert(static_cast<int>(mst.edges().size()) == V - 1);
+    assert(mst.sortedCount() < E / 4);
+
+    // Mostly unit weights: the unit edges are still filtered against the lighter forest
+    std::vector<Edge> ties;
+    for (int i = 0; i < 200000; ++i) ties.emplace_back(vertex(rng), vertex(rng), i % 5 == 0 ? weight(rng) : 1.0);
+    EdgeWeightedGraph tieGraph(V);
+    for (const Edge& e : ties) tieGraph.addEdge(e);
+    const FilterKruskalMST tied(V, ties, KruskalSort::Radix, 2);
+    assert(close(tied.weight(), KruskalMST(tieGraph).weight()));
+    assert(canonical(tied.edges()) == canonical(ParallelBoruvkaMST(V, ties, 1).edges()));
+    assert(tied.sortedCount() < 40000);  // fewer than the light edges alone
+    checkSpanningForest(tied.edges(), V, ties);
+
+    // Equal weights: nothing is lighter to filter against, so every edge is sorted
+    std::vector<Edge> equal;
+    for (int i = 0; i < 50000; ++i) equal.emplace_back(vertex(rng), vertex(rng), 1.0);
+    const FilterKruskalMST flat(V, equal, KruskalSort::Radix, 2);
+    assert(flat.sortedCount() == static_cast<int>(std::count_if(equal.begin(), equal.end(), [](const Edge& e) {
+               return e.either() != e.other(e.either());
+           })));
+    checkSpanningForest(flat.edges(), V, equal);
+
+    std::cout << "testFiltering passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        FilterKruskalMST mst(2, {Edge(0, 2, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        FilterKruskalMST mst(-1, std::vector<Edge>{});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        FilterKruskalMST mst(EdgeWeightedGraph(2), KruskalSort::Radix, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: random graph with 50 000 vertices and 1 million edges
+void benchmarkRandomGraph() {
+    const int V = 50000, E = 1000000;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<Edge> edges;
+    edges.reserve(E);
+    for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    EdgeWeightedGraph g(V);
+    for (const Edge& e : edges) g.addEdge(e);
+
+    using std::chrono::milliseconds;
+    const auto time = [](const auto& f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double kruskalWeight = 0.0, primWeight = 0.0, lazyPrimWeight = 0.0, boruvkaWeight = 0.0;
+    double comparisonWeight = 0.0, radixWeight = 0.0, parallelWeight = 0.0, edgeListWeight = 0.0;
+    int sorted = 0;
+    const auto kruskal = time([&] { kruskalWeight = KruskalMST(g).weight(); });
+    const auto prim = time([&] { primWeight = PrimMST(g).weight(); });
+    const auto lazyPrim = time([&] { lazyPrimWeight = LazyPrimMST(g).weight(); });
+    const auto boruvka = time([&] { boruvkaWeight = BoruvkaMST(g).weight(); });
+    const auto fromGraph = time([&] { radixWeight = FilterKruskalMST(g, KruskalSort::Radix, 1).weight(); });
+
+    // The edge-list form skips walking the adjacency lists, which dominates the runs above
+    const auto comparison = time([&] {
+        comparisonWeight = FilterKruskalMST(V, edges, KruskalSort::Comparison, 1).weight();
+    });
+    const auto radix = time([&] {
+        const FilterKruskalMST mst(V, edges, KruskalSort::Radix, 1);
+        edgeListWeight = mst.weight();
+        sorted = mst.sortedCount();
+    });
+    const auto parallel = time([&] { parallelWeight = FilterKruskalMST(V, edges).weight(); });
+    const auto sortAll = time([&] {
+        std::vector<Edge> copy = edges;
+        std::sort(copy.begin(), copy.end());
+    });
+    assert(close(primWeight, kruskalWeight));
+    assert(close(lazyPrimWeight, kruskalWeight));
+    assert(close(boruvkaWeight, kruskalWeight));
+    assert(close(radixWeight, kruskalWeight));
+    assert(close(comparisonWeight, kruskalWeight));
+    assert(close(edgeListWeight, kruskalWeight));
+    assert(close(parallelWeight, kruskalWeight));
+
+    std::cout << "benchmarkRandomGraph (" << V << " vertices, " << E << " edges, "
+              << "threads: " << ThreadPool::defaultThreads() << "):\n"
+              << "  KruskalMST:                              " << kruskal << " ms\n"
+              << "  PrimMST:                                 " << prim << " ms\n"
+              << "  LazyPrimMST:                             " << lazyPrim << " ms\n"
+              << "  BoruvkaMST:                              " << boruvka << " ms\n"
+              << "  FilterKruskalMST (graph, radix):         " << fromGraph << " ms\n"
+              << "  Edge list, std::sort only:               " << sortAll << " ms\n"
+              << "  FilterKruskalMST (comparison, 1 thread): " << comparison << " ms\n"
+              << "  FilterKruskalMST (radix, 1 thread):      " << radix << " ms, " << sorted << " edges sorted\n"
+              << "  FilterKruskalMST (radix, all threads):   " << parallel << " ms\n";
+}
+
+int main() {
+    std::cout << "Running FilterKruskalMST tests...\n";
+
+    testSmallGraph();
+    testNegativeAndZeroWeights();
+    testMatchesOtherAlgorithms();
+    testFiltering();
+    testInvalidArguments();
+    benchmarkRandomGraph();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/DijkstraAllPairsSP.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+#include "../data_structures/FloydWarshall.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Dense random digraph: each ordered pair gets an edge with the given probability
+EdgeWeightedDigraph denseDigraph(const int V, const double density, const double minWeight, const unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::uniform_real_distribution<double> weight(minWeight, 1.0);
+    EdgeWeightedDigraph g(V);
+    for (int v = 0; v < V; ++v) {
+        for (int w = 0; w < V; ++w) {
+            if (v != w && coin(rng) < density) g.addEdge(DirectedEdge(v, w, weight(rng)));
+        }
+    }
+    return g;
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(5);
+    g.addEdge(DirectedEdge(0, 1, 2.0));
+    g.addEdge(DirectedEdge(1, 2, 3.0));
+    g.addEdge(DirectedEdge(0, 2, 6.0));
+    g.addEdge(DirectedEdge(2, 3, -1.0));
+    g.addEdge(DirectedEdge(0, 3, 5.0));
+    g.addEdge(DirectedEdge(0, 3, 4.5));  // parallel edge, lighter
+
+    const FloydWarshall fw(g, 1);
+    assert(!fw.hasNegativeCycle());
+    assert(fw.negativeCycle().empty());
+    assert(fw.V() == 5);
+    assert(fw.dist(0, 2) == 5.0);
+    assert(fw.dist(0, 3) == 4.0);
+    assert(pathWeight(fw.path(0, 3), 0, 3) == 4.0);
+    assert(fw.path(0, 3).size() == 3);
+    assert(fw.dist(1, 3) == 2.0);
+    assert(fw.dist(3, 3) == 0.0);
+    assert(fw.path(3, 3).empty());
+    assert(fw.hasPath(0, 0));
+    assert(!fw.hasPath(3, 0));
+    assert(fw.dist(3, 0) == std::numeric_limits<double>::max());
+    assert(fw.path(3, 0).empty());
+    assert(!fw.hasPath(4, 0));
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesDijkstraAllPairs() {
+    // Several tiles per side, with a partial last tile
+    for (const int V : {1, 63, 64, 150}) {
+        const EdgeWeightedDigraph g = denseDigraph(V, 0.2, 0.0, V);
+        const DijkstraAllPairsSP dijkstra(g, 1);
+        for (const int threads : {1, 3}) {
+            const FloydWarshall fw(g, threads);
+            for (int s = 0; s < V; ++s) {
+                for (int t = 0; t < V; ++t) {
+                    assert(fw.hasPath(s, t) == dijkstra.hasPath(s, t));
+                    if (!dijkstra.hasPath(s, t)) {
+                        assert(fw.dist(s, t) == std::numeric_limits<double>::max());
+                        continue;
+                    }
+                    assert(nearlyEqual(fw.dist(s, t), dijkstra.dist(s, t)));
+                    assert(nearlyEqual(pathWeight(fw.path(s, t), s, t), dijkstra.dist(s, t)));
+                }
+            }
+        }
+    }
+
+    std::cout << "testMatchesDijkstraAllPairs passed\n";
+}
+
+void testNegativeWeights() {
+    // Reweighting by potentials keeps shortest paths but makes some weights negative
+    const int V = 100;
+    const EdgeWeightedDigraph base = denseDigraph(V, 0.1, 0.0, 7);
+    std::vector<double> potential(V);
+    for (int v = 0; v < V; ++v) potential[v] = (v * 37 % 11) * 0.3;
+    EdgeWeightedDigraph shifted(V);
+    for (const auto& e : base.edges()) {
+        shifted.addEdge(DirectedEdge(e.from(), e.to(), e.weight() + potential[e.from()] - potential[e.to()]));
+    }
+
+    const DijkstraAllPairsSP dijkstra(base, 1);
+    const FloydWarshall fw(shifted, 2);
+    assert(!fw.hasNegativeCycle());
+    for (int s = 0; s < V; ++s) {
+        for (int t = 0; t < V; ++t) {
+            assert(fw.hasPath(s, t) == dijkstra.hasPath(s, t));
+            if (!fw.hasPath(s, t)) continue;
+            const double expected = dijkstra.dist(s, t) + potential[s] - potential[t];
+            assert(std::abs(fw.dist(s, t) - expected) < 1e-9);
+            assert(std::abs(pathWeight(fw.path(s, t), s, t) - expected) < 1e-9);
+        }
+    }
+
+    std::cout << "testNegativeWeights passed\n";
+}
+
+void testNegativeCycle() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 3, -2.0));
+    g.addEdge(DirectedEdge(3, 1, 0.5));
+    g.addEdge(DirectedEdge(3, 4, 1.0));
+
+    const FloydWarshall fw(g, 2);
+    assert(fw.hasNegativeCycle());
+    const std::vector<DirectedEdge> cycle = fw.negativeCycle();
+    assert(cycle.size() == 3);
+    assert(pathWeight(cycle, cycle.front().from(), cycle.front().from()) < 0.0);
+    try {
+        fw.dist(0, 4);
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        fw.path(0, 4);
+        assert(false);
+    } catch (const std::logic_error&) {}
+
+    // Negative self-loop
+    EdgeWeightedDigraph loop(2);
+    loop.addEdge(DirectedEdge(1, 1, -0.5));
+    const FloydWarshall fwLoop(loop, 1);
+    assert(fwLoop.hasNegativeCycle());
+    assert(fwLoop.negativeCycle().size() == 1);
+
+    // Random digraphs with negative cycles: the reported cycle is real and negative
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+        const EdgeWeightedDigraph r = denseDigraph(90, 0.05, -0.3, seed);
+        const FloydWarshall rfw(r, 2);
+        if (!rfw.hasNegativeCycle()) continue;
+        const std::vector<DirectedEdge> c = rfw.negativeCycle();
+        assert(pathWeight(c, c.front().from(), c.front().from()) < 0.0);
+    }
+
+    std::cout << "testNegativeCycle passed\n";
+}
+
+void testInvalidArguments() {
+    const EdgeWeightedDigraph g(3);
+    const FloydWarshall fw(g, 1);
+    try {
+        fw.dist(0, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        fw.path(-1, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        FloydWarshall bad(g, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph empty(0);
+    const FloydWarshall none(empty, 1);
+    assert(none.V() == 0);
+    assert(!none.hasNegativeCycle());
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void benchmarkDenseDigraph() {
+    const int V = 800;
+    const EdgeWeightedDigraph g = denseDigraph(V, 0.9, 0.0, 99);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    const DijkstraAllPairsSP dijkstra(g);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  DijkstraAllPairsSP (V = " << V << ", E = " << g.E() << "): "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+    start = std::chrono::high_resolution_clock::now();
+    const FloydWarshall fw(g);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "  FloydWarshall:                                 "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+    for (int s = 0; s < V; s += 31) {
+        for (int t = 0; t < V; t += 7) {
+            assert(nearlyEqual(fw.dist(s, t), dijkstra.dist(s, t)));
+        }
+    }
+
+    std::cout << "benchmarkDenseDigraph passed\n";
+}
+
+int main() {
+    std::cout << "Running FloydWarshall tests...\n";
+
+    testSmallDigraph();
+    testMatchesDijkstraAllPairs();
+    testNegativeWeights();
+    testNegativeCycle();
+    testInvalidArguments();
+    benchmarkDenseDigraph();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
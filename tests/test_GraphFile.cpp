@@ -0,0 +1,237 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../data_structures/BreadthFirstDirectedPaths.hpp"
+#include "../data_structures/ConnectedComponents.hpp"
+#include "../data_structures/DigraphGenerator.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/GraphFile.hpp"
+#include "../data_structures/GraphGenerator.hpp"
+#include "../data_structures/KosarajuSharirSCC.hpp"
+#include "../data_structures/KruskalMST.hpp"
+#include "../data_structures/PrimMST.hpp"
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("test_GraphFile_" + name)).string();
+}
+
+void testGraphRoundTrip() {
+    const Graph g = GraphGenerator::simple(50, 120);
+    const std::string path = tempPath("graph.bin");
+    GraphFile::write(g, path);
+
+    const MappedGraph mapped(path);
+    assert(mapped.V() == g.V());
+    assert(mapped.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(g.adj(v) == std::vector<int>(mapped.adj(v).begin(), mapped.adj(v).end()));
+        assert(mapped.degree(v) == g.degree(v));
+    }
+
+    const ConnectedComponents cc1(g), cc2(mapped);
+    assert(cc1.count() == cc2.count());
+    for (int v = 0; v < g.V(); ++v) assert(cc1.id(v) == cc2.id(v));
+
+    std::remove(path.c_str());
+    std::cout << "testGraphRoundTrip passed\n";
+}
+
+void testDigraphRoundTrip() {
+    const Digraph g = DigraphGenerator::simple(40, 150);
+    const std::string path = tempPath("digraph.bin");
+    GraphFile::write(g, path);
+
+    const MappedDigraph mapped(path);
+    assert(mapped.V() == g.V());
+    assert(mapped.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(g.adj(v) == std::vector<int>(mapped.adj(v).begin(), mapped.adj(v).end()));
+        assert(mapped.outdegree(v) == g.outdegree(v));
+        assert(mapped.indegree(v) == g.indegree(v));
+    }
+
+    const BreadthFirstDirectedPaths bfs1(g, 0), bfs2(mapped, 0);
+    for (int v = 0; v < g.V(); ++v) assert(bfs1.pathTo(v) == bfs2.pathTo(v));
+
+    const KosarajuSharirSCC scc1(g), scc2(mapped);
+    assert(scc1.count() == scc2.count());
+    for (int v = 0; v < g.V(); ++v) assert(scc1.id(v) == scc2.id(v));
+
+    // A CSRDigraph writes the same file contents
+    const std::string csrPath = tempPath("csr.bin");
+    GraphFile::write(CSRDigraph(g), csrPath);
+    std::ifstream a(path, std::ios::binary), b(csrPath, std::ios::binary);
+    assert(std::string(std::istreambuf_iterator<char>(a), {}) == std::string(std::istreambuf_iterator<char>(b), {}));
+
+    std::remove(path.c_str());
+    std::remove(csrPath.c_str());
+    std::cout << "testDigraphRoundTrip passed\n";
+}
+
+void testEdgeWeightedGraphRoundTrip() {
+    EdgeWeightedGraph g(6);
+    g.addEdge(Edge(0, 1, 0.5));
+    g.addEdge(Edge(1, 2, 0.25));
+    g.addEdge(Edge(2, 0, 1.0));
+    g.addEdge(Edge(3, 4, 0.75));
+    g.addEdge(Edge(4, 4, 0.1));  // self-loop
+    g.addEdge(Edge(5, 3, 0.3));
+
+    const std::string path = tempPath("ewgraph.bin");
+    GraphFile::write(g, path);
+
+    const MappedEdgeWeightedGraph mapped(path);
+    assert(mapped.V() == 6);
+    assert(mapped.E() == 6);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(g.adj(v) == std::vector<Edge>(mapped.adj(v)));
+        assert(mapped.degree(v) == g.degree(v));
+    }
+    assert(mapped.edges() == g.edges());
+    assert(mapped.adj(0)[0].weight() == 1.0);
+
+    const PrimMST prim1(g), prim2(mapped);
+    const KruskalMST kruskal(mapped);
+    assert(prim1.weight() == prim2.weight());
+    assert(std::abs(kruskal.weight() - prim1.weight()) < 1e-12);
+
+    std::remove(path.c_str());
+    std::cout << "testEdgeWeightedGraphRoundTrip passed\n";
+}
+
+void testEdgeWeightedDigraphRoundTrip() {
+    const EdgeWeightedDigraph g(30, 120);
+    const std::string path = tempPath("ewdigraph.bin");
+    GraphFile::write(g, path);
+
+    const MappedEdgeWeightedDigraph mapped(path);
+    assert(mapped.V() == g.V());
+    assert(mapped.E() == g.E());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(g.adj(v) == std::vector<DirectedEdge>(mapped.adj(v)));
+        assert(mapped.outdegree(v) == g.outdegree(v));
+        assert(mapped.indegree(v) == g.indegree(v));
+    }
+    assert(mapped.edges() == g.edges());
+    assert(mapped.reverse().edges() == g.reverse().edges());
+
+    const DijkstraSP sp1(g, 0), sp2(mapped, 0);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sp1.distTo(v) == sp2.distTo(v));
+        assert(sp1.pathTo(v) == sp2.pathTo(v));
+    }
+
+    std::remove(path.c_str());
+    std::cout << "testEdgeWeightedDigraphRoundTrip passed\n";
+}
+
+void testEmptyGraph() {
+    const std::string path = tempPath("empty.bin");
+    GraphFile::write(Digraph(0), path);
+
+    const MappedDigraph mapped(path);
+    assert(mapped.V() == 0);
+    assert(mapped.E() == 0);
+
+    std::remove(path.c_str());
+    std::cout << "testEmptyGraph passed\n";
+}
+
+void testMoveKeepsMappingAlive() {
+    Digraph g(3);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    const std::string path = tempPath("move.bin");
+    GraphFile::write(g, path);
+
+    std::vector<MappedDigraph> graphs;
+    graphs.emplace_back(path);
+    MappedDigraph moved = std::move(graphs.back());
+    graphs.clear();
+    assert(moved.adj(1)[0] == 2);
+
+    std::remove(path.c_str());
+    std::cout << "testMoveKeepsMappingAlive passed\n";
+}
+
+void testInvalidFiles() {
+    // Missing file
+    try {
+        MappedGraph g(tempPath("does_not_exist.bin"));
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Wrong kind of graph
+    const std::string path = tempPath("kind.bin");
+    GraphFile::write(Graph(3), path);
+    try {
+        MappedDigraph g(path);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Truncated file
+    Graph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(2, 3);
+    GraphFile::write(g, path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    try {
+        MappedGraph mapped(path);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Interior offsets out of order, with both ends intact
+    GraphFile::write(g, path);
+    {
+        std::fstream out(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::int64_t bad = 3;  // offsets are 0 1 2 3 4; make offsets[1] exceed offsets[2]
+        out.seekp(sizeof(GraphFileHeader) + sizeof(std::int64_t));
+        out.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+    }
+    try {
+        MappedGraph mapped(path);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Not a graph file at all
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "definitely not a graph file, but long enough to hold a full header....";
+    }
+    try {
+        MappedGraph mapped(path);
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // Vertex validation on the mapped graph
+    GraphFile::write(Graph(2), path);
+    const MappedGraph mapped(path);
+    try {
+        mapped.adj(2);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::remove(path.c_str());
+    std::cout << "testInvalidFiles passed\n";
+}
+
+int main() {
+    std::cout << "Running GraphFile tests...\n";
+
+    testGraphRoundTrip();
+    testDigraphRoundTrip();
+    testEdgeWeightedGraphRoundTrip();
+    testEdgeWeightedDigraphRoundTrip();
+    testEmptyGraph();
+    testMoveKeepsMappingAlive();
+    testInvalidFiles();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
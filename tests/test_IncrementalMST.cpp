@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../data_structures/Edge.hpp"
+#include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/FilterKruskalMST.hpp"
+#include "../data_structures/IncrementalMST.hpp"
+#include "../data_structures/KruskalMST.hpp"
+
+// Edges as (v, w, weight) tuples with v <= w, in sorted order
+std::vector<std::tuple<int, int, double>> canonical(const std::vector<Edge>& edges) {
+    std::vector<std::tuple<int, int, double>> result;
+    for (const Edge& e : edges) {
+        const int v = e.either(), w = e.other(v);
+        result.emplace_back(std::min(v, w), std::max(v, w), e.weight());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void testSmallGraph() {
+    IncrementalMST mst(5);
+    assert(mst.size() == 0 && mst.weight() == 0.0);
+
+    assert(mst.insert(Edge(0, 1, 4.0)));
+    assert(mst.insert(Edge(1, 2, 3.0)));
+    assert(mst.insert(Edge(2, 3, 5.0)));
+    assert(!mst.insert(Edge(3, 3, 0.5)));  // self-loop, ignored
+    assert(mst.weight() == 12.0);
+    assert(mst.connected(0, 3));
+    assert(!mst.connected(0, 4));
+
+    // 0-3 closes the cycle 0-1-2-3 and is lighter than its heaviest edge 2-3
+    assert(mst.insert(Edge(0, 3, 2.0)));
+    assert(mst.weight() == 9.0);
+    assert(canonical(mst.edges()) == canonical({Edge(0, 1, 4.0), Edge(1, 2, 3.0), Edge(0, 3, 2.0)}));
+
+    // Heavier than everything on its cycle: dropped
+    assert(!mst.insert(Edge(1, 3, 4.5)));
+    // Equal to the heaviest edge on its cycle: the older edge stays
+    assert(!mst.insert(Edge(1, 3, 4.0)));
+    assert(mst.weight() == 9.0);
+
+    assert(mst.insert(Edge(4, 2, 7.0)));
+    assert(mst.size() == 4);
+    assert(mst.inserted() == 8);
+
+    std::cout << "testSmallGraph passed\n";
+}
+
+void testWeightDecrease() {
+    IncrementalMST mst(4);
+    mst.insert(Edge(0, 1, 1.0));
+    mst.insert(Edge(1, 2, 9.0));
+    mst.insert(Edge(2, 3, 1.0));
+    mst.insert(Edge(0, 3, 5.0));
+    assert(mst.weight() == 7.0);  // 1-2 was replaced by 0-3
+
+    // Decrease 1-2 below 0-3: it comes back
+    assert(mst.insert(Edge(1, 2, 2.0)));
+    assert(mst.weight() == 4.0);
+    // Decrease a forest edge: the lighter copy replaces it
+    assert(mst.insert(Edge(2, 1, 0.5)));
+    assert(mst.weight() == 2.5);
+    assert(mst.size() == 3);
+
+    std::cout << "testWeightDecrease passed\n";
+}
+
+void testMatchesKruskal() {
+    std::mt19937 rng(21);
+    for (int trial = 0; trial < 10; ++trial) {
+        const int V = 50 + trial * 40;
+        std::uniform_int_distribution<int> vertex(0, V - 1);
+        std::uniform_int_distribution<int> weight(-10, 30);  // integer weights: many ties, exact sums
+        IncrementalMST single(V), batched(V);
+        std::vector<Edge> all;
+
+        for (int round = 0; round < 8; ++round) {
+            std::vector<Edge> batch;
+            for (int i = 0; i < V; ++i) batch.emplace_back(vertex(rng), vertex(rng), weight(rng));
+            for (const Edge& e : batch) single.insert(e);
+            batched.insert(batch);
+            all.insert(all.end(), batch.begin(), batch.end());
+
+            // Same forest as Kruskal with ties broken by arrival order
+            const FilterKruskalMST kruskal(V, all, KruskalSort::Comparison, 1);
+            assert(single.weight() == kruskal.weight());
+            assert(batched.weight() == kruskal.weight());
+            assert(canonical(single.edges()) == canonical(kruskal.edges()));
+            assert(canonical(batched.edges()) == canonical(kruskal.edges()));
+
+            EdgeWeightedGraph g(V);
+            for (const Edge& e : all) g.addEdge(e);
+            assert(single.weight() == KruskalMST(g).weight());
+        }
+
+        // Seeding from a graph is one batch
+        EdgeWeightedGraph g(V);
+        for (const Edge& e : all) g.addEdge(e);
+        const IncrementalMST fromGraph(g);
+        assert(fromGraph.weight() == single.weight());
+        assert(fromGraph.size() == single.size());
+    }
+
+    std::cout << "testMatchesKruskal passed\n";
+}
+
+void testSnapshot() {
+    IncrementalMST mst(4);
+    mst.insert(Edge(0, 1, 3.0));
+    mst.insert(Edge(1, 2, 3.0));
+
+    const auto first = mst.snapshot();
+    assert(first->size() == 2);
+    assert(mst.snapshot() == first);  // unchanged forest: shared copy
+
+    assert(!mst.insert(Edge(0, 2, 5.0)));
+    assert(mst.snapshot() == first);  // rejected edges do not change the forest
+
+    assert(mst.insert(Edge(0, 2, 1.0)));
+    const auto second = mst.snapshot();
+    assert(second != first);
+    assert(first->size() == 2 && canonical(*first) == canonical({Edge(0, 1, 3.0), Edge(1, 2, 3.0)}));
+    assert(canonical(*second) == canonical({Edge(0, 1, 3.0), Edge(0, 2, 1.0)}));
+
+    std::cout << "testSnapshot passed\n";
+}
+
+void testLongPaths() {
+    // A path inserted heaviest first, then closed by light chords: deep splay trees
+    const int V = 100000;
+    IncrementalMST mst(V);
+    for (int v = 0; v + 1 < V; ++v) mst.insert(Edge(v, v + 1, V - v));
+    assert(mst.size() == V - 1);
+    for (int v = 0; v + 2 < V; v += 2) assert(mst.insert(Edge(v, v + 2, 0.5)));
+    assert(mst.size() == V - 1);
+
+    std::vector<Edge> forest = mst.edges();
+    double total = 0.0;
+    for (const Edge& e : forest) total += e.weight();
+    assert(total == mst.weight());
+    assert(mst.connected(0, V - 1));
+
+    std::cout << "testLongPaths passed\n";
+}
+
+void testWeightAfterLongStream() {
+    // Many swaps of real weights: weight() still equals the sum over edges()
+    std::mt19937 rng(3);
+    const int V = 500;
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1e6);
+    IncrementalMST mst(V);
+    for (int i = 0; i < 200000; ++i) {
+        mst.insert(Edge(vertex(rng), vertex(rng), weight(rng) / (1 + i % 1000)));
+        if (i % 20000 == 0) mst.weight();
+    }
+    double total = 0.0;
+    for (const Edge& e : mst.edges()) total += e.weight();
+    assert(total == mst.weight());
+
+    // Integral vertex counts of any type pick the vertex-count constructor
+    const IncrementalMST fromSize(std::size_t{4});
+    const IncrementalMST fromLong(5L);
+    assert(fromSize.V() == 4 && fromLong.V() == 5);
+
+    std::cout << "testWeightAfterLongStream passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        IncrementalMST mst(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    IncrementalMST mst(3);
+    try {
+        mst.insert(Edge(0, 3, 1.0));
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        mst.insert(std::vector<Edge>{Edge(0, 1, 1.0), Edge(0, 5, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    assert(mst.size() == 0 && mst.inserted() == 0);  // a rejected batch inserts nothing
+    try {
+        mst.connected(0, -1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const IncrementalMST empty(0);
+    assert(empty.edges().empty());
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: a stream of edges in batches, against rebuilding with KruskalMST
+void benchmarkStream() {
+    const int V = 100000, batches = 100, batchSize = 5000;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<std::vector<Edge>> stream(batches);
+    for (std::vector<Edge>& batch : stream) {
+        for (int i = 0; i < batchSize; ++i) batch.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    }
+
+    using std::chrono::milliseconds;
+    const auto time = [](const auto& f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    IncrementalMST incremental(V);
+    const auto streaming = time([&] {
+        for (const std::vector<Edge>& batch : stream) incremental.insert(batch);
+    });
+
+    EdgeWeightedGraph g(V);
+    for (const std::vector<Edge>& batch : stream) {
+        for (const Edge& e : batch) g.addEdge(e);
+    }
+    double rebuiltWeight = 0.0;
+    const auto rebuild = time([&] { rebuiltWeight = KruskalMST(g).weight(); });
+    assert(std::abs(rebuiltWeight - incremental.weight()) <= 1e-9 * rebuiltWeight);
+
+    // Keeping an up-to-date forest by rebuilding costs one rebuild per batch
+    std::cout << "benchmarkStream (" << V << " vertices, " << batches << " batches of " << batchSize << " edges):\n"
+              << "  IncrementalMST, whole stream:        " << streaming << " ms ("
+              << static_cast<double>(streaming) / batches << " ms per batch)\n"
+              << "  KruskalMST, rebuild on the full graph: " << rebuild << " ms per batch\n";
+}
+
+int main() {
+    std::cout << "Running IncrementalMST tests...\n";
+
+    testSmallGraph();
+    testWeightDecrease();
+    testMatchesKruskal();
+    testSnapshot();
+    testLongPaths();
+    testWeightAfterLongStream();
+    testInvalidArguments();
+    benchmarkStream();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/IndexBucketQueue.hpp"
+#include "../data_structures/IndexMinPQ.hpp"
+
+void testBasicOperations() {
+    IndexBucketQueue<double> pq(10);
+    assert(pq.empty());
+
+    pq.insert(3, 2.0);
+    pq.insert(7, 0.0);
+    pq.insert(1, 10.0);
+    pq.insert(4, 2.0);
+    assert(pq.size() == 4);
+    assert(pq.contains(4));
+    assert(!pq.contains(5));
+    assert(pq.keyOf(1) == 10.0);
+
+    assert(pq.minKey() == 0.0);
+    assert(pq.removeMin() == 7);
+    const int a = pq.removeMin();
+    const int b = pq.removeMin();
+    assert((a == 3 && b == 4) || (a == 4 && b == 3));
+    assert(pq.removeMin() == 1);
+    assert(pq.empty());
+
+    std::cout << "testBasicOperations passed\n";
+}
+
+void testDecreaseKeyAndRemove() {
+    IndexBucketQueue<int> pq(5);
+    pq.insert(0, 8);
+    pq.insert(1, 6);
+    pq.insert(2, 7);
+    pq.insert(3, 9);
+
+    pq.decreaseKey(3, 1);
+    assert(pq.removeMin() == 3);
+    pq.remove(1);
+    assert(!pq.contains(1));
+
+    pq.decreaseKey(0, 1);
+    assert(pq.removeMin() == 0);
+    assert(pq.removeMin() == 2);
+    assert(pq.empty());
+
+    std::cout << "testDecreaseKeyAndRemove passed\n";
+}
+
+void testRingGrowth() {
+    // Keys far beyond the initial ring force it to grow and rehash
+    IndexBucketQueue<long long> pq(4);
+    pq.insert(0, 5);
+    pq.insert(1, 100000);
+    pq.insert(2, 64);
+    pq.insert(3, 63);
+    assert(pq.removeMin() == 0);
+    assert(pq.removeMin() == 3);
+    assert(pq.removeMin() == 2);
+    assert(pq.removeMin() == 1);
+
+    // The cursor has moved; keys near it still fit
+    pq.insert(0, 100001);
+    pq.insert(1, 100000);
+    assert(pq.removeMin() == 1);
+    assert(pq.removeMin() == 0);
+
+    std::cout << "testRingGrowth passed\n";
+}
+
+void testMonotoneRandomOperations() {
+    const int n = 2000;
+    IndexBucketQueue<double> buckets(n);
+    IndexMinPQ<double> heap(n);
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> offset(0, 100);
+    std::uniform_int_distribution<int> index(0, n - 1);
+
+    double last = 0.0;
+    for (int step = 0; step < 50000; ++step) {
+        const int i = index(rng);
+        const double key = last + offset(rng);
+        if (!buckets.contains(i)) {
+            buckets.insert(i, key);
+            heap.insert(i, key);
+        } else if (key < buckets.keyOf(i)) {
+            buckets.decreaseKey(i, key);
+            heap.decreaseKey(i, key);
+        }
+
+        if (step % 3 == 0 && !heap.empty()) {
+            const double expected = heap.minKey();
+            const int r = buckets.removeMin();
+            assert(heap.keyOf(r) == expected);
+            heap.remove(r);
+            last = expected;
+        }
+        assert(buckets.size() == heap.size());
+    }
+
+    std::cout << "testMonotoneRandomOperations passed\n";
+}
+
+void testClear() {
+    IndexBucketQueue<double> pq(4);
+    pq.insert(0, 5.0);
+    pq.insert(1, 6.0);
+    pq.removeMin();
+    pq.clear();
+    assert(pq.empty());
+    assert(!pq.contains(1));
+
+    pq.insert(1, 0.0);
+    assert(pq.removeMin() == 1);
+
+    std::cout << "testClear passed\n";
+}
+
+void testInvalidOperations() {
+    try {
+        IndexBucketQueue<double> pq(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    IndexBucketQueue<double> pq(3);
+    try {
+        pq.insert(0, 1.5);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.insert(0, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.removeMin();
+        assert(false);
+    } catch (const std::underflow_error&) {}
+
+    pq.insert(0, 4.0);
+    pq.insert(1, 6.0);
+    try {
+        pq.decreaseKey(1, 6.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    pq.removeMin();
+    try {
+        pq.insert(2, 3.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidOperations passed\n";
+}
+
+int main() {
+    std::cout << "Running IndexBucketQueue tests...\n";
+
+    testBasicOperations();
+    testDecreaseKeyAndRemove();
+    testRingGrowth();
+    testMonotoneRandomOperations();
+    testClear();
+    testInvalidOperations();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
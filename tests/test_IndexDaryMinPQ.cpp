@@ -0,0 +1,351 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/CSREdgeWeightedGraph.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/DijkstraUndirectedSP.hpp"
+#include "../data_structures/IndexDaryMinPQ.hpp"
+#include "../data_structures/IndexMinPQ.hpp"
+#include "../data_structures/PrimMST.hpp"
+
+void testBasicOperations() {
+    IndexDaryMinPQ<double> pq(10);
+    assert(pq.empty());
+    assert(pq.size() == 0);
+    assert(IndexDaryMinPQ<double>::arity() == 4);
+
+    pq.insert(3, 2.5);
+    pq.insert(7, 0.5);
+    pq.insert(1, 10.0);
+    pq.insert(4, 2.5);
+    pq.insert(9, -1.0);  // unlike the monotone queues, any key is allowed
+    assert(pq.size() == 5);
+    assert(pq.contains(7));
+    assert(!pq.contains(0));
+    assert(pq.minIndex() == 9);
+    assert(pq.minKey() == -1.0);
+    assert(pq.keyOf(1) == 10.0);
+
+    assert(pq.removeMin() == 9);
+    assert(pq.removeMin() == 7);
+    const int a = pq.removeMin(), b = pq.removeMin();
+    assert((a == 3 && b == 4) || (a == 4 && b == 3));
+    assert(pq.removeMin() == 1);
+    assert(pq.empty());
+
+    std::cout << "testBasicOperations passed\n";
+}
+
+void testKeyChanges() {
+    IndexDaryMinPQ<int, 3> pq(20);
+    for (int i = 0; i < 20; ++i) pq.insert(i, 100 + i);
+
+    pq.decreaseKey(15, 1);
+    assert(pq.minIndex() == 15);
+    pq.increaseKey(15, 500);
+    assert(pq.minIndex() == 0);
+    pq.changeKey(19, 0);
+    assert(pq.minIndex() == 19);
+    pq.changeKey(19, 1000);
+    pq.remove(0);
+    pq.remove(7);
+    assert(!pq.contains(0) && !pq.contains(7));
+    assert(pq.size() == 18);
+
+    const std::vector<int> expected = {1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 15, 19};
+    for (const int i : expected) assert(pq.removeMin() == i);
+
+    std::cout << "testKeyChanges passed\n";
+}
+
+template <int D>
+void randomOperations() {
+    // Distinct keys, so every removal must match the binary heap exactly
+    const int n = 1500;
+    IndexDaryMinPQ<double, D> dary(n);
+    IndexMinPQ<double> heap(n);
+    std::mt19937 rng(17 + D);
+    std::uniform_real_distribution<double> keyDist(-1000.0, 1000.0);
+    std::uniform_int_distribution<int> index(0, n - 1);
+    std::uniform_int_distribution<int> operation(0, 9);
+
+    for (int step = 0; step < 60000; ++step) {
+        const int i = index(rng);
+        const double key = keyDist(rng);
+        const int op = operation(rng);
+        if (!heap.contains(i)) {
+            dary.insert(i, key);
+            heap.insert(i, key);
+        } else if (op < 4) {
+            if (key < heap.keyOf(i)) {
+                dary.decreaseKey(i, key);
+                heap.decreaseKey(i, key);
+            } else {
+                dary.increaseKey(i, key);
+                heap.increaseKey(i, key);
+            }
+        } else if (op < 6) {
+            dary.changeKey(i, key);
+            heap.changeKey(i, key);
+        } else if (op < 7) {
+            dary.remove(i);
+            heap.remove(i);
+        } else if (!heap.empty()) {
+            assert(dary.minKey() == heap.minKey());
+            assert(dary.removeMin() == heap.removeMin());
+        }
+        assert(dary.size() == heap.size());
+        assert(dary.contains(i) == heap.contains(i));
+    }
+    while (!heap.empty()) assert(dary.removeMin() == heap.removeMin());
+    assert(dary.empty());
+}
+
+void testRandomOperations() {
+    randomOperations<2>();
+    randomOperations<3>();
+    randomOperations<4>();
+    randomOperations<8>();
+    randomOperations<16>();
+
+    std::cout << "testRandomOperations passed\n";
+}
+
+void testClear() {
+    IndexDaryMinPQ<double> pq(4);
+    pq.insert(0, 5.0);
+    pq.insert(1, 6.0);
+    pq.clear();
+    assert(pq.empty());
+    assert(!pq.contains(1));
+    assert(pq.indices().empty());
+
+    pq.insert(1, 1.0);
+    pq.insert(2, 0.5);
+    assert(pq.indices().size() == 2 && pq.indices()[0] == 2);
+    assert(pq.keys_in_heap_order()[0] == 0.5);
+
+    std::cout << "testClear passed\n";
+}
+
+void testInvalidOperations() {
+    try {
+        IndexDaryMinPQ<double> pq(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    IndexDaryMinPQ<double> pq(3);
+    try {
+        pq.insert(3, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.removeMin();
+        assert(false);
+    } catch (const std::underflow_error&) {}
+    try {
+        pq.minKey();
+        assert(false);
+    } catch (const std::underflow_error&) {}
+
+    pq.insert(0, 4.0);
+    try {
+        pq.insert(0, 5.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.decreaseKey(0, 4.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.decreaseKey(0, 7.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.increaseKey(0, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.keyOf(1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidOperations passed\n";
+}
+
+void testAlgorithms() {
+    const EdgeWeightedDigraph digraph(1000, 8000);
+    const EdgeWeightedGraph graph(1000, 8000);
+    for (int s = 0; s < 3; ++s) {
+        const DijkstraSP heap(digraph, s);
+        const DijkstraSP<IndexDaryMinPQ<double, 4>> dary(digraph, s);
+        const DijkstraUndirectedSP undirectedHeap(graph, s);
+        const DijkstraUndirectedSP<IndexDaryMinPQ<double, 8>> undirectedDary(graph, s);
+        for (int v = 0; v < 1000; ++v) {
+            assert(dary.distTo(v) == heap.distTo(v));
+            assert(undirectedDary.distTo(v) == undirectedHeap.distTo(v));
+        }
+    }
+
+    const PrimMST heap(graph);
+    const PrimMST<IndexDaryMinPQ<double, 2>> binary(graph);
+    const PrimMST<IndexDaryMinPQ<double, 4>> quaternary(graph);
+    assert(std::abs(binary.weight() - heap.weight()) < 1e-9);
+    assert(std::abs(quaternary.weight() - heap.weight()) < 1e-9);
+    assert(quaternary.edges().size() == heap.edges().size());
+
+    std::cout << "testAlgorithms passed\n";
+}
+
+// Binary heap that counts its decreaseKey and removeMin calls
+struct CountingPQ : IndexMinPQ<double> {
+    using IndexMinPQ<double>::IndexMinPQ;
+    static inline long long decreases = 0;
+    static inline long long removals = 0;
+
+    void decreaseKey(const int i, const double key) {
+        ++decreases;
+        IndexMinPQ<double>::decreaseKey(i, key);
+    }
+
+    int removeMin() {
+        ++removals;
+        return IndexMinPQ<double>::removeMin();
+    }
+};
+
+template <typename Function>
+long long milliseconds(const Function& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename PriorityQueue>
+double timePrim(const CSREdgeWeightedGraph& g, const char* name) {
+    double weight = 0.0;
+    const long long ms = milliseconds([&] { weight = PrimMST<PriorityQueue>(g).weight(); });
+    std::cout << "    " << name << ": " << ms << " ms\n";
+    return weight;
+}
+
+template <typename PriorityQueue>
+double timeDijkstra(const CSREdgeWeightedDigraph& g, const char* name) {
+    double distance = 0.0;
+    const long long ms = milliseconds([&] { distance = DijkstraSP<PriorityQueue>(g, 0).distTo(g.V() - 1); });
+    std::cout << "    " << name << ": " << ms << " ms\n";
+    return distance;
+}
+
+// Dense graphs: every vertex has hundreds of neighbors, so decreaseKey runs
+// far more often than removeMin and shallower heaps pay off
+void benchmarkArity() {
+    std::mt19937 rng(42);
+    {
+        const int V = 5000, E = 1000000;
+        std::uniform_int_distribution<int> vertex(0, V - 1);
+        std::uniform_real_distribution<double> weight(0.0, 1.0);
+        std::vector<Edge> edges;
+        edges.reserve(E);
+        for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+        const CSREdgeWeightedGraph g(V, edges);
+
+        CountingPQ::decreases = CountingPQ::removals = 0;
+        PrimMST<CountingPQ> counted(g);
+        std::cout << "  PrimMST, " << V << " vertices, " << E << " edges (CSREdgeWeightedGraph), "
+                  << CountingPQ::decreases << " decreaseKey / " << CountingPQ::removals << " removeMin:\n";
+        const double a = timePrim<IndexMinPQ<double>>(g, "IndexMinPQ                 ");
+        const double b = timePrim<IndexDaryMinPQ<double, 2>>(g, "IndexDaryMinPQ<double, 2>  ");
+        const double c = timePrim<IndexDaryMinPQ<double, 4>>(g, "IndexDaryMinPQ<double, 4>  ");
+        const double d = timePrim<IndexDaryMinPQ<double, 8>>(g, "IndexDaryMinPQ<double, 8>  ");
+        const double e = timePrim<IndexDaryMinPQ<double, 16>>(g, "IndexDaryMinPQ<double, 16> ");
+        assert(std::abs(a - b) < 1e-9 && std::abs(a - c) < 1e-9 && std::abs(a - d) < 1e-9 && std::abs(a - e) < 1e-9);
+    }
+    {
+        const int V = 20000, E = 2000000;
+        std::uniform_int_distribution<int> vertex(0, V - 1);
+        std::uniform_real_distribution<double> weight(0.0, 1.0);
+        std::vector<DirectedEdge> edges;
+        edges.reserve(E);
+        for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+        const CSREdgeWeightedDigraph g(V, edges);
+
+        CountingPQ::decreases = CountingPQ::removals = 0;
+        DijkstraSP<CountingPQ> counted(g, 0);
+        std::cout << "  DijkstraSP, " << V << " vertices, " << E << " edges (CSREdgeWeightedDigraph), "
+                  << CountingPQ::decreases << " decreaseKey / " << CountingPQ::removals << " removeMin:\n";
+        const double a = timeDijkstra<IndexMinPQ<double>>(g, "IndexMinPQ                 ");
+        const double b = timeDijkstra<IndexDaryMinPQ<double, 2>>(g, "IndexDaryMinPQ<double, 2>  ");
+        const double c = timeDijkstra<IndexDaryMinPQ<double, 4>>(g, "IndexDaryMinPQ<double, 4>  ");
+        const double d = timeDijkstra<IndexDaryMinPQ<double, 8>>(g, "IndexDaryMinPQ<double, 8>  ");
+        const double e = timeDijkstra<IndexDaryMinPQ<double, 16>>(g, "IndexDaryMinPQ<double, 16> ");
+        assert(a == b && a == c && a == d && a == e);
+    }
+
+    std::cout << "benchmarkArity passed\n";
+}
+
+// Dijkstra-like workload: between two removals, `ratio` random elements get a
+// key between the last minimum and their current key
+template <typename PriorityQueue>
+long long decreaseKeyWorkload(const int n, const int ratio, const char* name) {
+    PriorityQueue pq(n);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<int> index(0, n - 1);
+    long long checksum = 0;
+    const long long ms = milliseconds([&] {
+        for (int i = 0; i < n; ++i) pq.insert(i, 1.0 + unit(rng));
+        double last = 0.0;
+        while (!pq.empty()) {
+            for (int k = 0; k < ratio; ++k) {
+                const int i = index(rng);
+                if (!pq.contains(i)) continue;
+                const double current = pq.keyOf(i);
+                const double key = last + (current - last) * unit(rng);
+                if (key < current) pq.decreaseKey(i, key);
+            }
+            last = pq.minKey();
+            checksum = checksum * 31 + pq.removeMin();
+        }
+    });
+    std::cout << "    " << name << ": " << ms << " ms\n";
+    return checksum;
+}
+
+void benchmarkDecreaseKeyWorkload() {
+    const int n = 1 << 18;
+    for (const int ratio : {1, 8}) {
+        std::cout << "  " << n << " elements, " << ratio << " decreaseKey attempts per removeMin:\n";
+        const long long a = decreaseKeyWorkload<IndexMinPQ<double>>(n, ratio, "IndexMinPQ                 ");
+        const long long b = decreaseKeyWorkload<IndexDaryMinPQ<double, 2>>(n, ratio, "IndexDaryMinPQ<double, 2>  ");
+        const long long c = decreaseKeyWorkload<IndexDaryMinPQ<double, 4>>(n, ratio, "IndexDaryMinPQ<double, 4>  ");
+        const long long d = decreaseKeyWorkload<IndexDaryMinPQ<double, 8>>(n, ratio, "IndexDaryMinPQ<double, 8>  ");
+        const long long e = decreaseKeyWorkload<IndexDaryMinPQ<double, 16>>(n, ratio, "IndexDaryMinPQ<double, 16> ");
+        assert(a == b && a == c && a == d && a == e);  // distinct keys: same removal order
+    }
+
+    std::cout << "benchmarkDecreaseKeyWorkload passed\n";
+}
+
+int main() {
+    std::cout << "Running IndexDaryMinPQ tests...\n";
+
+    testBasicOperations();
+    testKeyChanges();
+    testRandomOperations();
+    testClear();
+    testInvalidOperations();
+    testAlgorithms();
+    benchmarkArity();
+    benchmarkDecreaseKeyWorkload();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
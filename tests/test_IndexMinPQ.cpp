@@ -602,6 +602,13 @@ void test_utility_functions() {
     assert(keys.size() == 3);
     assert(keys[0] == 10);  // Root should have minimum key
 
+    // Test clear() function
+    pq.clear();
+    assert(pq.empty());
+    assert(!pq.contains(0) && !pq.contains(2) && !pq.contains(4));
+    pq.insert(2, 5);
+    assert(pq.minIndex() == 2);
+
     std::cout << "PASSED\n";
 }
 
@@ -0,0 +1,186 @@
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/IndexMinPQ.hpp"
+#include "../data_structures/IndexRadixHeap.hpp"
+
+void testBasicOperations() {
+    IndexRadixHeap<double> pq(10);
+    assert(pq.empty());
+    assert(pq.size() == 0);
+
+    pq.insert(3, 2.5);
+    pq.insert(7, 0.5);
+    pq.insert(1, 10.0);
+    pq.insert(4, 2.5);
+    assert(pq.size() == 4);
+    assert(pq.contains(7));
+    assert(!pq.contains(0));
+    assert(pq.keyOf(1) == 10.0);
+
+    assert(pq.minKey() == 0.5);
+    assert(pq.minIndex() == 7);
+    assert(pq.removeMin() == 7);
+    assert(!pq.contains(7));
+
+    // Ties come out in either order
+    const int a = pq.removeMin();
+    const int b = pq.removeMin();
+    assert((a == 3 && b == 4) || (a == 4 && b == 3));
+    assert(pq.removeMin() == 1);
+    assert(pq.empty());
+
+    std::cout << "testBasicOperations passed\n";
+}
+
+void testDecreaseKeyAndRemove() {
+    IndexRadixHeap<double> pq(5);
+    pq.insert(0, 8.0);
+    pq.insert(1, 6.0);
+    pq.insert(2, 7.0);
+    pq.insert(3, 9.0);
+
+    pq.decreaseKey(3, 1.0);
+    assert(pq.keyOf(3) == 1.0);
+    assert(pq.removeMin() == 3);
+
+    pq.remove(1);
+    assert(!pq.contains(1));
+    assert(pq.size() == 2);
+
+    // Decreasing to a key at the current minimum is allowed
+    pq.decreaseKey(0, 1.0);
+    assert(pq.removeMin() == 0);
+    assert(pq.removeMin() == 2);
+    assert(pq.empty());
+
+    std::cout << "testDecreaseKeyAndRemove passed\n";
+}
+
+void testIntegerKeys() {
+    IndexRadixHeap<int> pq(6);
+    const std::vector<int> keys = {40, 3, 3, 1000000, 0, 17};
+    for (int i = 0; i < 6; ++i) pq.insert(i, keys[i]);
+
+    std::vector<int> removed;
+    while (!pq.empty()) {
+        removed.push_back(pq.minKey());
+        pq.removeMin();
+    }
+    assert((removed == std::vector<int>{0, 3, 3, 17, 40, 1000000}));
+
+    std::cout << "testIntegerKeys passed\n";
+}
+
+void testMonotoneRandomOperations() {
+    // Simulates Dijkstra-like usage and compares against the binary heap
+    const int n = 2000;
+    IndexRadixHeap<double> radix(n);
+    IndexMinPQ<double> heap(n);
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> offset(0.0, 5.0);
+    std::uniform_int_distribution<int> index(0, n - 1);
+
+    double last = 0.0;
+    for (int step = 0; step < 50000; ++step) {
+        const int i = index(rng);
+        const double key = last + offset(rng);
+        if (!radix.contains(i)) {
+            radix.insert(i, key);
+            heap.insert(i, key);
+        } else if (key < radix.keyOf(i)) {
+            radix.decreaseKey(i, key);
+            heap.decreaseKey(i, key);
+        }
+
+        if (step % 3 == 0 && !heap.empty()) {
+            const double expected = heap.minKey();
+            assert(radix.minKey() == expected);
+            const int r = radix.removeMin();
+            assert(heap.keyOf(r) == expected);
+            heap.remove(r);
+            last = expected;
+        }
+        assert(radix.size() == heap.size());
+    }
+
+    std::cout << "testMonotoneRandomOperations passed\n";
+}
+
+void testClear() {
+    IndexRadixHeap<double> pq(4);
+    pq.insert(0, 5.0);
+    pq.insert(1, 6.0);
+    pq.removeMin();
+    pq.clear();
+    assert(pq.empty());
+    assert(!pq.contains(1));
+
+    // After clear the queue accepts keys below the old minimum again
+    pq.insert(1, 1.0);
+    assert(pq.removeMin() == 1);
+
+    std::cout << "testClear passed\n";
+}
+
+void testInvalidOperations() {
+    try {
+        IndexRadixHeap<double> pq(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    IndexRadixHeap<double> pq(3);
+    try {
+        pq.insert(3, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.insert(0, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.removeMin();
+        assert(false);
+    } catch (const std::underflow_error&) {}
+
+    pq.insert(0, 4.0);
+    pq.insert(1, 6.0);
+    try {
+        pq.insert(0, 5.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.decreaseKey(1, 7.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    // Keys below the last removed minimum break monotonicity
+    pq.removeMin();
+    try {
+        pq.insert(2, 3.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        pq.decreaseKey(1, 3.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidOperations passed\n";
+}
+
+int main() {
+    std::cout << "Running IndexRadixHeap tests...\n";
+
+    testBasicOperations();
+    testDecreaseKeyAndRemove();
+    testIntegerKeys();
+    testMonotoneRandomOperations();
+    testClear();
+    testInvalidOperations();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -413,6 +413,25 @@ void testSCCProperties() {
     std::cout << "testSCCProperties passed\n";
 }
 
+void testDeepChain() {
+    // A million-vertex path: far deeper than a recursive DFS can go on a default thread stack
+    const int V = 1000000;
+    Digraph g(V);
+    for (int v = 0; v + 1 < V; ++v) g.addEdge(v, v + 1);
+
+    const KosarajuSharirSCC chain(g);
+    assert(chain.count() == V);
+    assert(!chain.stronglyConnected(0, V - 1));
+
+    // Closing the path into a cycle makes it a single SCC
+    g.addEdge(V - 1, 0);
+    const KosarajuSharirSCC cycle(g);
+    assert(cycle.count() == 1);
+    assert(cycle.stronglyConnected(0, V - 1));
+
+    std::cout << "testDeepChain passed\n";
+}
+
 int main() {
     std::cout << "Running KosarajuSharirSCC tests...\n";
 
@@ -430,6 +449,7 @@ int main() {
     testSelfLoopsInSCCs();
     testInvalidVertex();
     testSCCProperties();
+    testDeepChain();
 
     std::cout << "All tests passed!\n";
     return 0;
@@ -0,0 +1,223 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/DijkstraQuery.hpp"
+#include "../data_structures/DijkstraSP.hpp"
+#include "../data_structures/LandmarkOracle.hpp"
+
+constexpr double INF = std::numeric_limits<double>::max();
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Road-like grid: n x n vertices, edges to the four neighbors in both directions,
+// weight = random detour factor in [1, 1.5)
+EdgeWeightedDigraph grid(const int n, const unsigned seed) {
+    EdgeWeightedDigraph g(n * n);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> detour(1.0, 1.5);
+    for (int r = 0; r < n; ++r) {
+        for (int c = 0; c < n; ++c) {
+            const int v = r * n + c;
+            if (c + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + 1, detour(rng)));
+                g.addEdge(DirectedEdge(v + 1, v, detour(rng)));
+            }
+            if (r + 1 < n) {
+                g.addEdge(DirectedEdge(v, v + n, detour(rng)));
+                g.addEdge(DirectedEdge(v + n, v, detour(rng)));
+            }
+        }
+    }
+    return g;
+}
+
+void testSmallDigraph() {
+    // 0 -> 1 -> 2 -> 3 with a shortcut 0 -> 2
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 2.0));
+    g.addEdge(DirectedEdge(2, 3, 3.0));
+    g.addEdge(DirectedEdge(0, 2, 2.5));
+
+    LandmarkOracle oracle(g, std::vector<int>{0, 3});
+    assert(oracle.landmarks() == std::vector<int>({0, 3}));
+    assert(oracle.lowerBound(0, 3) == 5.5);  // exact: 0 is a landmark
+    assert(oracle.upperBound(0, 3) == 5.5);
+    assert(oracle.lowerBound(1, 3) == 5.0);
+    assert(oracle.lowerBound(2, 2) == 0.0);
+    assert(oracle.upperBound(2, 2) == 0.0);
+
+    // 3 reaches no landmark-reachable vertex, so the tables prove 3 -> 0 impossible
+    assert(oracle.lowerBound(3, 0) == INF);
+    assert(oracle.query(3, 0) == INF);
+    assert(!oracle.hasPath());
+
+    assert(oracle.query(0, 3) == 5.5);
+    assert(oracle.path().size() == 2);
+    assert(oracle.path()[0] == DirectedEdge(0, 2, 2.5));
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+template <typename Oracle>
+void checkAgainstDijkstra(const EdgeWeightedDigraph& g, Oracle& oracle) {
+    for (const int s : {0, 37, 210, g.V() - 1}) {
+        const DijkstraSP sp(g, s);
+        for (int t = 0; t < g.V(); t += 7) {
+            const double d = sp.distTo(t);
+            // Bounds hold up to the rounding of the Dijkstra sums
+            assert(oracle.lowerBound(s, t) <= d * (1 + 1e-12));
+            assert(oracle.upperBound(s, t) >= d * (1 - 1e-12));
+            assert(close(oracle.query(s, t), d));
+
+            double total = 0.0;
+            int at = s;
+            for (const DirectedEdge& e : oracle.path()) {
+                assert(e.from() == at);
+                at = e.to();
+                total += e.weight();
+            }
+            assert(at == t);
+            assert(close(total, d));
+        }
+    }
+}
+
+void testSelections() {
+    const EdgeWeightedDigraph g = grid(20, 3);
+
+    LandmarkOracle farthest(g, 4, LandmarkSelection::Farthest, 3);
+    assert(farthest.landmarks().size() == 4);
+    checkAgainstDijkstra(g, farthest);
+
+    // The first landmark is the corner farthest from vertex 0, the second is vertex 0's corner
+    assert(farthest.landmarks()[0] == 399);
+    assert(farthest.landmarks()[1] == 0);
+
+    LandmarkOracle degree(g, 4, LandmarkSelection::Degree, 2);
+    checkAgainstDijkstra(g, degree);
+    for (const int v : degree.landmarks()) assert(g.outdegree(v) == 4);
+
+    // Float tables stay admissible
+    LandmarkOracle<EdgeWeightedDigraph, float> compact(g, 4);
+    checkAgainstDijkstra(g, compact);
+
+    // The same answers on a CSR digraph
+    const CSREdgeWeightedDigraph csr(g);
+    LandmarkOracle<CSREdgeWeightedDigraph> onCSR(csr, 4);
+    assert(onCSR.landmarks() == farthest.landmarks());
+    checkAgainstDijkstra(g, onCSR);
+
+    std::cout << "testSelections passed\n";
+}
+
+void testDisconnected() {
+    // Two components: {0, 1, 2} and {3, 4}; farthest selection covers both first
+    EdgeWeightedDigraph g(5);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 0, 1.0));
+    g.addEdge(DirectedEdge(3, 4, 2.0));
+    g.addEdge(DirectedEdge(4, 3, 2.0));
+
+    LandmarkOracle oracle(g, 2);
+    const int a = oracle.landmarks()[0], b = oracle.landmarks()[1];
+    assert((a < 3) != (b < 3));
+    assert(oracle.lowerBound(0, 4) == INF);
+    assert(oracle.upperBound(0, 4) == INF);
+    assert(oracle.query(3, 4) == 2.0);
+    assert(oracle.query(4, 1) == INF);
+
+    std::cout << "testDisconnected passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        LandmarkOracle oracle(negative, 1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(3);
+    for (const int landmarks : {0, 4, -1, 1 << 30}) {
+        try {
+            LandmarkOracle oracle(g, landmarks);
+            assert(false);
+        } catch (const std::invalid_argument&) {}
+    }
+    try {
+        LandmarkOracle oracle(g, std::vector<int>{});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        LandmarkOracle oracle(g, std::vector<int>{3});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        LandmarkOracle oracle(g, 1, LandmarkSelection::Farthest, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    LandmarkOracle oracle(g, 1);
+    try {
+        oracle.lowerBound(0, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        oracle.hasPath();
+        assert(false);
+    } catch (const std::logic_error&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: vertices settled per query with and without landmarks on a road-like grid
+void benchmarkSettledVertices() {
+    const int n = 150;
+    const CSREdgeWeightedDigraph g(grid(n, 42));
+
+    DijkstraQuery<CSREdgeWeightedDigraph> dijkstra(g);
+    LandmarkOracle<CSREdgeWeightedDigraph> alt(g, 8);
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> vertex(0, g.V() - 1);
+    const int queries = 100;
+    long long settledDijkstra = 0, settledALT = 0;
+    double gap = 0.0;
+    for (int i = 0; i < queries; ++i) {
+        const int s = vertex(rng), t = vertex(rng);
+        const double d = dijkstra.query(s, t);
+        assert(close(alt.query(s, t), d));
+        settledDijkstra += dijkstra.settledCount();
+        settledALT += alt.settledCount();
+        if (d > 0) gap += (alt.upperBound(s, t) - alt.lowerBound(s, t)) / d;
+    }
+
+    std::cout << "benchmarkSettledVertices (" << g.V() << " vertices, 8 landmarks, average per query):\n"
+              << "  DijkstraQuery:              " << settledDijkstra / queries << "\n"
+              << "  LandmarkOracle::query:      " << settledALT / queries << "\n"
+              << "  (upper - lower) / distance: " << gap / queries << "\n";
+    assert(settledALT < settledDijkstra);
+}
+
+int main() {
+    std::cout << "Running LandmarkOracle tests...\n";
+
+    testSmallDigraph();
+    testSelections();
+    testDisconnected();
+    testInvalidArguments();
+    benchmarkSettledVertices();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BreadthFirstPaths.hpp"
+#include "../data_structures/CSRDigraph.hpp"
+#include "../data_structures/DigraphGenerator.hpp"
+#include "../data_structures/GraphGenerator.hpp"
+#include "../data_structures/ParallelBFS.hpp"
+
+template <typename GraphType>
+void assertMatchesSequential(const GraphType& g, const int s, const int threads) {
+    const BreadthFirstPaths expected(g, s);
+    const ParallelBFS bfs(g, s, threads);
+    for (int v = 0; v < g.V(); ++v) {
+        assert(bfs.hasPathTo(v) == expected.hasPathTo(v));
+        assert(bfs.distTo(v) == expected.distTo(v));
+        assert(bfs.pathTo(v) == expected.pathTo(v));
+    }
+}
+
+void testSmallGraph() {
+    Graph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(1, 3);
+    g.addEdge(2, 3);
+    g.addEdge(3, 4);
+
+    const ParallelBFS bfs(g, 0, 2);
+    assert(bfs.distTo(3) == 2);
+    assert(bfs.distTo(4) == 3);
+    assert(!bfs.hasPathTo(5));
+    assert(bfs.pathTo(5).empty());
+    assert(bfs.pathTo(0) == std::vector<int>{0});
+    assertMatchesSequential(g, 0, 2);
+
+    std::cout << "testSmallGraph passed\n";
+}
+
+void testLargeUndirected() {
+    // Large enough that the middle levels are split into many blocks
+    const Graph g = GraphGenerator::simple(20000, 200000);
+    for (const int threads : {1, 2, 4, 8}) assertMatchesSequential(g, 0, threads);
+
+    std::cout << "testLargeUndirected passed\n";
+}
+
+void testLargeDirected() {
+    const Digraph g = DigraphGenerator::simple(20000, 150000);
+    assertMatchesSequential(g, 3, 4);
+    assertMatchesSequential(CSRDigraph(g), 3, 4);
+
+    std::cout << "testLargeDirected passed\n";
+}
+
+void testParallelEdgesAndSelfLoops() {
+    Graph g(3000);
+    for (int v = 1; v < 3000; ++v) {
+        g.addEdge(0, v);
+        g.addEdge(v, v);
+        g.addEdge(v, (v * 7) % 3000);
+        g.addEdge(v, (v * 7) % 3000);
+    }
+    assertMatchesSequential(g, 0, 4);
+
+    std::cout << "testParallelEdgesAndSelfLoops passed\n";
+}
+
+void testSharedPool() {
+    const Graph g = GraphGenerator::simple(5000, 40000);
+    ThreadPool pool(4);
+    for (int s = 0; s < 10; ++s) {
+        const BreadthFirstPaths expected(g, s);
+        const ParallelBFS bfs(g, s, pool);
+        for (int v = 0; v < g.V(); ++v) assert(bfs.distTo(v) == expected.distTo(v));
+    }
+
+    std::cout << "testSharedPool passed\n";
+}
+
+void testInvalidArguments() {
+    const Graph g(3);
+    try {
+        ParallelBFS bfs(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        ParallelBFS bfs(g, 0, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+int main() {
+    std::cout << "Running ParallelBFS tests...\n";
+
+    testSmallGraph();
+    testLargeUndirected();
+    testLargeDirected();
+    testParallelEdgesAndSelfLoops();
+    testSharedPool();
+    testInvalidArguments();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BellmanFordSP.hpp"
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
+#include "../data_structures/ParallelBellmanFordSP.hpp"
+
+// Sum of weights along path, checking that consecutive edges connect s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t) {
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+bool nearlyEqual(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Random digraph whose weights are shifted by vertex potentials, so many are negative but no cycle is
+CSREdgeWeightedDigraph shiftedDigraph(const int V, const int E, const unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::uniform_real_distribution<double> shift(0.0, 3.0);
+    std::vector<double> potential(V);
+    for (double& p : potential) p = shift(rng);
+    std::vector<DirectedEdge> edges;
+    for (int i = 0; i < E; ++i) {
+        const int v = vertex(rng);
+        const int w = vertex(rng);
+        edges.emplace_back(v, w, weight(rng) + potential[v] - potential[w]);
+    }
+    return CSREdgeWeightedDigraph(V, edges);
+}
+
+template <typename GraphType>
+void assertMatchesBellmanFord(const GraphType& g, const int s, const int threads) {
+    const BellmanFordSP expected(g, s);
+    const ParallelBellmanFordSP sp(g, s, threads);
+    assert(!sp.hasNegativeCycle());
+    for (int v = 0; v < g.V(); ++v) {
+        assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+        if (!expected.hasPathTo(v)) {
+            assert(sp.distTo(v) == std::numeric_limits<double>::max());
+            assert(sp.pathTo(v).empty());
+            continue;
+        }
+        assert(nearlyEqual(sp.distTo(v), expected.distTo(v)));
+        assert(nearlyEqual(pathWeight(sp.pathTo(v), s, v), sp.distTo(v)));
+    }
+}
+
+void testSmallDigraph() {
+    EdgeWeightedDigraph g(5);
+    g.addEdge(DirectedEdge(0, 1, 4.0));
+    g.addEdge(DirectedEdge(0, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 1, -2.0));
+    g.addEdge(DirectedEdge(1, 3, 1.0));
+    g.addEdge(DirectedEdge(4, 0, 1.0));
+
+    const ParallelBellmanFordSP sp(g, 0, 2);
+    assert(!sp.hasNegativeCycle());
+    assert(sp.V() == 5);
+    assert(sp.distTo(1) == -1.0);
+    assert(sp.distTo(3) == 0.0);
+    assert(sp.pathTo(3).size() == 3);
+    assert(!sp.hasPathTo(4));
+    assert(sp.rounds() >= 3);
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testMatchesBellmanFord() {
+    for (const int threads : {1, 2, 4}) {
+        const EdgeWeightedDigraph g(400, 2500);
+        assertMatchesBellmanFord(g, 0, threads);
+        for (unsigned seed = 1; seed <= 3; ++seed) {
+            const CSREdgeWeightedDigraph shifted = shiftedDigraph(20000, 120000, seed);
+            assertMatchesBellmanFord(shifted, 0, threads);
+            assertMatchesBellmanFord(shifted, 777, threads);
+        }
+    }
+
+    std::cout << "testMatchesBellmanFord passed\n";
+}
+
+void testNegativeCycle() {
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(2, 3, -3.0));
+    g.addEdge(DirectedEdge(3, 1, 1.0));
+    g.addEdge(DirectedEdge(3, 4, 1.0));
+
+    const ParallelBellmanFordSP sp(g, 0, 2);
+    assert(sp.hasNegativeCycle());
+    const std::vector<DirectedEdge> cycle = sp.negativeCycle();
+    assert(cycle.size() == 3);
+    assert(pathWeight(cycle, cycle.front().from(), cycle.front().from()) == -1.0);
+    try {
+        sp.distTo(4);
+        assert(false);
+    } catch (const std::logic_error&) {}
+    try {
+        sp.pathTo(4);
+        assert(false);
+    } catch (const std::logic_error&) {}
+
+    // Large random digraphs with some negative edges: reported cycles are real and negative
+    int found = 0;
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> vertex(0, 4999);
+        std::uniform_real_distribution<double> weight(-0.1, 1.0);
+        std::vector<DirectedEdge> edges;
+        for (int i = 0; i < 20000; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+        const CSREdgeWeightedDigraph r(5000, edges);
+        for (const int threads : {1, 3}) {
+            const ParallelBellmanFordSP rsp(r, 0, threads);
+            assert(rsp.hasNegativeCycle() == BellmanFordSP(r, 0).hasNegativeCycle());
+            if (!rsp.hasNegativeCycle()) continue;
+            ++found;
+            const std::vector<DirectedEdge> c = rsp.negativeCycle();
+            assert(pathWeight(c, c.front().from(), c.front().from()) < 0.0);
+        }
+    }
+    assert(found > 0);
+
+    std::cout << "testNegativeCycle passed\n";
+}
+
+void testSharedPool() {
+    const CSREdgeWeightedDigraph g = shiftedDigraph(3000, 15000, 11);
+    ThreadPool pool(3);
+    for (int s = 0; s < 10; ++s) {
+        const BellmanFordSP expected(g, s);
+        const ParallelBellmanFordSP sp(g, s, pool);
+        for (int v = 0; v < g.V(); ++v) {
+            assert(sp.hasPathTo(v) == expected.hasPathTo(v));
+            assert(!expected.hasPathTo(v) || nearlyEqual(sp.distTo(v), expected.distTo(v)));
+        }
+    }
+
+    std::cout << "testSharedPool passed\n";
+}
+
+void testInvalidArguments() {
+    const EdgeWeightedDigraph g(3);
+    try {
+        ParallelBellmanFordSP sp(g, 3);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ParallelBellmanFordSP sp(g, 0, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const ParallelBellmanFordSP sp(g, 0, 1);
+    try {
+        sp.distTo(-1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+void benchmarkAgainstBellmanFord() {
+    const CSREdgeWeightedDigraph g = shiftedDigraph(200000, 1600000, 42);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    const BellmanFordSP sequential(g, 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  BellmanFordSP: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms ("
+              << sequential.relaxations() << " relaxations)\n";
+
+    for (const int threads : {1, 2, 4, ThreadPool::defaultThreads()}) {
+        start = std::chrono::high_resolution_clock::now();
+        const ParallelBellmanFordSP sp(g, 0, threads);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "  ParallelBellmanFordSP (" << threads << " threads, " << sp.rounds() << " rounds): "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+        for (int v = 0; v < g.V(); v += 97) {
+            assert(sp.hasPathTo(v) == sequential.hasPathTo(v));
+            assert(!sequential.hasPathTo(v) || nearlyEqual(sp.distTo(v), sequential.distTo(v)));
+        }
+    }
+
+    std::cout << "benchmarkAgainstBellmanFord passed\n";
+}
+
+int main() {
+    std::cout << "Running ParallelBellmanFordSP tests...\n";
+
+    testSmallDigraph();
+    testMatchesBellmanFord();
+    testNegativeCycle();
+    testSharedPool();
+    testInvalidArguments();
+    benchmarkAgainstBellmanFord();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/BoruvkaMST.hpp"
+#include "../data_structures/Edge.hpp"
+#include "../data_structures/EdgeWeightedGraph.hpp"
+#include "../data_structures/KruskalMST.hpp"
+#include "../data_structures/ParallelBoruvkaMST.hpp"
+#include "../data_structures/WeightedQuickUnionPathCompressionUF.hpp"
+
+bool close(const double a, const double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+// Checks that the edges form a forest with one tree per connected component of g
+void checkSpanningForest(const std::vector<Edge>& forest, const int V, const std::vector<Edge>& graphEdges) {
+    WeightedQuickUnionPathCompressionUF uf(V);
+    for (const Edge& e : forest) {
+        const int v = e.either(), w = e.other(v);
+        assert(!uf.connected(v, w));
+        uf.unite(v, w);
+    }
+    for (const Edge& e : graphEdges) {
+        assert(uf.connected(e.either(), e.other(e.either())));
+    }
+}
+
+void testSmallGraph() {
+    EdgeWeightedGraph g(5);
+    g.addEdge(Edge(0, 1, 1.0));
+    g.addEdge(Edge(1, 2, 2.0));
+    g.addEdge(Edge(0, 2, 3.0));
+    g.addEdge(Edge(2, 3, 0.5));
+    g.addEdge(Edge(3, 3, 0.1));  // self-loop, ignored
+    g.addEdge(Edge(1, 3, 4.0));
+
+    const ParallelBoruvkaMST mst(g, 2);
+    assert(mst.edges().size() == 3);
+    assert(mst.weight() == 3.5);
+    checkSpanningForest(mst.edges(), g.V(), g.edges());
+
+    // Vertex 4 is isolated; an empty graph has an empty forest
+    const ParallelBoruvkaMST empty(EdgeWeightedGraph(3), 2);
+    assert(empty.edges().empty());
+    assert(empty.weight() == 0.0);
+    assert(empty.rounds() == 0);
+
+    std::cout << "testSmallGraph passed\n";
+}
+
+void testMatchesKruskal() {
+    std::mt19937 rng(7);
+    for (int trial = 0; trial < 20; ++trial) {
+        const int V = 200 + trial * 50;
+        std::uniform_int_distribution<int> vertex(0, V - 1);
+        std::uniform_int_distribution<int> weight(0, 20);  // integer weights: many ties
+        std::vector<Edge> edges;
+        for (int i = 0; i < 3 * V; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+        EdgeWeightedGraph g(V);
+        for (const Edge& e : edges) g.addEdge(e);
+
+        const KruskalMST kruskal(g);
+        const ParallelBoruvkaMST sequential(V, edges, 1);
+        const ParallelBoruvkaMST parallel(V, edges, 4);
+        const ParallelBoruvkaMST fromGraph(g, 3);
+
+        assert(sequential.weight() == kruskal.weight());
+        assert(fromGraph.weight() == kruskal.weight());
+        assert(sequential.edges().size() == kruskal.edges().size());
+        assert(parallel.edges() == sequential.edges());
+        checkSpanningForest(sequential.edges(), V, edges);
+        checkSpanningForest(fromGraph.edges(), V, edges);
+    }
+
+    std::cout << "testMatchesKruskal passed\n";
+}
+
+void testRounds() {
+    // A path 0 - 1 - ... - n-1 with increasing weights: every vertex picks its
+    // left edge, so one round contracts it into a single component
+    const int n = 1000;
+    std::vector<Edge> path;
+    for (int v = 0; v + 1 < n; ++v) path.emplace_back(v, v + 1, v);
+    const ParallelBoruvkaMST mst(n, path, 4);
+    assert(mst.rounds() == 1);
+    assert(mst.edges().size() == n - 1);
+
+    // Components at least halve every round
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> vertex(0, 9999);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<Edge> random;
+    for (int i = 0; i < 40000; ++i) random.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    const ParallelBoruvkaMST randomMST(10000, random, 4);
+    assert(randomMST.rounds() <= 14);
+
+    std::cout << "testRounds passed\n";
+}
+
+void testInvalidArguments() {
+    try {
+        ParallelBoruvkaMST mst(2, {Edge(0, 2, 1.0)});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ParallelBoruvkaMST mst(-1, std::vector<Edge>{});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        ParallelBoruvkaMST mst(EdgeWeightedGraph(2), 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: random graph with 1 million edges
+void benchmarkRandomGraph() {
+    const int V = 200000, E = 1000000;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<Edge> edges;
+    edges.reserve(E);
+    for (int i = 0; i < E; ++i) edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    EdgeWeightedGraph g(V);
+    for (const Edge& e : edges) g.addEdge(e);
+
+    using std::chrono::milliseconds;
+    const auto time = [](const auto& f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double boruvkaWeight = 0.0, kruskalWeight = 0.0, parallelWeight = 0.0, edgeListWeight = 0.0;
+    int rounds = 0;
+    const auto boruvka = time([&] { boruvkaWeight = BoruvkaMST(g).weight(); });
+    const auto kruskal = time([&] { kruskalWeight = KruskalMST(g).weight(); });
+    const auto parallel = time([&] { parallelWeight = ParallelBoruvkaMST(g).weight(); });
+    const auto edgeList = time([&] {
+        const ParallelBoruvkaMST mst(V, edges);
+        edgeListWeight = mst.weight();
+        rounds = mst.rounds();
+    });
+    assert(close(boruvkaWeight, kruskalWeight));
+    assert(close(parallelWeight, kruskalWeight));
+    assert(close(edgeListWeight, kruskalWeight));
+
+    std::cout << "benchmarkRandomGraph (" << V << " vertices, " << E << " edges, "
+              << "threads: " << ThreadPool::defaultThreads() << "):\n"
+              << "  BoruvkaMST:                       " << boruvka << " ms\n"
+              << "  KruskalMST:                       " << kruskal << " ms\n"
+              << "  ParallelBoruvkaMST (graph):       " << parallel << " ms\n"
+              << "  ParallelBoruvkaMST (edge list):   " << edgeList << " ms, " << rounds << " rounds\n";
+}
+
+int main() {
+    std::cout << "Running ParallelBoruvkaMST tests...\n";
+
+    testSmallGraph();
+    testMatchesKruskal();
+    testRounds();
+    testInvalidArguments();
+    benchmarkRandomGraph();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -1,9 +1,14 @@
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <random>
 #include <set>
 #include <vector>
 
+#include "../data_structures/CSRDigraph.hpp"
 #include "../data_structures/Digraph.hpp"
+#include "../data_structures/GabowSCC.hpp"
+#include "../data_structures/KosarajuSharirSCC.hpp"
 #include "../data_structures/TarjanSCC.hpp"
 
 void testSingleSCC() {
@@ -431,6 +436,56 @@ void testInvalidVertex() {
     std::cout << "testInvalidVertex passed\n";
 }
 
+void testDeepChain() {
+    // A million-vertex path: far deeper than a recursive DFS can go on a default thread stack
+    const int V = 1000000;
+    Digraph g(V);
+    for (int v = 0; v + 1 < V; ++v) g.addEdge(v, v + 1);
+
+    const TarjanSCC chain(g);
+    assert(chain.count() == V);
+    assert(!chain.stronglyConnected(0, V - 1));
+
+    // Closing the path into a cycle makes it a single SCC
+    g.addEdge(V - 1, 0);
+    const TarjanSCC cycle(g);
+    assert(cycle.count() == 1);
+    assert(cycle.stronglyConnected(0, V - 1));
+
+    std::cout << "testDeepChain passed\n";
+}
+
+// Benchmark: the three SCC algorithms on a deep graph (a Hamiltonian cycle plus random edges)
+void benchmarkDeepGraph() {
+    const int V = 1000000;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> vertex(0, V - 1);
+    Digraph g(V);
+    for (int v = 0; v < V; ++v) g.addEdge(v, (v + 1) % V);
+    for (int i = 0; i < 2 * V; ++i) g.addEdge(vertex(rng), vertex(rng));
+    const CSRDigraph csr(g);
+
+    using std::chrono::milliseconds;
+    const auto time = [](const auto& f) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    int count = 0;
+    const auto tarjan = time([&] { count = TarjanSCC(csr).count(); });
+    assert(count == 1);
+    const auto gabow = time([&] { count = GabowSCC(csr).count(); });
+    assert(count == 1);
+    const auto kosaraju = time([&] { count = KosarajuSharirSCC(csr).count(); });
+    assert(count == 1);
+
+    std::cout << "benchmarkDeepGraph (CSRDigraph, " << V << " vertices, " << csr.E() << " edges):\n"
+              << "  TarjanSCC:         " << tarjan << " ms\n"
+              << "  GabowSCC:          " << gabow << " ms\n"
+              << "  KosarajuSharirSCC: " << kosaraju << " ms\n";
+}
+
 int main() {
     std::cout << "Running TarjanSCC tests...\n";
 
@@ -449,6 +504,8 @@ int main() {
     testBackEdgeDetection();
     testTarjanProperties();
     testInvalidVertex();
+    testDeepChain();
+    benchmarkDeepGraph();
 
     std::cout << "All tests passed!\n";
     return 0;
@@ -0,0 +1,84 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/ThreadPool.hpp"
+
+void testRunCallsEveryIndex() {
+    ThreadPool pool(4);
+    assert(pool.size() == 4);
+
+    std::vector<int> calls(4, 0);
+    pool.run([&](const int t) { ++calls[t]; });
+    assert((calls == std::vector<int>{1, 1, 1, 1}));
+
+    std::cout << "testRunCallsEveryIndex passed\n";
+}
+
+void testRepeatedRuns() {
+    ThreadPool pool(3);
+    std::atomic<long long> sum{0};
+    for (int round = 0; round < 1000; ++round) {
+        pool.run([&](const int t) { sum += t + 1; });
+    }
+    assert(sum == 1000 * (1 + 2 + 3));
+
+    std::cout << "testRepeatedRuns passed\n";
+}
+
+void testSingleThread() {
+    ThreadPool pool(1);
+    int calls = 0;
+    pool.run([&](const int t) {
+        assert(t == 0);
+        ++calls;
+    });
+    assert(calls == 1);
+
+    std::cout << "testSingleThread passed\n";
+}
+
+void testExceptionPropagates() {
+    ThreadPool pool(4);
+    std::atomic<int> finished{0};
+    try {
+        pool.run([&](const int t) {
+            if (t == 2) throw std::runtime_error("worker failed");
+            ++finished;
+        });
+        assert(false);
+    } catch (const std::runtime_error&) {}
+    assert(finished == 3);
+
+    // The pool is still usable afterwards
+    std::atomic<int> calls{0};
+    pool.run([&](int) { ++calls; });
+    assert(calls == 4);
+
+    std::cout << "testExceptionPropagates passed\n";
+}
+
+void testInvalidSize() {
+    try {
+        ThreadPool pool(0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    assert(ThreadPool::defaultThreads() >= 1);
+
+    std::cout << "testInvalidSize passed\n";
+}
+
+int main() {
+    std::cout << "Running ThreadPool tests...\n";
+
+    testRunCallsEveryIndex();
+    testRepeatedRuns();
+    testSingleThread();
+    testExceptionPropagates();
+    testInvalidSize();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <iostream>
 
 #include "../data_structures/Digraph.hpp"
+#include "../data_structures/EdgeWeightedDigraph.hpp"
 #include "../data_structures/Topological.hpp"
 
 void testSimpleDAG() {
@@ -336,6 +337,30 @@ void testInvalidVertex() {
     std::cout << "testInvalidVertex passed\n";
 }
 
+void testEdgeWeightedDigraph() {
+    // Edge-weighted DAG: 0->1->2, 0->2, 3->1
+    EdgeWeightedDigraph g(4);
+    g.addEdge(DirectedEdge(0, 1, 0.5));
+    g.addEdge(DirectedEdge(1, 2, -1.0));
+    g.addEdge(DirectedEdge(0, 2, 2.0));
+    g.addEdge(DirectedEdge(3, 1, 1.0));
+
+    Topological topo(g);
+    assert(topo.hasOrder());
+    assert(topo.order().size() == 4);
+    for (const auto& e : g.edges()) {
+        assert(topo.rank(e.from()) < topo.rank(e.to()));
+    }
+
+    // Closing a cycle removes the order
+    g.addEdge(DirectedEdge(2, 3, 1.0));
+    Topological cyclic(g);
+    assert(!cyclic.hasOrder());
+    assert(cyclic.rank(0) == -1);
+
+    std::cout << "testEdgeWeightedDigraph passed\n";
+}
+
 int main() {
     std::cout << "Running Topological tests...\n";
 
@@ -352,6 +377,7 @@ int main() {
     testTaskSchedulingExample();
     testDiamondDAG();
     testInvalidVertex();
+    testEdgeWeightedDigraph();
 
     std::cout << "All tests passed!\n";
     return 0;
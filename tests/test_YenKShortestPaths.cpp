@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../data_structures/CSREdgeWeightedDigraph.hpp"
+#include "../data_structures/YenKShortestPaths.hpp"
+
+// Sum of weights along path, checking that it is a simple path from s to t
+double pathWeight(const std::vector<DirectedEdge>& path, const int s, const int t, const int V) {
+    std::vector<bool> visited(V, false);
+    visited[s] = true;
+    double total = 0.0;
+    int at = s;
+    for (const DirectedEdge& e : path) {
+        assert(e.from() == at);
+        at = e.to();
+        assert(!visited[at]);
+        visited[at] = true;
+        total += e.weight();
+    }
+    assert(at == t);
+    return total;
+}
+
+// Lengths of every simple path from v to t, by exhaustive search
+void allPathLengths(const EdgeWeightedDigraph& g, const int v, const int t, const double length,
+                    std::vector<bool>& onPath, std::vector<double>& lengths) {
+    if (v == t) {
+        lengths.push_back(length);
+        return;
+    }
+    onPath[v] = true;
+    for (const DirectedEdge& e : g.adj(v)) {
+        if (!onPath[e.to()]) allPathLengths(g, e.to(), t, length + e.weight(), onPath, lengths);
+    }
+    onPath[v] = false;
+}
+
+void testSmallDigraph() {
+    // Example from Yen's algorithm literature: C=0, D=1, E=2, F=3, G=4, H=5
+    EdgeWeightedDigraph g(6);
+    g.addEdge(DirectedEdge(0, 1, 3.0));
+    g.addEdge(DirectedEdge(0, 2, 2.0));
+    g.addEdge(DirectedEdge(1, 3, 4.0));
+    g.addEdge(DirectedEdge(2, 1, 1.0));
+    g.addEdge(DirectedEdge(2, 3, 2.0));
+    g.addEdge(DirectedEdge(2, 4, 3.0));
+    g.addEdge(DirectedEdge(3, 4, 2.0));
+    g.addEdge(DirectedEdge(3, 5, 1.0));
+    g.addEdge(DirectedEdge(4, 5, 2.0));
+
+    YenKShortestPaths yen(g, 2);
+    const auto paths = yen.query(0, 5, 3);
+    assert(paths.size() == 3);
+    assert(pathWeight(paths[0], 0, 5, 6) == 5.0);  // C E F H
+    assert(pathWeight(paths[1], 0, 5, 6) == 7.0);  // C E G H
+    assert(pathWeight(paths[2], 0, 5, 6) == 8.0);  // C D F H (ties with C E D F H, which sorts after)
+    assert(paths[2][0] == DirectedEdge(0, 1, 3.0));
+
+    // There are 7 simple paths from C to H; asking for more returns them all
+    assert(yen.query(0, 5, 100).size() == 7);
+    assert(yen.query(0, 5, 0).empty());
+    assert(yen.query(5, 0, 3).empty());
+
+    const auto self = yen.query(3, 3, 5);
+    assert(self.size() == 1 && self[0].empty());
+
+    std::cout << "testSmallDigraph passed\n";
+}
+
+void testParallelEdges() {
+    // Parallel edges give distinct paths
+    EdgeWeightedDigraph g(3);
+    g.addEdge(DirectedEdge(0, 1, 1.0));
+    g.addEdge(DirectedEdge(0, 1, 2.0));
+    g.addEdge(DirectedEdge(1, 2, 1.0));
+    g.addEdge(DirectedEdge(1, 2, 3.0));
+
+    YenKShortestPaths yen(g, 1);
+    const auto paths = yen.query(0, 2, 10);
+    assert(paths.size() == 4);
+    const std::vector<double> expected = {2.0, 3.0, 4.0, 5.0};
+    for (int i = 0; i < 4; ++i) assert(pathWeight(paths[i], 0, 2, 3) == expected[i]);
+
+    std::cout << "testParallelEdges passed\n";
+}
+
+void testMatchesExhaustiveSearch() {
+    std::mt19937 rng(5);
+    for (int trial = 0; trial < 30; ++trial) {
+        const int V = 9;
+        EdgeWeightedDigraph g(V);
+        std::uniform_int_distribution<int> vertex(0, V - 1);
+        std::uniform_int_distribution<int> weight(0, 5);  // small integers: many ties and zero weights
+        // Identical parallel edges would be indistinguishable paths, so only one edge per pair
+        std::vector<bool> used(V * V, false);
+        for (int i = 0; i < 25; ++i) {
+            const int v = vertex(rng), w = vertex(rng);
+            if (v != w && !used[v * V + w]) {
+                used[v * V + w] = true;
+                g.addEdge(DirectedEdge(v, w, weight(rng)));
+            }
+        }
+        const int s = vertex(rng), t = vertex(rng);
+        if (s == t) continue;
+
+        std::vector<bool> onPath(V, false);
+        std::vector<double> lengths;
+        allPathLengths(g, s, t, 0.0, onPath, lengths);
+        std::sort(lengths.begin(), lengths.end());
+
+        YenKShortestPaths sequential(g, 1);
+        YenKShortestPaths parallel(g, 4);
+        const int k = 12;
+        const auto paths = sequential.query(s, t, k);
+        assert(parallel.query(s, t, k) == paths);
+        assert(static_cast<int>(paths.size()) == std::min<int>(k, static_cast<int>(lengths.size())));
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            assert(pathWeight(paths[i], s, t, V) == lengths[i]);
+            for (std::size_t j = 0; j < i; ++j) assert(paths[i] != paths[j]);
+        }
+    }
+
+    std::cout << "testMatchesExhaustiveSearch passed\n";
+}
+
+void testInvalidArguments() {
+    EdgeWeightedDigraph negative(2);
+    negative.addEdge(DirectedEdge(0, 1, -1.0));
+    try {
+        YenKShortestPaths yen(negative);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    const EdgeWeightedDigraph g(3);
+    try {
+        YenKShortestPaths yen(g, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    YenKShortestPaths yen(g, 1);
+    try {
+        yen.query(0, 3, 1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        yen.query(0, 1, -1);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    std::cout << "testInvalidArguments passed\n";
+}
+
+// Benchmark: 10 shortest paths across a road-like grid, on one thread and on all threads
+void benchmarkGrid() {
+    const int n = 60;
+    EdgeWeightedDigraph list(n * n);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> detour(1.0, 1.5);
+    for (int r = 0; r < n; ++r) {
+        for (int c = 0; c < n; ++c) {
+            const int v = r * n + c;
+            if (c + 1 < n) {
+                list.addEdge(DirectedEdge(v, v + 1, detour(rng)));
+                list.addEdge(DirectedEdge(v + 1, v, detour(rng)));
+            }
+            if (r + 1 < n) {
+                list.addEdge(DirectedEdge(v, v + n, detour(rng)));
+                list.addEdge(DirectedEdge(v + n, v, detour(rng)));
+            }
+        }
+    }
+    const CSREdgeWeightedDigraph g(list);
+    const int s = 0, t = n * n - 1, k = 10;
+
+    YenKShortestPaths<CSREdgeWeightedDigraph> sequential(g, 1);
+    auto start = std::chrono::steady_clock::now();
+    const auto paths = sequential.query(s, t, k);
+    const auto oneThread = std::chrono::steady_clock::now() - start;
+
+    YenKShortestPaths<CSREdgeWeightedDigraph> parallel(g);
+    start = std::chrono::steady_clock::now();
+    assert(parallel.query(s, t, k) == paths);
+    const auto allThreads = std::chrono::steady_clock::now() - start;
+
+    assert(static_cast<int>(paths.size()) == k);
+    for (int i = 1; i < k; ++i) {
+        assert(pathWeight(paths[i - 1], s, t, g.V()) <= pathWeight(paths[i], s, t, g.V()));
+    }
+
+    using std::chrono::milliseconds;
+    std::cout << "benchmarkGrid (" << g.V() << " vertices, k = " << k << ", "
+              << sequential.spurCount() << " spur searches):\n"
+              << "  1 thread:  " << std::chrono::duration_cast<milliseconds>(oneThread).count() << " ms\n"
+              << "  " << parallel.threads() << " threads: "
+              << std::chrono::duration_cast<milliseconds>(allThreads).count() << " ms\n";
+}
+
+int main() {
+    std::cout << "Running YenKShortestPaths tests...\n";
+
+    testSmallDigraph();
+    testParallelEdges();
+    testMatchesExhaustiveSearch();
+    testInvalidArguments();
+    benchmarkGrid();
+
+    std::cout << "All tests passed!\n";
+    return 0;
+}